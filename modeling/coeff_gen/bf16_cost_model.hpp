@@ -0,0 +1,357 @@
+#ifndef BF16_COST_MODEL_HPP
+#define BF16_COST_MODEL_HPP
+
+#include <cstdint>
+#include <array>
+#include "bf16_exp2_pipeline.hpp"
+
+// =========================================================
+// Resource and Timing Estimate of the Linear exp Datapath
+// =========================================================
+//
+// A unit-gate model (bf16_cost): a 2-input AND/OR gate costs 1 gate equivalent (GE) and
+// 1 gate delay, an XOR 2 GE and 2 delays, a 2:1 multiplexer 3 GE and 2 delays, a full
+// adder 7 GE and 4 delays and a register bit 6 GE. Every block of the linear
+// datapath is sized from the widths of a policy (bf16_exp_cfg_t, bf16_exp_trunc_mult_t,
+// bf16_exp_csd_log2e_t, bf16_exp_rounding_t) and assigned to one ExpPipeOp, so the
+// estimate of a stage partition (ExpPipeOptions::cuts) follows the pipeline model:
+//
+//   Decompose  exponent window compare and zero/inf/NaN detect
+//   Reduce     mant_src * log2(e) (array or shift-and-add), base-2 bypass, exponent barrel shift
+//   LutFetch   address decoder and OR planes of the LUT_SIZE x PACKED_W ROM
+//   Multiply   a * x partial products and Dadda carry-save tree (result left in carry-save form)
+//   Add        3:2 row for b, CALC_W parallel-prefix carry-propagate adder
+//   Normalize  leading-zero counter and CALC_W left shift
+//   Round      exponent add, subnormal right shift, sticky tree, incrementer (none for RTZ)
+//   Recompose  special-case select
+//
+// The numbers rank configurations against each other; they are not a synthesis result.
+// The estimate covers one unit serving both bases (the log2(e) multiplier is counted
+// once, with the bypass multiplexer of 2^x).
+
+/**
+ * @brief Partial-product bits generated by a COEFF_W x IN_W multiplier with the
+ * trunc_w low columns dropped (the full COEFF_W * IN_W array for trunc_w = 0).
+ */
+constexpr uint64_t bf16_trunc_mult_pp_bits(int a_w, int x_w, int trunc_w) {
+    uint64_t bits = 0;
+    for (int j = 0; j < a_w; ++j) {
+        const int drop = trunc_w - j;
+        bits += static_cast<uint64_t>(drop <= 0 ? x_w : (drop < x_w ? x_w - drop : 0));
+    }
+    return bits;
+}
+
+/**
+ * @namespace bf16_cost
+ * @brief Unit-gate area (GE) and delay of the datapath building blocks.
+ */
+namespace bf16_cost {
+    constexpr int GE_XOR = 2;           // Also 2 gate delays
+    constexpr int GE_MUX = 3;           // 2:1 multiplexer, 2 gate delays
+    constexpr int GE_FA = 7;            // Full adder: 4 gate delays (two XORs) sum path
+    constexpr int GE_FLOP = 6;          // Register bit
+    constexpr int REG_DELAY = 4;        // Clock-to-Q plus setup, per stage
+
+    /** @brief Area and delay of one block. */
+    struct Unit {
+        uint64_t area = 0;   // Gate equivalents
+        int delay = 0;       // Unit gate delays
+    };
+
+    constexpr int ceil_log2(uint64_t v) {
+        int l = 0;
+        while ((uint64_t(1) << l) < v) ++l;
+        return l;
+    }
+
+    /** @brief Number of bits set in a constant. */
+    constexpr int popcount(uint64_t v) {
+        int n = 0;
+        for (; v; v &= v - 1) ++n;
+        return n;
+    }
+
+    /** @brief Dadda 3:2 levels that reduce rows operands to two. */
+    constexpr int dadda_levels(int rows) {
+        int levels = 0;
+        for (int d = 2; d < rows; d = d * 3 / 2) ++levels;
+        return levels;
+    }
+
+    /** @brief Carry-save tree over pp_bits partial products in rows rows, cols product columns (two rows out). */
+    constexpr Unit csa_tree(uint64_t pp_bits, int rows, int cols) {
+        Unit u;
+        const uint64_t two_rows = 2 * static_cast<uint64_t>(cols);
+        u.area = (pp_bits > two_rows ? pp_bits - two_rows : 0) * GE_FA;   // Each full adder removes one bit
+        u.delay = 4 * dadda_levels(rows);
+        return u;
+    }
+
+    /** @brief n-bit parallel-prefix (Sklansky) carry-propagate adder. */
+    constexpr Unit prefix_adder(int n) {
+        Unit u;
+        if (n <= 0) return u;
+        u.area = static_cast<uint64_t>(n) * (1 + 2 * GE_XOR) + static_cast<uint64_t>(n / 2) * ceil_log2(n) * 3;
+        u.delay = GE_XOR + 2 * ceil_log2(n) + GE_XOR;
+        return u;
+    }
+
+    /** @brief n-bit incrementer (AND prefix and XOR). */
+    constexpr Unit incrementer(int n) {
+        Unit u;
+        if (n <= 0) return u;
+        u.area = static_cast<uint64_t>(n) * GE_XOR + static_cast<uint64_t>(n / 2) * ceil_log2(n);
+        u.delay = ceil_log2(n) + GE_XOR;
+        return u;
+    }
+
+    /** @brief Logarithmic barrel shifter: w bits, shift amounts 0 .. max_shift. */
+    constexpr Unit shifter(int w, int max_shift) {
+        Unit u;
+        const int stages = ceil_log2(static_cast<uint64_t>(max_shift) + 1);
+        u.area = static_cast<uint64_t>(w) * stages * GE_MUX;
+        u.delay = 2 * stages;
+        return u;
+    }
+
+    /** @brief Leading-zero counter (priority encoder) over n bits: a tree of ceil_log2(n) levels. */
+    constexpr Unit leading_zero_counter(int n) {
+        Unit u;
+        const int depth = ceil_log2(n);
+        u.area = static_cast<uint64_t>(n) * 3;
+        u.delay = 2 * depth + 1;
+        return u;
+    }
+
+    /** @brief OR tree over n bits. */
+    constexpr Unit or_tree(int n) {
+        Unit u;
+        u.area = n > 1 ? static_cast<uint64_t>(n - 1) : 0;
+        u.delay = ceil_log2(n);
+        return u;
+    }
+
+    /** @brief ROM of entries words of word_w bits as a decoder plus OR planes (half the bits set). */
+    constexpr Unit rom(int entries, int word_w) {
+        Unit u;
+        const int addr_w = ceil_log2(entries);
+        u.area = static_cast<uint64_t>(entries) * (addr_w > 1 ? addr_w - 1 : 1) + static_cast<uint64_t>(entries) * word_w / 2;
+        u.delay = ceil_log2(addr_w) + 1 + ceil_log2(entries);
+        return u;
+    }
+}
+
+/**
+ * @brief Structure, per-operation cost and stage-register widths of a linear datapath.
+ */
+struct ExpCostEstimate {
+    // mant_src * log2(e): MANT_SRC_W x LOG2E_W array, or LOG2E_CSD_DIGITS shifted rows
+    uint64_t log2e_pp_bits = 0;
+    int log2e_rows = 0;
+    int log2e_levels = 0;
+    // a * x: COEFF_W x IN_W array without the truncated columns (plus a correction row)
+    uint64_t mult_pp_bits = 0;
+    int mult_rows = 0;
+    int mult_cols = 0;
+    int mult_levels = 0;
+    // Adders
+    int log2e_add_w = 0;        // Final adder of the log2(e) product (MANT_MULT_W)
+    int sub_w = 0;              // b - a*x carry-propagate adder
+    int exp_add_w = 0;          // Result exponent
+    int round_inc_w = 0;        // Rounding incrementer (0: round toward zero)
+    int rand_add_w = 0;         // Stochastic rounding: discarded bits + random bits
+    // Shifters and priority encoder
+    int reduce_shift_w = 0;
+    int reduce_shift_stages = 0;
+    int norm_shift_w = 0;
+    int norm_shift_stages = 0;
+    int round_shift_w = 0;
+    int round_shift_stages = 0;
+    int lzc_w = 0;
+    int lzc_depth = 0;
+    // Tables
+    uint64_t rom_bits = 0;
+    int lfsr_bits = 0;
+
+    std::array<uint64_t, EXP_PIPE_OPS> op_area = {};   // Gate equivalents per ExpPipeOp
+    std::array<int, EXP_PIPE_OPS> op_delay = {};       // Unit gate delays per ExpPipeOp
+    std::array<int, EXP_PIPE_OPS> cut_bits = {};       // Live bits after each ExpPipeOp (last: output register)
+
+    /** @brief Combinational logic and ROM, without stage registers. */
+    constexpr uint64_t logic_area() const {
+        uint64_t a = 0;
+        for (uint64_t v : op_area) a += v;
+        return a;
+    }
+
+    /** @brief Register bits of a partition: one register per cut plus the output register. */
+    constexpr uint64_t register_bits(uint32_t cuts) const {
+        uint64_t bits = cut_bits[EXP_PIPE_OPS - 1];
+        for (int op = 0; op < EXP_PIPE_OPS - 1; ++op) {
+            if ((cuts >> op) & 1) bits += cut_bits[op];
+        }
+        return bits;
+    }
+
+    /** @brief Logic, ROM and stage registers (LFSR included) of a partition. */
+    constexpr uint64_t area(uint32_t cuts) const {
+        return logic_area() + (register_bits(cuts) + lfsr_bits) * bf16_cost::GE_FLOP;
+    }
+
+    /** @brief Delay of stage s of a partition: its operations plus the register overhead (0 past the last stage). */
+    constexpr int stage_delay(uint32_t cuts, int s) const {
+        int stage = 0, delay = 0;
+        for (int op = 0; op < EXP_PIPE_OPS; ++op) {
+            if (stage == s) delay += op_delay[op];
+            if (op < EXP_PIPE_OPS - 1 && ((cuts >> op) & 1)) ++stage;
+        }
+        return s <= stage ? delay + bf16_cost::REG_DELAY : 0;
+    }
+
+    /** @brief Clock period in gate delays: the slowest stage. */
+    constexpr int critical_delay(uint32_t cuts) const {
+        int worst = 0;
+        for (int s = 0; s < EXP_PIPE_OPS; ++s) worst = std::max(worst, stage_delay(cuts, s));
+        return worst;
+    }
+
+    /** @brief Relative clock frequency, 1000 / critical_delay (per thousand gate delays). */
+    constexpr double fmax(uint32_t cuts) const { return 1000.0 / critical_delay(cuts); }
+};
+
+/**
+ * @brief Estimates the linear datapath Cfg.
+ * * @tparam Cfg Linear width policy or datapath, including the truncated multiplier,
+ *             shift-and-add log2(e) and rounding policy wrappers.
+ */
+template<typename Cfg>
+constexpr ExpCostEstimate bf16_exp_cost_estimate() {
+    using namespace bf16_cost;
+    ExpCostEstimate e;
+
+    const int exp_w = Cfg::IN_CONV_INT_W;       // Integer part of the reduced input (result exponent)
+    const int path_w = 2;                       // ExpPath
+    const int out_w = 16;                       // BF16 result
+
+    // Decompose: 8-bit exponent window compare, zero / all-ones detect of exponent and mantissa
+    {
+        const Unit cmp = prefix_adder(8);
+        const Unit zero = or_tree(8);
+        e.op_area[static_cast<int>(ExpPipeOp::Decompose)] = 2 * cmp.area + 3 * zero.area + 8;
+        e.op_delay[static_cast<int>(ExpPipeOp::Decompose)] = cmp.delay + 2;
+        e.cut_bits[static_cast<int>(ExpPipeOp::Decompose)] = out_w + path_w;
+    }
+
+    // Reduce: log2(e) product, 2^x bypass, exponent shift into the unified format
+    {
+        Unit mult;
+        if constexpr (Cfg::LOG2E_CSD_DIGITS > 0) {
+            e.log2e_rows = Cfg::LOG2E_CSD_DIGITS;
+            e.log2e_pp_bits = static_cast<uint64_t>(Cfg::LOG2E_CSD_DIGITS) * Cfg::MANT_SRC_W;
+            mult.area = static_cast<uint64_t>(popcount(Cfg::LOG2E_CSD_NEG)) * Cfg::MANT_SRC_W;   // Inverted rows
+        } else {
+            e.log2e_rows = Cfg::MANT_SRC_W;
+            e.log2e_pp_bits = static_cast<uint64_t>(Cfg::MANT_SRC_W) * Cfg::LOG2E_W;
+            mult.area = e.log2e_pp_bits;                                                          // AND array
+            mult.delay = 1;
+        }
+        const Unit tree = csa_tree(e.log2e_pp_bits, e.log2e_rows, Cfg::MANT_MULT_W);
+        e.log2e_levels = dadda_levels(e.log2e_rows);
+        e.log2e_add_w = e.log2e_rows > 1 ? Cfg::MANT_MULT_W : 0;
+        const Unit add = prefix_adder(e.log2e_add_w);
+
+        e.reduce_shift_w = bf16_native::unified_w<Cfg>();
+        const int shift_range = Cfg::INPUT_MAX_EXP - Cfg::INPUT_MIN_EXP;
+        const Unit shift = shifter(e.reduce_shift_w, shift_range);
+        e.reduce_shift_stages = ceil_log2(static_cast<uint64_t>(shift_range) + 1);
+
+        e.op_area[static_cast<int>(ExpPipeOp::Reduce)] = mult.area + tree.area + add.area +
+                                                          static_cast<uint64_t>(Cfg::MANT_MULT_W) * GE_MUX + shift.area;
+        e.op_delay[static_cast<int>(ExpPipeOp::Reduce)] = mult.delay + tree.delay + add.delay + 2 + shift.delay;
+        e.cut_bits[static_cast<int>(ExpPipeOp::Reduce)] = Cfg::IN_F + exp_w + path_w;
+    }
+
+    // LutFetch: inverted address (free) and the coefficient ROM
+    {
+        e.rom_bits = static_cast<uint64_t>(Cfg::LUT_SIZE) * 2 * Cfg::COEFF_W;
+        const Unit r = rom(Cfg::LUT_SIZE, 2 * Cfg::COEFF_W);
+        e.op_area[static_cast<int>(ExpPipeOp::LutFetch)] = r.area;
+        e.op_delay[static_cast<int>(ExpPipeOp::LutFetch)] = r.delay;
+        e.cut_bits[static_cast<int>(ExpPipeOp::LutFetch)] = Cfg::IN_W + 2 * Cfg::COEFF_W + exp_w + path_w;
+    }
+
+    // Multiply: a * x partial products and carry-save tree
+    {
+        e.mult_pp_bits = bf16_trunc_mult_pp_bits(Cfg::COEFF_W, Cfg::IN_W, Cfg::MULT_TRUNC_W);
+        e.mult_cols = Cfg::MULT_W - Cfg::MULT_TRUNC_W;
+        e.mult_rows = Cfg::COEFF_W + (Cfg::MULT_CORR != 0 ? 1 : 0);
+        e.mult_levels = dadda_levels(e.mult_rows);
+        const Unit tree = csa_tree(e.mult_pp_bits + popcount(Cfg::MULT_CORR), e.mult_rows, e.mult_cols);
+        e.op_area[static_cast<int>(ExpPipeOp::Multiply)] = e.mult_pp_bits + tree.area;
+        e.op_delay[static_cast<int>(ExpPipeOp::Multiply)] = 1 + tree.delay;
+        e.cut_bits[static_cast<int>(ExpPipeOp::Multiply)] = 2 * e.mult_cols + Cfg::COEFF_W + exp_w + path_w;
+    }
+
+    // Add: b joins the carry-save pair (one 3:2 row), then the carry-propagate adder
+    {
+        e.sub_w = Cfg::CALC_W - Cfg::MULT_TRUNC_W;
+        const Unit add = prefix_adder(e.sub_w);
+        e.op_area[static_cast<int>(ExpPipeOp::Add)] = static_cast<uint64_t>(e.sub_w) * GE_FA + add.area;
+        e.op_delay[static_cast<int>(ExpPipeOp::Add)] = 4 + add.delay;
+        e.cut_bits[static_cast<int>(ExpPipeOp::Add)] = Cfg::CALC_W + exp_w + path_w;
+    }
+
+    // Normalize: priority encoder, then the left shift by its count
+    {
+        e.lzc_w = Cfg::CALC_W;
+        e.lzc_depth = ceil_log2(Cfg::CALC_W);
+        e.norm_shift_w = Cfg::CALC_W;
+        e.norm_shift_stages = ceil_log2(Cfg::CALC_W);
+        const Unit lzc = leading_zero_counter(e.lzc_w);
+        const Unit shift = shifter(e.norm_shift_w, Cfg::CALC_W - 1);
+        e.op_area[static_cast<int>(ExpPipeOp::Normalize)] = lzc.area + shift.area;
+        e.op_delay[static_cast<int>(ExpPipeOp::Normalize)] = lzc.delay + shift.delay;
+        e.cut_bits[static_cast<int>(ExpPipeOp::Normalize)] = Cfg::POLY_OUT_W + e.lzc_depth + 1 + exp_w + path_w;
+    }
+
+    // Round: exponent add and subnormal compare, right shift, sticky, increment and renormalize
+    {
+        typedef typename Cfg::Rounding Rounding;
+        e.exp_add_w = exp_w + 1;
+        const Unit exp_add = prefix_adder(e.exp_add_w);
+        e.round_shift_w = Cfg::POLY_OUT_W;
+        e.round_shift_stages = ceil_log2(static_cast<uint64_t>(Cfg::POLY_OUT_W) + 1);
+        const Unit shift = shifter(e.round_shift_w, Cfg::POLY_OUT_W);
+        const Unit sticky = or_tree(Cfg::POLY_OUT_W);
+        Unit decide, inc;
+        if constexpr (Rounding::MODE == RoundMode::Stochastic) {
+            e.rand_add_w = Rounding::RAND_W;
+            e.lfsr_bits = Rounding::Source::W;
+            decide = prefix_adder(e.rand_add_w);
+            decide.area += static_cast<uint64_t>(popcount(Rounding::Source::TAPS)) * GE_XOR;
+        } else {
+            decide.area = 3;
+            decide.delay = 2;
+        }
+        if constexpr (Rounding::MODE != RoundMode::TowardZero) {
+            e.round_inc_w = Cfg::EXT_MANT_W;
+            inc = incrementer(e.round_inc_w);
+            inc.area += static_cast<uint64_t>(Cfg::EXT_MANT_W) * GE_MUX;   // Carry renormalization
+            inc.delay += 2;
+        }
+        e.op_area[static_cast<int>(ExpPipeOp::Round)] = exp_add.area + shift.area + sticky.area + decide.area + inc.area;
+        e.op_delay[static_cast<int>(ExpPipeOp::Round)] = exp_add.delay + shift.delay + std::max(sticky.delay, decide.delay) + inc.delay;
+        e.cut_bits[static_cast<int>(ExpPipeOp::Round)] = out_w + path_w;
+    }
+
+    // Recompose: special-case select into the output register
+    {
+        e.op_area[static_cast<int>(ExpPipeOp::Recompose)] = static_cast<uint64_t>(out_w) * GE_MUX + 4;
+        e.op_delay[static_cast<int>(ExpPipeOp::Recompose)] = 2 + 1;
+        e.cut_bits[static_cast<int>(ExpPipeOp::Recompose)] = out_w;
+    }
+    return e;
+}
+
+#endif // BF16_COST_MODEL_HPP
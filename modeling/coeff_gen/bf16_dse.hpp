@@ -0,0 +1,406 @@
+#ifndef BF16_DSE_HPP
+#define BF16_DSE_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "fp_utils.hpp"
+#include "fp_sweep.hpp"
+#include "golden_io.hpp"
+#include "fp_reference.hpp"
+#include "ulp_analysis.hpp"
+#include "bf16_exp2.hpp"
+#include "bf16_lattice_fit.hpp"
+#include "bf16_cost_model.hpp"
+
+// =========================================================
+// Design-Space Exploration of the exp Datapath Widths
+// =========================================================
+//
+// A design point is a width policy bf16_exp_cfg_t<LUT_ADDR_W, COEFF_F, LOG2E_F>. For each
+// point the coefficient ROM is refitted with the lattice fitter (both bases share it),
+// then every negative BF16 input is run through bf16_exp_approx_with and the native core
+// of that policy, and measured against the correctly rounded reference tables (or a
+// double-precision recompute when they are missing). Positive inputs are not swept: the
+// datapath returns 1.0 for all of them regardless of the widths.
+//
+// Cost proxies: ROM bits (LUT_SIZE * 2 * COEFF_W) and multiplier area, counted as the
+// partial-product bits of the a * x (COEFF_W x IN_W) and mantissa * log2(e)
+// (MANT_SRC_W x LOG2E_W) multipliers. Each point also carries the unit-gate area and
+// delay of bf16_exp_cost_estimate (bf16_cost_model.hpp).
+
+/**
+ * @brief Parameters of a design-space sweep.
+ */
+struct DseOptions {
+    int radius = 16;             // Lattice half-width of the coefficient refit
+    unsigned num_threads = 0;    // 0 = all cores
+};
+
+/**
+ * @brief Correctly rounded reference tables for the exhaustive check (empty = recompute).
+ */
+struct DseReferences {
+    GoldenFile exp2;
+    GoldenFile expe;
+    bool has_exp2 = false;
+    bool has_expe = false;
+
+    /** @brief Opens the bf16_<function>_ref.bin tables in dir, if present. */
+    void open(const std::string& dir) {
+        const std::string exp2_path = dir + "/bf16_exp2_ref.bin";
+        const std::string expe_path = dir + "/bf16_expe_ref.bin";
+        has_exp2 = golden_is_binary(exp2_path) && exp2.open(exp2_path);
+        has_expe = golden_is_binary(expe_path) && expe.open(expe_path);
+    }
+};
+
+/**
+ * @brief Measured cost and error of one configuration.
+ */
+struct DsePoint {
+    int lut_addr_w;
+    int coeff_f;
+    int log2e_f;
+
+    int lut_size;
+    uint64_t rom_bits;          // LUT_SIZE * 2 * COEFF_W
+    int coeff_w;                // a * x multiplier: COEFF_W x IN_W
+    int in_w;
+    int mant_src_w;             // mant_src * log2(e) multiplier: MANT_SRC_W x LOG2E_W
+    int log2e_w;
+    int calc_w;
+    uint64_t area_ge;           // bf16_exp_cost_estimate: logic, ROM and output register
+    int delay;                  // bf16_exp_cost_estimate: combinational path, in gate delays
+
+    double exp2_max_ulp;        // Exhaustive over the negative inputs
+    double expe_max_ulp;
+    double mean_ulp;            // Over the core inputs of both bases (the ones the widths affect)
+    uint64_t candidates;        // Lattice points scored by the refit
+    std::vector<uint64_t> rom;  // Refitted ROM, LUT_SIZE words of (b << COEFF_W) | a
+    bool pareto;
+
+    uint64_t mult_bits() const {
+        return static_cast<uint64_t>(coeff_w) * in_w + static_cast<uint64_t>(mant_src_w) * log2e_w;
+    }
+    double max_ulp() const { return std::max(exp2_max_ulp, expe_max_ulp); }
+};
+
+/**
+ * @brief Runs every negative BF16 input through bf16_exp_approx_with and core (any
+ * approximation engine), and returns the ULP statistics of the half range.
+ */
+template<Base B, typename CoreFn>
+UlpHistogram bf16_dse_exhaustive_with(CoreFn core, const GoldenFile* reference, unsigned num_threads) {
+    constexpr uint32_t FIRST = 0x8000;
+    constexpr uint64_t COUNT = 0x8000;
+
+    std::vector<uint16_t> outputs(COUNT);
+    SweepOptions sweep;
+    sweep.num_threads = num_threads;
+    fp_sweep_for_each(0, COUNT, [&](uint64_t i) {
+        outputs[i] = bf16_exp_approx_with(static_cast<uint16_t>(FIRST + i), core);
+    }, sweep);
+
+    UlpAnalysisOptions opts;
+    opts.num_threads = num_threads;
+    opts.top_k = 0;
+    opts.write_text = false;
+
+    UlpReport report;
+    if (!reference || !ulp_analyze_reference(outputs.data(), COUNT, FIRST, *reference, report, FPType::BF16, opts)) {
+        report = ulp_analyze(outputs.data(), COUNT, FIRST, [](double x) {
+            return static_cast<double>(B == Base::Two ? std::exp2(static_cast<long double>(x)) : std::exp(static_cast<long double>(x)));
+        }, FPType::BF16, opts);
+    }
+    return report.total;
+}
+
+/**
+ * @brief bf16_dse_exhaustive_with for the native linear core of Cfg and rom.
+ */
+template<Base B, typename Cfg>
+UlpHistogram bf16_dse_exhaustive(const uint64_t* rom, const GoldenFile* reference, unsigned num_threads) {
+    return bf16_dse_exhaustive_with<B>([rom](const FPRaw& parts) { return bf16_exp_core_approx_native<B, Cfg>(parts, rom); },
+                                       reference, num_threads);
+}
+
+/**
+ * @brief Refits the coefficient ROM of Cfg and measures the configuration.
+ */
+template<typename Cfg>
+DsePoint bf16_dse_evaluate(const DseOptions& opts, const DseReferences& refs) {
+    LatticeFitOptions fit_opts;
+    fit_opts.coeff_f = Cfg::COEFF_F;
+    fit_opts.lut_size = Cfg::LUT_SIZE;
+    fit_opts.radius = opts.radius;
+    fit_opts.num_threads = opts.num_threads;
+    const LatticeFitResult fit = bf16_lattice_fit<Cfg>(fit_opts);
+
+    DsePoint p;
+    p.lut_addr_w = Cfg::LUT_ADDR_W;
+    p.coeff_f = Cfg::COEFF_F;
+    p.log2e_f = Cfg::LOG2E_F;
+    p.lut_size = Cfg::LUT_SIZE;
+    p.rom_bits = fit.rom_bits;
+    p.coeff_w = Cfg::COEFF_W;
+    p.in_w = Cfg::IN_W;
+    p.mant_src_w = Cfg::MANT_SRC_W;
+    p.log2e_w = Cfg::LOG2E_W;
+    p.calc_w = Cfg::CALC_W;
+    constexpr ExpCostEstimate cost = bf16_exp_cost_estimate<Cfg>();
+    p.area_ge = cost.area(EXP_PIPE_CUTS_NONE);
+    p.delay = cost.critical_delay(EXP_PIPE_CUTS_NONE);
+
+    p.exp2_max_ulp = bf16_dse_exhaustive<Base::Two, Cfg>(fit.rom.data(), refs.has_exp2 ? &refs.exp2 : nullptr, opts.num_threads).max_ulp;
+    p.expe_max_ulp = bf16_dse_exhaustive<Base::E, Cfg>(fit.rom.data(), refs.has_expe ? &refs.expe : nullptr, opts.num_threads).max_ulp;
+    p.mean_ulp = fit.score.mean_ulp();
+    p.candidates = 0;
+    for (const LatticeSegment& s : fit.segments) p.candidates += s.candidates;
+    p.rom = fit.rom;
+    p.pareto = false;
+    return p;
+}
+
+/**
+ * @brief Measured cost and error of one truncation of the a * x multiplier.
+ */
+struct DseTruncPoint {
+    int keep_w;            // Product columns kept (MULT_W = full product)
+    int trunc_w;           // Product columns dropped
+    uint64_t corr;         // Correction, in units of the lowest kept column
+    uint64_t pp_bits;      // Partial-product bits generated
+    double exp2_max_ulp;   // Exhaustive over the negative inputs
+    double expe_max_ulp;
+    double mean_ulp;       // Over the negative inputs of both bases
+
+    double max_ulp() const { return std::max(exp2_max_ulp, expe_max_ulp); }
+};
+
+/**
+ * @brief Measures a linear datapath with a truncated a * x multiplier (bf16_exp_trunc_mult_t)
+ * over every negative input, with the datapath's own ROM.
+ */
+template<typename Cfg>
+DseTruncPoint bf16_dse_evaluate_trunc(const DseReferences& refs, unsigned num_threads) {
+    const UlpHistogram exp2 = bf16_dse_exhaustive<Base::Two, Cfg>(Cfg::ROM, refs.has_exp2 ? &refs.exp2 : nullptr, num_threads);
+    const UlpHistogram expe = bf16_dse_exhaustive<Base::E, Cfg>(Cfg::ROM, refs.has_expe ? &refs.expe : nullptr, num_threads);
+
+    DseTruncPoint p;
+    p.keep_w = Cfg::MULT_W - Cfg::MULT_TRUNC_W;
+    p.trunc_w = Cfg::MULT_TRUNC_W;
+    p.corr = Cfg::MULT_CORR;
+    p.pp_bits = bf16_trunc_mult_pp_bits(Cfg::COEFF_W, Cfg::IN_W, Cfg::MULT_TRUNC_W);
+    p.exp2_max_ulp = exp2.max_ulp;
+    p.expe_max_ulp = expe.max_ulp;
+    p.mean_ulp = (exp2.sum_ulp + expe.sum_ulp) / static_cast<double>(std::max<uint64_t>(1, exp2.finite + expe.finite));
+    return p;
+}
+
+/**
+ * @brief Index of the cheapest point (points ordered from the exact hardware to the cheapest)
+ * such that it and every point before it satisfy ok; -1 if the first one does not.
+ */
+template<typename Point, typename Pred>
+int bf16_dse_limit(const std::vector<Point>& points, Pred ok) {
+    int limit = -1;
+    for (size_t i = 0; i < points.size() && ok(points[i]); ++i) limit = static_cast<int>(i);
+    return limit;
+}
+
+/**
+ * @brief Index of the most aggressive truncation (points ordered by increasing trunc_w)
+ * such that it and every milder one stay within target_ulp; -1 if none does.
+ */
+inline int bf16_dse_trunc_limit(const std::vector<DseTruncPoint>& points, double target_ulp) {
+    return bf16_dse_limit(points, [target_ulp](const DseTruncPoint& p) { return p.max_ulp() <= target_ulp; });
+}
+
+/**
+ * @brief Measured cost and error of one shift-and-add log2(e) multiplier.
+ */
+struct DseCsdPoint {
+    int digits;             // Non-zero CSD digits kept
+    int adders;             // digits - 1 adders/subtractors
+    uint64_t log2e_bits;    // Value of the kept digits
+    uint64_t mismatches;    // e^x outputs (all 65536 inputs) differing from the general multiplier
+    double expe_max_ulp;    // Exhaustive over the negative inputs
+    double expe_mean_ulp;
+};
+
+/**
+ * @brief Linear datapath Full with a shift-and-add log2(e) multiplier whose digits are set at
+ * run time (LOG2E_CSD_POS / LOG2E_CSD_NEG), so the digit search can score many constants
+ * without an instantiation each. Only the native core reads them; set them before a sweep.
+ */
+template<typename Full>
+struct bf16_dse_log2e_probe : Full {
+    static constexpr int LOG2E_CSD_DIGITS = 1;
+    static inline uint64_t LOG2E_CSD_POS = Full::LOG2E_BITS;
+    static inline uint64_t LOG2E_CSD_NEG = 0;
+};
+
+/**
+ * @brief Measures Cfg, a bf16_exp_csd_log2e_t over the linear datapath Full, on e^x (the only
+ * base with a log2(e) multiplier) against Full's general multiplier.
+ */
+template<typename Cfg, typename Full>
+DseCsdPoint bf16_dse_evaluate_csd(const DseReferences& refs, unsigned num_threads) {
+    std::vector<uint8_t> differs(0x10000);
+    SweepOptions sweep;
+    sweep.num_threads = num_threads;
+    fp_sweep_for_each(0, 0x10000, [&](uint64_t i) {
+        const uint16_t in = static_cast<uint16_t>(i);
+        differs[i] = bf16_exp_approx_with(in, [](const FPRaw& parts) { return bf16_exp_core_approx_native<Base::E, Cfg>(parts); }) !=
+                     bf16_exp_approx_with(in, [](const FPRaw& parts) { return bf16_exp_core_approx_native<Base::E, Full>(parts); });
+    }, sweep);
+    const UlpHistogram expe = bf16_dse_exhaustive<Base::E, Cfg>(Cfg::ROM, refs.has_expe ? &refs.expe : nullptr, num_threads);
+
+    DseCsdPoint p;
+    p.log2e_bits = Cfg::LOG2E_CSD_POS - Cfg::LOG2E_CSD_NEG;
+    p.digits = bf16_csd_encode(p.log2e_bits).digits;
+    p.adders = p.digits - 1;
+    p.mismatches = static_cast<uint64_t>(std::count(differs.begin(), differs.end(), uint8_t(1)));
+    p.expe_max_ulp = expe.max_ulp;
+    p.expe_mean_ulp = expe.sum_ulp / static_cast<double>(std::max<uint64_t>(1, expe.finite));
+    return p;
+}
+
+/**
+ * @brief Searches the constants within radius LSBs of Full's log2(e) that have fewer CSD
+ * digits than it, and returns the best one per digit count, from the most digits down:
+ * bit-identical e^x first, then the lowest worst-case ULP, then the closest constant.
+ */
+template<typename Full>
+std::vector<DseCsdPoint> bf16_dse_csd_search(int radius, const DseReferences& refs, unsigned num_threads) {
+    typedef bf16_dse_log2e_probe<Full> Probe;
+    const int full_digits = bf16_csd_encode(Full::LOG2E_BITS).digits;
+    const uint64_t max_const = uint64_t(1) << Full::LOG2E_W;
+
+    std::vector<DseCsdPoint> best(full_digits);
+    std::vector<bool> found(full_digits, false);
+    auto better = [](const DseCsdPoint& p, const DseCsdPoint& q) {
+        if ((p.mismatches == 0) != (q.mismatches == 0)) return p.mismatches == 0;
+        if (p.expe_max_ulp != q.expe_max_ulp) return p.expe_max_ulp < q.expe_max_ulp;
+        const auto dist = [](uint64_t c) { return c > Full::LOG2E_BITS ? c - Full::LOG2E_BITS : Full::LOG2E_BITS - c; };
+        return dist(p.log2e_bits) < dist(q.log2e_bits);
+    };
+    for (int64_t d = -radius; d <= radius; ++d) {
+        const int64_t c = static_cast<int64_t>(Full::LOG2E_BITS) + d;
+        if (c <= 0 || static_cast<uint64_t>(c) >= max_const) continue;
+        const bf16_csd_t csd = bf16_csd_encode(static_cast<uint64_t>(c));
+        if (csd.digits >= full_digits) continue;
+
+        Probe::LOG2E_CSD_POS = csd.pos;
+        Probe::LOG2E_CSD_NEG = csd.neg;
+        const DseCsdPoint p = bf16_dse_evaluate_csd<Probe, Full>(refs, num_threads);
+        if (!found[p.digits] || better(p, best[p.digits])) best[p.digits] = p;
+        found[p.digits] = true;
+    }
+    Probe::LOG2E_CSD_POS = Full::LOG2E_BITS;
+    Probe::LOG2E_CSD_NEG = 0;
+
+    std::vector<DseCsdPoint> result;
+    for (int k = full_digits - 1; k >= 1; --k) {
+        if (found[k]) result.push_back(best[k]);
+    }
+    return result;
+}
+
+/**
+ * @brief Exhaustive accuracy of one base under a rounding policy.
+ */
+struct DseRoundingStats {
+    UlpHistogram hist;              // Over the negative inputs
+    uint64_t correctly_rounded;     // Outputs equal to the RNE result of the exact value (any NaN for NaN)
+    double mean_signed_ulp;         // Bias: mean of (output - exact) in ULPs of the exact result
+};
+
+/**
+ * @brief Runs every negative BF16 input through the native linear core of Cfg (any rounding
+ * policy) and measures it against the reference tables (or a long double recompute).
+ * Stochastic policies should be swept with num_threads = 1 after seeding their LFSR.
+ */
+template<Base B, typename Cfg>
+DseRoundingStats bf16_dse_rounding_stats(const DseReferences& refs, unsigned num_threads) {
+    constexpr uint32_t FIRST = 0x8000;
+    constexpr uint64_t COUNT = 0x8000;
+    const GoldenFile* reference = B == Base::Two ? (refs.has_exp2 ? &refs.exp2 : nullptr) : (refs.has_expe ? &refs.expe : nullptr);
+
+    std::vector<uint16_t> outputs(COUNT);
+    SweepOptions sweep;
+    sweep.num_threads = num_threads;
+    fp_sweep_for_each(0, COUNT, [&](uint64_t i) {
+        outputs[i] = bf16_exp_approx_with(static_cast<uint16_t>(FIRST + i), [](const FPRaw& parts) {
+            return bf16_exp_core_approx_native<B, Cfg>(parts);
+        });
+    }, sweep);
+
+    DseRoundingStats stats = {};
+    UlpAnalysisOptions opts;
+    opts.num_threads = num_threads;
+    opts.top_k = 0;
+    opts.write_text = false;
+    UlpReport report;
+    if (!reference || !ulp_analyze_reference(outputs.data(), COUNT, FIRST, *reference, report, FPType::BF16, opts)) {
+        reference = nullptr;
+        report = ulp_analyze(outputs.data(), COUNT, FIRST, [](double x) {
+            return static_cast<double>(B == Base::Two ? std::exp2(static_cast<long double>(x)) : std::exp(static_cast<long double>(x)));
+        }, FPType::BF16, opts);
+    }
+    stats.hist = report.total;
+
+    double signed_sum = 0.0;
+    uint64_t finite = 0;
+    for (uint64_t i = 0; i < COUNT; ++i) {
+        const uint32_t input = static_cast<uint32_t>(FIRST + i);
+        uint32_t rounded;
+        double exact;
+        if (reference) {
+            const uint64_t k = input - reference->first_input();
+            rounded = reference->results()[k];
+            exact = fp_reference_value(rounded, reference->values()[k], FPType::BF16);
+        } else {
+            const long double x = fp_to_double(input, FPType::BF16);
+            const long double v = B == Base::Two ? std::exp2(x) : std::exp(x);
+            rounded = fp_round_reference<FPType::BF16>(v).result;
+            exact = static_cast<double>(v);
+        }
+        using F = FPFormat<FPType::BF16>;
+        const bool both_nan = (outputs[i] & F::MAGNITUDE_MASK) > F::INF_BITS && (rounded & F::MAGNITUDE_MASK) > F::INF_BITS;
+        stats.correctly_rounded += outputs[i] == rounded || both_nan;
+        const double out = fp_to_double(outputs[i], FPType::BF16);
+        if (std::isfinite(exact) && std::isfinite(out)) {
+            signed_sum += std::ldexp(out - exact, -fp_ulp_exponent<FPType::BF16>(rounded));
+            finite++;
+        }
+    }
+    stats.mean_signed_ulp = finite ? signed_sum / static_cast<double>(finite) : 0.0;
+    return stats;
+}
+
+/**
+ * @brief True if p is no worse than q in worst-case ULP, mean ULP, ROM bits and
+ * multiplier bits, and better in at least one of them.
+ */
+inline bool bf16_dse_dominates(const DsePoint& p, const DsePoint& q) {
+    const bool no_worse = p.max_ulp() <= q.max_ulp() && p.mean_ulp <= q.mean_ulp &&
+                          p.rom_bits <= q.rom_bits && p.mult_bits() <= q.mult_bits();
+    const bool better = p.max_ulp() < q.max_ulp() || p.mean_ulp < q.mean_ulp ||
+                        p.rom_bits < q.rom_bits || p.mult_bits() < q.mult_bits();
+    return no_worse && better;
+}
+
+/**
+ * @brief Marks the points no other point dominates.
+ */
+inline void bf16_dse_mark_pareto(std::vector<DsePoint>& points) {
+    for (DsePoint& p : points) {
+        p.pareto = std::none_of(points.begin(), points.end(), [&](const DsePoint& q) { return bf16_dse_dominates(q, p); });
+    }
+}
+
+#endif // BF16_DSE_HPP
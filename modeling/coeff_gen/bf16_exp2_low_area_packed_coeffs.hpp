@@ -0,0 +1,99 @@
+#ifndef BF16_EXP2_LOW_AREA_PACKED_COEFFS_HPP
+#define BF16_EXP2_LOW_AREA_PACKED_COEFFS_HPP
+
+#include <cstdint>
+#include "ac_int.h"
+#include "ac_fixed.h"
+
+namespace bf16_exp2_low_area_packed {
+
+constexpr int LUT_SIZE = 32;
+constexpr int COEFF_I = 1;
+constexpr int COEFF_F = 14;
+constexpr int COEFF_W = 15;
+constexpr int PACKED_W = 30;
+
+constexpr int LOG2E_I = 1;
+constexpr int LOG2E_F = 18;
+constexpr int LOG2E_W = 19;
+
+// Log2(e) in 1.18 format
+// Value: 1.44269
+static const ac_int<LOG2E_W, false> log2e_int_val = 0x5c551;
+
+// Packed coefficients: [ b (15 bits) | a (15 bits) ]
+// Format: unsigned 1.14
+static const ac_int<PACKED_W, false> coeffs[LUT_SIZE] = {
+    0x1b381671ULL, // Index 0
+    0x1b7496eeULL, // Index 1
+    0x1bb0976eULL, // Index 2
+    0x1beb97f1ULL, // Index 3
+    0x1c261877ULL, // Index 4
+    0x1c621905ULL, // Index 5
+    0x1c98998bULL, // Index 6
+    0x1cd01a1aULL, // Index 7
+    0x1d071aacULL, // Index 8
+    0x1d3c1b41ULL, // Index 9
+    0x1d731bdfULL, // Index 10
+    0x1da59c78ULL, // Index 11
+    0x1dd79d19ULL, // Index 12
+    0x1e079dbcULL, // Index 13
+    0x1e361e62ULL, // Index 14
+    0x1e741f4fULL, // Index 15
+    0x1e8e9fb9ULL, // Index 16
+    0x1eb8206aULL, // Index 17
+    0x1ed420e9ULL, // Index 18
+    0x1f0521d9ULL, // Index 19
+    0x1f28a295ULL, // Index 20
+    0x1f4aa35aULL, // Index 21
+    0x1f69a421ULL, // Index 22
+    0x1f85a4e9ULL, // Index 23
+    0x1f9f25b8ULL, // Index 24
+    0x1fb6a68bULL, // Index 25
+    0x1fca2762ULL, // Index 26
+    0x1fdc2842ULL, // Index 27
+    0x1fea2920ULL, // Index 28
+    0x1ff4aa07ULL, // Index 29
+    0x1ffcab0eULL, // Index 30
+    0x20002c0cULL // Index 31
+};
+
+// Plain-integer mirror of coeffs[] for native/SIMD simulation kernels
+static const uint64_t coeffs_u64[LUT_SIZE] = {
+    0x1b381671ULL,
+    0x1b7496eeULL,
+    0x1bb0976eULL,
+    0x1beb97f1ULL,
+    0x1c261877ULL,
+    0x1c621905ULL,
+    0x1c98998bULL,
+    0x1cd01a1aULL,
+    0x1d071aacULL,
+    0x1d3c1b41ULL,
+    0x1d731bdfULL,
+    0x1da59c78ULL,
+    0x1dd79d19ULL,
+    0x1e079dbcULL,
+    0x1e361e62ULL,
+    0x1e741f4fULL,
+    0x1e8e9fb9ULL,
+    0x1eb8206aULL,
+    0x1ed420e9ULL,
+    0x1f0521d9ULL,
+    0x1f28a295ULL,
+    0x1f4aa35aULL,
+    0x1f69a421ULL,
+    0x1f85a4e9ULL,
+    0x1f9f25b8ULL,
+    0x1fb6a68bULL,
+    0x1fca2762ULL,
+    0x1fdc2842ULL,
+    0x1fea2920ULL,
+    0x1ff4aa07ULL,
+    0x1ffcab0eULL,
+    0x20002c0cULL
+};
+
+} // namespace bf16_exp2_low_area_packed
+
+#endif // BF16_EXP2_LOW_AREA_PACKED_COEFFS_HPP
@@ -0,0 +1,134 @@
+#ifndef BF16_EXP2_MULTIPARTITE_TABLES_HPP
+#define BF16_EXP2_MULTIPARTITE_TABLES_HPP
+
+#include <cstdint>
+#include "ac_int.h"
+
+namespace bf16_exp2_multipartite {
+
+constexpr int TIV_W = 7;
+constexpr int TO1_PRE_W = 4;
+constexpr int TO1_W = 5;
+constexpr int TO2_PRE_W = 2;
+constexpr int TO2_W = 5;
+constexpr int OUT_F = 17;
+constexpr int ROM_BITS = 8064;
+
+constexpr int LOG2E_I = 1;
+constexpr int LOG2E_F = 22;
+constexpr int LOG2E_W = 23;
+
+// Log2(e) in 1.22 format
+static const ac_int<LOG2E_W, false> log2e_int_val = 0x5c551d;
+
+// Table of initial values, 1.OUT_F, indexed by the TIV field of f
+static const uint32_t tiv[128] = {
+    0x1fffa, 0x1fd36, 0x1fa78, 0x1f7bd, 0x1f506, 0x1f254, 0x1efa5, 0x1ecfa,
+    0x1ea44, 0x1e7a0, 0x1e501, 0x1e262, 0x1dfc9, 0x1dd33, 0x1daa2, 0x1d813,
+    0x1d574, 0x1d2f4, 0x1d06e, 0x1cdf0, 0x1cb71, 0x1c8f9, 0x1c682, 0x1c40f,
+    0x1c192, 0x1bf29, 0x1bcbe, 0x1ba59, 0x1b7f8, 0x1b598, 0x1b33d, 0x1b0e4,
+    0x1ae84, 0x1ac31, 0x1a9e3, 0x1a797, 0x1a54f, 0x1a30a, 0x1a0c8, 0x19e8a,
+    0x19c43, 0x19a0b, 0x197d4, 0x195a2, 0x19372, 0x19147, 0x18f1d, 0x18cf7,
+    0x18ac9, 0x188a8, 0x1868b, 0x18470, 0x18258, 0x18043, 0x17e32, 0x17c23,
+    0x17a0c, 0x17803, 0x175fb, 0x173f8, 0x171f7, 0x16ff9, 0x16dfe, 0x16c05,
+    0x16a03, 0x16811, 0x16620, 0x16432, 0x16246, 0x1605f, 0x15e78, 0x15c94,
+    0x15aab, 0x158c9, 0x156f2, 0x15519, 0x15342, 0x1516e, 0x14f9d, 0x14dce,
+    0x14bf9, 0x14a2f, 0x14868, 0x146a2, 0x144e0, 0x14320, 0x14162, 0x13fa6,
+    0x13de6, 0x13c30, 0x13a79, 0x138c9, 0x1371a, 0x1356e, 0x133c3, 0x1321a,
+    0x1306b, 0x12ec8, 0x12d26, 0x12b87, 0x129e9, 0x1284f, 0x126b6, 0x12520,
+    0x12383, 0x121f1, 0x12061, 0x11ed4, 0x11d48, 0x11bbf, 0x11a37, 0x118b2,
+    0x11727, 0x115a7, 0x11428, 0x112aa, 0x11130, 0x10fb7, 0x10e40, 0x10ccc,
+    0x10b52, 0x109e1, 0x10873, 0x10705, 0x1059b, 0x10432, 0x102cc, 0x10166
+};
+
+// First offsets, indexed by [ prefix | TO1 field ]
+static const uint32_t to1[512] = {
+    0x0, 0x16, 0x27, 0x41, 0x57, 0x6c, 0x82, 0x98,
+    0xae, 0xc3, 0xd9, 0xef, 0x104, 0x11a, 0x130, 0x145,
+    0x15b, 0x170, 0x186, 0x19c, 0x1b1, 0x1c7, 0x1dd, 0x1f2,
+    0x208, 0x21d, 0x237, 0x249, 0x25e, 0x274, 0x28a, 0x29f,
+    0x0, 0x15, 0x2a, 0x3e, 0x53, 0x68, 0x7d, 0x91,
+    0xa6, 0xbb, 0xd0, 0xe4, 0xf9, 0x10e, 0x123, 0x137,
+    0x14c, 0x161, 0x176, 0x18a, 0x19f, 0x1b4, 0x1c8, 0x1dd,
+    0x1f2, 0x207, 0x21b, 0x230, 0x245, 0x259, 0x26e, 0x283,
+    0x0, 0x14, 0x28, 0x3c, 0x50, 0x63, 0x77, 0x8b,
+    0x9f, 0xb3, 0xc7, 0xdb, 0xef, 0x102, 0x116, 0x12a,
+    0x13e, 0x152, 0x166, 0x17a, 0x18d, 0x1a1, 0x1b5, 0x1c9,
+    0x1dd, 0x1f1, 0x204, 0x218, 0x22c, 0x240, 0x254, 0x267,
+    0x0, 0x13, 0x26, 0x39, 0x4c, 0x5f, 0x72, 0x85,
+    0x98, 0xab, 0xbe, 0xd1, 0xe4, 0xf8, 0x10b, 0x11e,
+    0x131, 0x144, 0x157, 0x16a, 0x17d, 0x190, 0x1a3, 0x1b6,
+    0x1c9, 0x1db, 0x1ee, 0x201, 0x214, 0x227, 0x23a, 0x24d,
+    0x0, 0x12, 0x24, 0x37, 0x49, 0x5b, 0x6d, 0x80,
+    0x92, 0xa4, 0xb6, 0xc9, 0xdb, 0xed, 0xff, 0x111,
+    0x124, 0x136, 0x148, 0x15a, 0x16c, 0x17f, 0x191, 0x1a3,
+    0x1b5, 0x1c7, 0x1da, 0x1ec, 0x1fe, 0x210, 0x222, 0x234,
+    0x0, 0x11, 0x23, 0x34, 0x46, 0x57, 0x69, 0x7a,
+    0x8c, 0x9d, 0xaf, 0xc0, 0xd2, 0xe3, 0xf4, 0x106,
+    0x117, 0x129, 0x13a, 0x14c, 0x15d, 0x16e, 0x180, 0x191,
+    0x1a3, 0x1b4, 0x1c5, 0x1d7, 0x1e8, 0x1fa, 0x20b, 0x21c,
+    0x0, 0x11, 0x21, 0x32, 0x43, 0x54, 0x64, 0x75,
+    0x86, 0x97, 0xa7, 0xb8, 0xc9, 0xd9, 0xea, 0xfb,
+    0x10b, 0x11c, 0x12d, 0x13d, 0x14e, 0x15f, 0x170, 0x180,
+    0x191, 0x1a2, 0x1b2, 0x1c3, 0x1d4, 0x1e4, 0x1f5, 0x205,
+    0x0, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70,
+    0x80, 0x90, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0,
+    0x100, 0x110, 0x120, 0x130, 0x140, 0x150, 0x160, 0x170,
+    0x180, 0x190, 0x1a0, 0x1b0, 0x1c0, 0x1d0, 0x1e0, 0x1f0,
+    0x0, 0xf, 0x1f, 0x2e, 0x3d, 0x4d, 0x5c, 0x6b,
+    0x7b, 0x8a, 0x99, 0xa9, 0xb8, 0xc7, 0xd7, 0xe6,
+    0xf5, 0x105, 0x114, 0x123, 0x132, 0x142, 0x151, 0x160,
+    0x170, 0x17f, 0x18e, 0x19d, 0x1ad, 0x1bc, 0x1cb, 0x1db,
+    0x0, 0xf, 0x1d, 0x2c, 0x3b, 0x49, 0x58, 0x67,
+    0x75, 0x84, 0x93, 0xa2, 0xb0, 0xbf, 0xce, 0xdc,
+    0xeb, 0xf9, 0x108, 0x117, 0x125, 0x134, 0x143, 0x151,
+    0x160, 0x16f, 0x17d, 0x18c, 0x19b, 0x1a9, 0x1b8, 0x1c6,
+    0x0, 0xe, 0x1c, 0x2a, 0x38, 0x46, 0x54, 0x62,
+    0x71, 0x7f, 0x8d, 0x9b, 0xa9, 0xb7, 0xc5, 0xd3,
+    0xe1, 0xef, 0xfd, 0x10b, 0x119, 0x127, 0x135, 0x143,
+    0x151, 0x15f, 0x16d, 0x17b, 0x189, 0x197, 0x1a5, 0x1b3,
+    0x0, 0xd, 0x1b, 0x28, 0x36, 0x43, 0x51, 0x5e,
+    0x6c, 0x79, 0x87, 0x94, 0xa2, 0xaf, 0xbc, 0xca,
+    0xd7, 0xe5, 0xf2, 0x100, 0x10d, 0x11b, 0x128, 0x135,
+    0x143, 0x150, 0x15e, 0x16b, 0x178, 0x186, 0x193, 0x1a1,
+    0x0, 0xd, 0x1a, 0x27, 0x34, 0x41, 0x4d, 0x5a,
+    0x67, 0x74, 0x81, 0x8e, 0x9b, 0xa8, 0xb4, 0xc1,
+    0xce, 0xdb, 0xe8, 0xf5, 0x102, 0x10f, 0x11b, 0x128,
+    0x135, 0x142, 0x14f, 0x15c, 0x169, 0x175, 0x182, 0x18f,
+    0x0, 0xc, 0x19, 0x25, 0x31, 0x3e, 0x4a, 0x56,
+    0x63, 0x6f, 0x7b, 0x88, 0x94, 0xa0, 0xad, 0xb9,
+    0xc5, 0xd2, 0xde, 0xea, 0xf7, 0x103, 0x10f, 0x11c,
+    0x128, 0x134, 0x141, 0x14d, 0x159, 0x166, 0x172, 0x17e,
+    0x0, 0xc, 0x18, 0x23, 0x2f, 0x3b, 0x47, 0x53,
+    0x5f, 0x6a, 0x76, 0x82, 0x8e, 0x9a, 0xa5, 0xb1,
+    0xbd, 0xc9, 0xd5, 0xe1, 0xec, 0xf8, 0x104, 0x110,
+    0x11b, 0x127, 0x133, 0x13f, 0x14b, 0x156, 0x162, 0x16e,
+    0x0, 0xb, 0x17, 0x22, 0x2d, 0x39, 0x44, 0x4f,
+    0x5b, 0x66, 0x71, 0x7d, 0x88, 0x93, 0x9e, 0xaa,
+    0xb5, 0xc0, 0xcc, 0xd7, 0xe2, 0xee, 0xf9, 0x104,
+    0x10f, 0x11b, 0x126, 0x131, 0x13d, 0x148, 0x153, 0x15e
+};
+
+// Second offsets, indexed by [ prefix | TO2 field ]
+static const uint32_t to2[128] = {
+    0x0, 0x1, 0x1, 0x2, 0x3, 0x3, 0x4, 0x4,
+    0x5, 0x6, 0x6, 0x7, 0x8, 0x9, 0x9, 0xa,
+    0xa, 0xb, 0xc, 0xc, 0xd, 0xd, 0xe, 0xf,
+    0xf, 0x10, 0x10, 0x11, 0x12, 0x12, 0x13, 0x14,
+    0x0, 0x1, 0x1, 0x2, 0x2, 0x3, 0x3, 0x4,
+    0x4, 0x5, 0x5, 0x6, 0x6, 0x7, 0x7, 0x8,
+    0x9, 0x9, 0xa, 0xa, 0xb, 0xb, 0xc, 0xc,
+    0xd, 0xd, 0xe, 0xe, 0xf, 0xf, 0x10, 0x11,
+    0x0, 0x0, 0x1, 0x1, 0x2, 0x2, 0x3, 0x3,
+    0x4, 0x4, 0x4, 0x5, 0x5, 0x6, 0x6, 0x7,
+    0x7, 0x8, 0x8, 0x9, 0x9, 0x9, 0xa, 0xa,
+    0xb, 0xb, 0xc, 0xc, 0xd, 0xd, 0xd, 0xe,
+    0x0, 0x0, 0x1, 0x1, 0x2, 0x2, 0x2, 0x3,
+    0x3, 0x3, 0x4, 0x4, 0x5, 0x5, 0x5, 0x6,
+    0x6, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8, 0x9,
+    0x9, 0x9, 0xa, 0xa, 0xb, 0xb, 0xb, 0xc
+};
+
+} // namespace bf16_exp2_multipartite
+
+#endif // BF16_EXP2_MULTIPARTITE_TABLES_HPP
@@ -0,0 +1,79 @@
+#ifndef BF16_EXP2_NONUNIFORM_COEFFS_HPP
+#define BF16_EXP2_NONUNIFORM_COEFFS_HPP
+
+#include <cstdint>
+#include "ac_int.h"
+
+namespace bf16_exp2_nonuniform {
+
+constexpr int LUT_ADDR_W = 7;
+constexpr int L1_W = 4;
+constexpr int L1_SIZE = 16;
+constexpr int SEG_COUNT = 26;
+constexpr int COEFF_I = 1;
+constexpr int COEFF_F = 20;
+constexpr int COEFF_W = 21;
+constexpr int PACKED_W = 42;
+
+constexpr int LOG2E_I = 1;
+constexpr int LOG2E_F = 22;
+constexpr int LOG2E_W = 23;
+
+// Log2(e) in 1.22 format
+static const ac_int<LOG2E_W, false> log2e_int_val = 0x5c551d;
+
+// Directory: [ base | depth (2 bits) ], indexed by the top 4 bits of the inverted LUT address;
+// region r is cut into 2^depth segments, coefficient word base + (sub >> (3 - depth))
+static const uint32_t dir[L1_SIZE] = {
+    0x1, // Region 0: base 0, 2 segments, max ulp=0.4925
+    0x8, // Region 1: base 2, 1 segment, max ulp=0.4927
+    0xc, // Region 2: base 3, 1 segment, max ulp=0.4978
+    0x10, // Region 3: base 4, 1 segment, max ulp=0.4946
+    0x14, // Region 4: base 5, 1 segment, max ulp=0.4979
+    0x18, // Region 5: base 6, 1 segment, max ulp=0.4993
+    0x1c, // Region 6: base 7, 1 segment, max ulp=0.4985
+    0x20, // Region 7: base 8, 1 segment, max ulp=0.4903
+    0x25, // Region 8: base 9, 2 segments, max ulp=0.4957
+    0x2d, // Region 9: base 11, 2 segments, max ulp=0.4995
+    0x35, // Region 10: base 13, 2 segments, max ulp=0.5000
+    0x3d, // Region 11: base 15, 2 segments, max ulp=0.4931
+    0x45, // Region 12: base 17, 2 segments, max ulp=0.4992
+    0x4c, // Region 13: base 19, 1 segment, max ulp=0.4984
+    0x51, // Region 14: base 20, 2 segments, max ulp=0.4985
+    0x5a // Region 15: base 22, 4 segments, max ulp=0.5000
+};
+
+// Packed coefficients: [ b (21 bits) | a (21 bits) ]
+// Format: unsigned 1.20
+static const uint64_t coeffs_u64[SEG_COUNT] = {
+    0x1b37d859c02ULL, // Index 0
+    0x1b734e5bab7ULL, // Index 1
+    0x1c033460974ULL, // Index 2
+    0x1c3d5662b45ULL, // Index 3
+    0x1cb4f26746eULL, // Index 4
+    0x1d235e6be66ULL, // Index 5
+    0x1d8d7070b34ULL, // Index 6
+    0x1de6ac752d2ULL, // Index 7
+    0x1e4d467ad45ULL, // Index 8
+    0x1e8e8c7ee25ULL, // Index 9
+    0x1eb7d681a34ULL, // Index 10
+    0x1ed89283f85ULL, // Index 11
+    0x1f054a87619ULL, // Index 12
+    0x1f28b48a556ULL, // Index 13
+    0x1f4a8a8d6a5ULL, // Index 14
+    0x1f68f890763ULL, // Index 15
+    0x1f859c93a63ULL, // Index 16
+    0x1f9f4896e05ULL, // Index 17
+    0x1fb65e9a2a0ULL, // Index 18
+    0x1fd3189f236ULL, // Index 19
+    0x1fe9cca483cULL, // Index 20
+    0x1ff49ca8190ULL, // Index 21
+    0x1ffa50aadb0ULL, // Index 22
+    0x1ffd16acb55ULL, // Index 23
+    0x1ffef6ae978ULL, // Index 24
+    0x200000b148aULL // Index 25
+};
+
+} // namespace bf16_exp2_nonuniform
+
+#endif // BF16_EXP2_NONUNIFORM_COEFFS_HPP
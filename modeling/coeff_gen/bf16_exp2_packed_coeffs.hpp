@@ -1,6 +1,7 @@
 #ifndef BF16_EXP2_PACKED_COEFFS_HPP
 #define BF16_EXP2_PACKED_COEFFS_HPP
 
+#include <cstdint>
 #include "ac_int.h"
 #include "ac_fixed.h"
 
@@ -16,12 +17,12 @@ constexpr int LOG2E_I = 1;
 constexpr int LOG2E_F = 22;
 constexpr int LOG2E_W = 23;
 
-// Log2(e) in 1.25 format
+// Log2(e) in 1.22 format
 // Value: 1.44269
 static const ac_int<LOG2E_W, false> log2e_int_val = 0x5c551d;
 
-// Packed coefficients: [ b (26 bits) | a (26 bits) ]
-// Format: unsigned 1.14
+// Packed coefficients: [ b (21 bits) | a (21 bits) ]
+// Format: unsigned 1.20
 static const ac_int<PACKED_W, false> coeffs[LUT_SIZE] = {
     0x1b22a659157ULL, // Index 0
     0x1b31fa59915ULL, // Index 1
@@ -153,6 +154,138 @@ static const ac_int<PACKED_W, false> coeffs[LUT_SIZE] = {
     0x1ffff2b0c81ULL // Index 127
 };
 
+// Plain-integer mirror of coeffs[] for native/SIMD simulation kernels
+static const uint64_t coeffs_u64[LUT_SIZE] = {
+    0x1b22a659157ULL,
+    0x1b31fa59915ULL,
+    0x1b41445a0ddULL,
+    0x1b50865a8b0ULL,
+    0x1b5fba5b08dULL,
+    0x1b6ee65b876ULL,
+    0x1b7e065c06aULL,
+    0x1b8d1c5c868ULL,
+    0x1b9c265d072ULL,
+    0x1bab265d887ULL,
+    0x1bba185e0a8ULL,
+    0x1bc9005e8d3ULL,
+    0x1bd7dc5f10aULL,
+    0x1be6aa5f94cULL,
+    0x1bf56c6019aULL,
+    0x1c0422609f4ULL,
+    0x1c12ca61258ULL,
+    0x1c216661ac9ULL,
+    0x1c2ff262345ULL,
+    0x1c3e7262bceULL,
+    0x1c4ce463462ULL,
+    0x1c5b4663d02ULL,
+    0x1c699a645aeULL,
+    0x1c77e064e66ULL,
+    0x1c86166572aULL,
+    0x1c943c65ffaULL,
+    0x1ca252668d6ULL,
+    0x1cb058671bfULL,
+    0x1cbe4e67ab5ULL,
+    0x1ccc34683b6ULL,
+    0x1cda0a68cc4ULL,
+    0x1ce7cc695dfULL,
+    0x1cf57e69f07ULL,
+    0x1d031e6a83bULL,
+    0x1d10ae6b17cULL,
+    0x1d1e286bacaULL,
+    0x1d2b926c424ULL,
+    0x1d38e86cd8cULL,
+    0x1d462c6d701ULL,
+    0x1d535a6e083ULL,
+    0x1d60766ea12ULL,
+    0x1d6d7c6f3afULL,
+    0x1d7a706fd59ULL,
+    0x1d874e70710ULL,
+    0x1d9416710d5ULL,
+    0x1da0c871aa7ULL,
+    0x1dad6672487ULL,
+    0x1db9ec72e75ULL,
+    0x1dc65e73870ULL,
+    0x1dd2b67427aULL,
+    0x1ddefa74c91ULL,
+    0x1deb24756b7ULL,
+    0x1df736760eaULL,
+    0x1e033276b2cULL,
+    0x1e0f147757cULL,
+    0x1e1adc77fdaULL,
+    0x1e268c78a47ULL,
+    0x1e3222794c2ULL,
+    0x1e3da079f4cULL,
+    0x1e49007a9e4ULL,
+    0x1e54487b48bULL,
+    0x1e5f747bf41ULL,
+    0x1e6a847ca06ULL,
+    0x1e75787d4daULL,
+    0x1e7ef67de60ULL,
+    0x1e89b67e950ULL,
+    0x1e94587f44fULL,
+    0x1e9edc7ff5eULL,
+    0x1ea94280a7cULL,
+    0x1eb38a815a9ULL,
+    0x1ebdb4820e6ULL,
+    0x1ec7be82c33ULL,
+    0x1ed1aa8378fULL,
+    0x1edb76842fbULL,
+    0x1ee52084e77ULL,
+    0x1eeeaa85a03ULL,
+    0x1ef8128659fULL,
+    0x1f015a8714bULL,
+    0x1f0a8087d07ULL,
+    0x1f1382888d4ULL,
+    0x1f1c62894b1ULL,
+    0x1f251e8a09eULL,
+    0x1f2db68ac9cULL,
+    0x1f362c8b8abULL,
+    0x1f3e7a8c4cbULL,
+    0x1f45a28cf74ULL,
+    0x1f4cac8da2bULL,
+    0x1f54948e679ULL,
+    0x1f5c568f2d8ULL,
+    0x1f63f08ff48ULL,
+    0x1f6b6490bcaULL,
+    0x1f72b09185dULL,
+    0x1f79d292502ULL,
+    0x1f80cc931b8ULL,
+    0x1f879c93e80ULL,
+    0x1f8e4494b59ULL,
+    0x1f952695914ULL,
+    0x1f9b7496612ULL,
+    0x1fa19897323ULL,
+    0x1fa78e98046ULL,
+    0x1fad5a98d7bULL,
+    0x1fb2f699ac2ULL,
+    0x1fb8669a81cULL,
+    0x1fbda89b588ULL,
+    0x1fc2ba9c307ULL,
+    0x1fc79e9d099ULL,
+    0x1fcc089dd63ULL,
+    0x1fd0489ea3dULL,
+    0x1fd4a29f806ULL,
+    0x1fd8c8a05e1ULL,
+    0x1fdcbea13d0ULL,
+    0x1fe082a21d2ULL,
+    0x1fe43aa3090ULL,
+    0x1fe788a3e82ULL,
+    0x1feaaea4cc0ULL,
+    0x1feda0a5b11ULL,
+    0x1ff05ca6976ULL,
+    0x1ff2cea777bULL,
+    0x1ff50ea8593ULL,
+    0x1ff728a9433ULL,
+    0x1ff91eaa37aULL,
+    0x1ffabcab1ecULL,
+    0x1ffc28ac08eULL,
+    0x1ffd5cacf44ULL,
+    0x1ffe62aded1ULL,
+    0x1fff1eaed67ULL,
+    0x1fffa8afce8ULL,
+    0x1ffff2b0c81ULL
+};
+
 } // namespace bf16_exp2_packed
 
 #endif // BF16_EXP2_PACKED_COEFFS_HPP
@@ -0,0 +1,69 @@
+#ifndef BF16_EXP2_QUAD_PACKED_COEFFS_HPP
+#define BF16_EXP2_QUAD_PACKED_COEFFS_HPP
+
+#include <cstdint>
+#include "ac_int.h"
+
+namespace bf16_exp2_quad_packed {
+
+constexpr int LUT_SIZE = 16;
+constexpr int T_W = 14;
+constexpr int C0_F = 16;
+constexpr int C0_W = 17;
+constexpr int C1_F = 16;
+constexpr int C1_W = 12;
+constexpr int C2_F = 12;
+constexpr int C2_W = 3;
+constexpr int PACKED_W = 32;
+
+constexpr int LOG2E_I = 1;
+constexpr int LOG2E_F = 22;
+constexpr int LOG2E_W = 23;
+
+// Log2(e) in 1.22 format
+static const ac_int<LOG2E_W, false> log2e_int_val = 0x5c551d;
+
+// Packed coefficients: [ c0 (17 bits) | c1 (12 bits) | c2 (3 bits) ]
+// p(t) = c0 - t * (c1 - c2 * t), t in [0, 1) the 14 bits below the segment bits
+static const ac_int<PACKED_W, false> coeffs[LUT_SIZE] = {
+    0x42d5ae52ULL, // Index 0
+    0x45cb3062ULL, // Index 1
+    0x48e2328aULL, // Index 2
+    0x4c1c34c2ULL, // Index 3
+    0x4f7ab71aULL, // Index 4
+    0x52ff3983ULL, // Index 5
+    0x56ac3c13ULL, // Index 6
+    0x5a82bebbULL, // Index 7
+    0x5e84418bULL, // Index 8
+    0x62b34463ULL, // Index 9
+    0x6712c76bULL, // Index 10
+    0x6ba2ca93ULL, // Index 11
+    0x7066cdebULL, // Index 12
+    0x7560d14bULL, // Index 13
+    0x7a93551cULL, // Index 14
+    0x800058ccULL // Index 15
+};
+
+// Plain-integer mirror of coeffs[] for native/SIMD simulation kernels
+static const uint64_t coeffs_u64[LUT_SIZE] = {
+    0x42d5ae52ULL,
+    0x45cb3062ULL,
+    0x48e2328aULL,
+    0x4c1c34c2ULL,
+    0x4f7ab71aULL,
+    0x52ff3983ULL,
+    0x56ac3c13ULL,
+    0x5a82bebbULL,
+    0x5e84418bULL,
+    0x62b34463ULL,
+    0x6712c76bULL,
+    0x6ba2ca93ULL,
+    0x7066cdebULL,
+    0x7560d14bULL,
+    0x7a93551cULL,
+    0x800058ccULL
+};
+
+} // namespace bf16_exp2_quad_packed
+
+#endif // BF16_EXP2_QUAD_PACKED_COEFFS_HPP
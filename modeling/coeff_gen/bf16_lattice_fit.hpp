@@ -0,0 +1,341 @@
+#ifndef BF16_LATTICE_FIT_HPP
+#define BF16_LATTICE_FIT_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "fp_utils.hpp"
+#include "fp_sweep.hpp"
+#include "fp_convert.hpp"
+#include "bf16_exp2_core_native.hpp"
+#include "bf16_minimax_fit.hpp"
+
+// =========================================================
+// Quantization-Aware Coefficient Fitting
+// =========================================================
+//
+// The float fitters optimize a and b in double and leave the quantization to the packed
+// header writer, so the error of the real datapath (range reduction, b - a*x in CALC_F,
+// normalization and RNE) is never what gets minimized. This fitter starts from the float
+// minimax line of each segment and searches the integer coefficient lattice around it,
+// scoring every candidate by running bf16_exp_core_approx_native with a candidate ROM on
+// every BF16 input that reaches that segment, for 2^x, e^x or both (they share the ROM).
+//
+// Narrower configurations are scored on the committed datapath: a coefficient with
+// coeff_f < COEFF_F fraction bits is a COEFF_F code with zero low bits, and a LUT with
+// lut_size < LUT_SIZE entries is the full ROM with each entry replicated over the address
+// bits it ignores. Both are bit-identical to the narrower hardware.
+//
+// Everything is templated on the width policy (bf16_exp_cfg_t): the native core, the
+// reduction and the LUT addressing of another configuration are fitted the same way.
+
+/**
+ * @brief Search parameters of the lattice fitter.
+ * * The defaults describe the committed configuration; fits of another policy set
+ * coeff_f and lut_size to (at most) that policy's COEFF_F and LUT_SIZE.
+ */
+struct LatticeFitOptions {
+    int coeff_f = bf16_cfg::COEFF_F;     // Coefficient fraction bits (<= COEFF_F)
+    int lut_size = bf16_cfg::LUT_SIZE;   // LUT entries (power of two, <= LUT_SIZE)
+    int radius = 16;                     // Lattice half-width per coefficient, in coeff_f LSBs
+    bool base2 = true;                   // Score 2^x inputs
+    bool base_e = true;                  // Score e^x inputs
+    unsigned num_threads = 0;            // 0 = all cores; results do not depend on it
+};
+
+/**
+ * @brief One fitted segment of the (possibly reduced) LUT.
+ */
+struct LatticeSegment {
+    int index;              // Segment (address in the lut_size-entry LUT)
+    uint64_t a_code;        // Slope as a Cfg::COEFF_I.COEFF_F code
+    uint64_t b_code;        // Intercept as a Cfg::COEFF_I.COEFF_F code
+    size_t inputs;          // Core inputs that address this segment
+    double max_ulp;         // Worst ULP error over those inputs
+    double sum_ulp;         // Sum of ULP errors over those inputs
+    uint64_t candidates;    // Lattice points scored
+};
+
+/**
+ * @brief Error of a ROM over the core inputs.
+ */
+struct LatticeScore {
+    size_t inputs = 0;
+    double max_ulp = 0.0;
+    double sum_ulp = 0.0;
+
+    double mean_ulp() const { return inputs ? sum_ulp / static_cast<double>(inputs) : 0.0; }
+};
+
+/**
+ * @brief Fitted ROM and its score.
+ */
+struct LatticeFitResult {
+    std::vector<LatticeSegment> segments;
+    std::vector<uint64_t> rom;   // Cfg::LUT_SIZE packed words in the coeffs_u64 layout
+    LatticeScore score;
+    uint64_t rom_bits;           // lut_size * 2 * (COEFF_I + coeff_f)
+};
+
+namespace lattice_detail {
+    /** @brief A BF16 input that reaches the core, with its correctly rounded target. */
+    struct CoreInput {
+        FPRaw parts;
+        bool base2;
+        double ref;          // exp2(x) or e^x in extended precision, rounded to double
+        uint64_t mant_val;   // Reduced fraction (IN_F bits)
+        int32_t exponent_bias;
+        int rom_index;       // Full-LUT address (LUT_MAX_IDX - lut_index)
+    };
+
+    template<typename Cfg>
+    inline uint32_t evaluate(const CoreInput& in, const uint64_t* rom) {
+        FPRaw out = in.base2 ? bf16_exp_core_approx_native<Base::Two, Cfg>(in.parts, rom)
+                             : bf16_exp_core_approx_native<Base::E, Cfg>(in.parts, rom);
+        return fp_recompose(out, FPType::BF16);
+    }
+
+    /**
+     * @brief Scores a segment's inputs with eval (BF16 bits of one CoreInput), stopping as
+     * soon as the candidate cannot beat (best_max, best_sum). Returns true only for a
+     * strictly better candidate. Shared by the fitters of every approximation engine.
+     */
+    template<typename EvalFn>
+    inline bool score_with(const std::vector<const CoreInput*>& inputs, EvalFn eval,
+                           double best_max, double best_sum, double& max_ulp, double& sum_ulp) {
+        max_ulp = 0.0;
+        sum_ulp = 0.0;
+        for (const CoreInput* in : inputs) {
+            const double e = calculate_ulp_error_raw<FPType::BF16>(in->ref, eval(*in));
+            max_ulp = std::max(max_ulp, e);
+            sum_ulp += e;
+            if (max_ulp > best_max || (max_ulp == best_max && sum_ulp >= best_sum)) return false;
+        }
+        return true;
+    }
+
+    /** @brief score_with for the linear core of Cfg with a candidate ROM. */
+    template<typename Cfg>
+    inline bool score(const std::vector<const CoreInput*>& inputs, const uint64_t* rom,
+                      double best_max, double best_sum, double& max_ulp, double& sum_ulp) {
+        return score_with(inputs, [rom](const CoreInput& in) { return evaluate<Cfg>(in, rom); },
+                          best_max, best_sum, max_ulp, sum_ulp);
+    }
+
+    /** @brief All BF16 inputs that go through the core (negative, exponent in [INPUT_MIN_EXP, INPUT_MAX_EXP]). */
+    template<typename Cfg>
+    inline std::vector<CoreInput> core_inputs(bool base2, bool base_e) {
+        std::vector<CoreInput> inputs;
+        for (int pass = 0; pass < 2; ++pass) {
+            const bool is_base2 = (pass == 0);
+            if (is_base2 ? !base2 : !base_e) continue;
+            for (uint32_t raw = 0x8000; raw <= 0xFFFF; ++raw) {
+                CoreInput in;
+                in.parts = fp_decompose(raw, FPType::BF16);
+                const FPStatus& s = in.parts.status;
+                if (s.is_nan || s.is_inf || s.is_zero || s.is_denormal) continue;
+                if (in.parts.exponent < Cfg::INPUT_MIN_EXP || in.parts.exponent > Cfg::INPUT_MAX_EXP) continue;
+
+                const long double x = fp_to_double(raw, FPType::BF16);
+                in.base2 = is_base2;
+                in.ref = static_cast<double>(is_base2 ? std::exp2(x) : std::exp(x));
+                in.exponent_bias = is_base2 ? bf16_exp_reduce_native<Base::Two, Cfg>(in.parts, in.mant_val)
+                                            : bf16_exp_reduce_native<Base::E, Cfg>(in.parts, in.mant_val);
+                const int lut_index = static_cast<int>(in.mant_val >> (Cfg::IN_F - Cfg::LUT_ADDR_W));
+                in.rom_index = Cfg::LUT_MAX_IDX - lut_index;
+                inputs.push_back(in);
+            }
+        }
+        return inputs;
+    }
+
+    template<typename Cfg>
+    inline uint64_t pack(uint64_t a_code, uint64_t b_code) {
+        return (b_code << Cfg::COEFF_W) | a_code;
+    }
+
+    /**
+     * @brief Float minimax lines b - a*m of a segment, used as lattice search centers.
+     * * Both are fitted in the datapath's reduced domain (results scaled back by the exponent
+     * the datapath applies, which also absorbs the log2(e) quantization): one against the
+     * exact results, one against the centers of the rounding intervals of the correctly
+     * rounded results (the narrower half-interval at a power of two).
+     */
+    template<typename Cfg>
+    inline std::vector<std::pair<double, double>> float_starts(const std::vector<const CoreInput*>& inputs) {
+        struct Point { double m, t, t_scale, c, c_scale; };
+        std::vector<Point> pts;
+        pts.reserve(inputs.size());
+        for (const CoreInput* in : inputs) {
+            const double r = bf16_to_double(double_to_bf16_rne(in->ref));
+            const bool binade_start = (r > std::ldexp(1.0, 1 - FPFormat<FPType::BF16>::BIAS)) &&
+                                      (r == std::ldexp(1.0, std::ilogb(r)));
+            const double half = bf16_ulp_at(r) / (binade_start ? 4.0 : 2.0);
+            pts.push_back({std::ldexp(static_cast<double>(in->mant_val), -Cfg::IN_F),
+                           std::ldexp(in->ref, -in->exponent_bias), std::ldexp(bf16_ulp_at(in->ref), -in->exponent_bias),
+                           std::ldexp(r, -in->exponent_bias), std::ldexp(half, -in->exponent_bias)});
+        }
+        // Remez needs strictly increasing abscissas (2^x inputs with equal fractions coincide)
+        std::sort(pts.begin(), pts.end(), [](const Point& p, const Point& q) { return p.m < q.m; });
+        pts.erase(std::unique(pts.begin(), pts.end(), [](const Point& p, const Point& q) { return p.m == q.m; }), pts.end());
+
+        const size_t n = pts.size();
+        std::vector<double> m(n), t(n), t_scale(n), c(n), c_scale(n);
+        for (size_t j = 0; j < n; ++j) {
+            m[j] = pts[j].m;
+            t[j] = pts[j].t;
+            t_scale[j] = pts[j].t_scale;
+            c[j] = pts[j].c;
+            c_scale[j] = pts[j].c_scale;
+        }
+        std::vector<std::pair<double, double>> starts;
+        for (const MinimaxLine& line : {minimax_linear_fit(m.data(), t.data(), t_scale.data(), n),
+                                        minimax_linear_fit(m.data(), c.data(), c_scale.data(), n)}) {
+            starts.push_back({-line.a, line.b});
+        }
+        return starts;
+    }
+}
+
+/**
+ * @brief Scores a ROM (coeffs_u64 layout, Cfg::LUT_SIZE words) with the native datapath over the core inputs.
+ */
+template<typename Cfg = bf16_exp_cfg>
+inline LatticeScore bf16_lattice_evaluate(const uint64_t* rom, bool base2 = true, bool base_e = true) {
+    LatticeScore score;
+    for (const lattice_detail::CoreInput& in : lattice_detail::core_inputs<Cfg>(base2, base_e)) {
+        const double e = calculate_ulp_error_raw<FPType::BF16>(in.ref, lattice_detail::evaluate<Cfg>(in, rom));
+        score.inputs++;
+        score.max_ulp = std::max(score.max_ulp, e);
+        score.sum_ulp += e;
+    }
+    return score;
+}
+
+/**
+ * @brief Fits the coefficient ROM on the integer lattice, segment by segment in parallel.
+ * * Each segment keeps the candidate with the lowest worst-case ULP error, ties broken by
+ * the lower mean. Invalid options (coeff_f or lut_size out of range) return an empty result.
+ */
+template<typename Cfg = bf16_exp_cfg>
+inline LatticeFitResult bf16_lattice_fit(const LatticeFitOptions& opts = LatticeFitOptions()) {
+    using lattice_detail::CoreInput;
+    LatticeFitResult result;
+    result.rom_bits = 0;
+
+    const int addr_w = bf16_cfg::floor_log2(opts.lut_size);
+    if (opts.coeff_f < 0 || opts.coeff_f > Cfg::COEFF_F || opts.lut_size < 1 ||
+        (1 << addr_w) != opts.lut_size || opts.lut_size > Cfg::LUT_SIZE || opts.radius < 0) {
+        return result;
+    }
+    const int drop_addr = Cfg::LUT_ADDR_W - addr_w;        // Address bits the reduced LUT ignores
+    const int drop_frac = Cfg::COEFF_F - opts.coeff_f;     // Coefficient LSBs forced to zero
+    const int64_t max_code = (int64_t(1) << (Cfg::COEFF_I + opts.coeff_f)) - 1;
+
+    const std::vector<CoreInput> inputs = lattice_detail::core_inputs<Cfg>(opts.base2, opts.base_e);
+    std::vector<std::vector<const CoreInput*>> by_segment(opts.lut_size);
+    for (const CoreInput& in : inputs) by_segment[in.rom_index >> drop_addr].push_back(&in);
+
+    result.segments.resize(opts.lut_size);
+    SweepOptions sweep;
+    sweep.num_threads = opts.num_threads;
+    sweep.chunk_size = 1;
+    fp_sweep_for_each(0, static_cast<uint64_t>(opts.lut_size), [&](uint64_t seg) {
+        const std::vector<const CoreInput*>& seg_inputs = by_segment[seg];
+        LatticeSegment& best = result.segments[seg];
+        best = {static_cast<int>(seg), 0, 0, seg_inputs.size(), 0.0, 0.0, 0};
+
+        // Candidate ROM: only this segment's entries are read by its inputs
+        std::vector<uint64_t> rom(Cfg::LUT_SIZE, 0);
+        const int first = static_cast<int>(seg) << drop_addr;
+        const int count = 1 << drop_addr;
+
+        std::vector<std::pair<int64_t, int64_t>> centers;
+        if (seg_inputs.empty()) centers.push_back({0, 0});
+        else {
+            for (const auto& ab : lattice_detail::float_starts<Cfg>(seg_inputs)) {
+                centers.push_back({std::llround(std::ldexp(ab.first, opts.coeff_f)), std::llround(std::ldexp(ab.second, opts.coeff_f))});
+            }
+        }
+
+        double best_max = INFINITY;
+        double best_sum = INFINITY;
+
+        for (size_t c = 0; c < centers.size(); ++c) {
+            const int64_t a0 = centers[c].first;
+            const int64_t b0 = centers[c].second;
+
+            // Rings of growing Chebyshev distance, so good candidates come early and prune the rest
+            for (int r = 0; r <= opts.radius; ++r) {
+                for (int da = -r; da <= r; ++da) {
+                    for (int db = -r; db <= r; ++db) {
+                        if (std::max(std::abs(da), std::abs(db)) != r) continue;
+                        const int64_t a = a0 + da;
+                        const int64_t b = b0 + db;
+                        if (a < 0 || b < 0 || a > max_code || b > max_code) continue;
+
+                        // Already scored in the window of an earlier center
+                        bool seen = false;
+                        for (size_t k = 0; k < c; ++k) {
+                            seen |= std::max(std::llabs(a - centers[k].first), std::llabs(b - centers[k].second)) <= opts.radius;
+                        }
+                        if (seen) continue;
+
+                        const uint64_t a_code = static_cast<uint64_t>(a) << drop_frac;
+                        const uint64_t b_code = static_cast<uint64_t>(b) << drop_frac;
+                        const uint64_t word = lattice_detail::pack<Cfg>(a_code, b_code);
+                        for (int k = 0; k < count; ++k) rom[first + k] = word;
+
+                        best.candidates++;
+                        double max_ulp, sum_ulp;
+                        if (lattice_detail::score<Cfg>(seg_inputs, rom.data(), best_max, best_sum, max_ulp, sum_ulp)) {
+                            best_max = max_ulp;
+                            best_sum = sum_ulp;
+                            best.a_code = a_code;
+                            best.b_code = b_code;
+                        }
+                    }
+                }
+            }
+        }
+        best.max_ulp = seg_inputs.empty() ? 0.0 : best_max;
+        best.sum_ulp = seg_inputs.empty() ? 0.0 : best_sum;
+    }, sweep);
+
+    // Assemble the full ROM (replicated entries) and score it as a whole
+    result.rom.resize(Cfg::LUT_SIZE);
+    for (int i = 0; i < Cfg::LUT_SIZE; ++i) {
+        const LatticeSegment& s = result.segments[i >> drop_addr];
+        result.rom[i] = lattice_detail::pack<Cfg>(s.a_code, s.b_code);
+    }
+    for (const LatticeSegment& s : result.segments) {
+        result.score.inputs += s.inputs;
+        result.score.max_ulp = std::max(result.score.max_ulp, s.max_ulp);
+        result.score.sum_ulp += s.sum_ulp;
+    }
+    result.rom_bits = static_cast<uint64_t>(opts.lut_size) * 2 * (Cfg::COEFF_I + opts.coeff_f);
+    return result;
+}
+
+/**
+ * @brief Minimax ROM of gen_bf16_minimax: the float minimax lines of each segment, accepted
+ * only after scoring the quantized ROM through the native datapath.
+ * * Starts with the two quantized float minimax lines of every segment (lattice radius 0)
+ * and, while some core input is off by more than target_ulp, widens the lattice search
+ * (radius 1, 2, 4, ... up to max_radius). The returned score tells whether the target was
+ * reached; opts.radius is ignored.
+ */
+template<typename Cfg = bf16_exp_cfg>
+inline LatticeFitResult bf16_minimax_rom_fit(LatticeFitOptions opts, int max_radius = 16, double target_ulp = 0.5) {
+    opts.radius = 0;
+    LatticeFitResult fit = bf16_lattice_fit<Cfg>(opts);
+    while (!fit.segments.empty() && fit.score.max_ulp > target_ulp && opts.radius < max_radius) {
+        opts.radius = std::min(max_radius, std::max(1, 2 * opts.radius));
+        fit = bf16_lattice_fit<Cfg>(opts);
+    }
+    return fit;
+}
+
+#endif // BF16_LATTICE_FIT_HPP
@@ -0,0 +1,292 @@
+#ifndef BF16_MINIMAX_FIT_HPP
+#define BF16_MINIMAX_FIT_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "fp_utils.hpp"
+
+// =========================================================
+// Discrete Minimax Fitting
+// =========================================================
+//
+// Weighted Chebyshev approximation by a line or a polynomial on a finite point set
+// (discrete Remez exchange, exact after finitely many exchanges). The coefficient fitters
+// of every engine (bf16_lattice_fit.hpp, bf16_quad_fit.hpp, ...) use these fits in the
+// datapath's reduced domain as starting points, and accept a ROM only after scoring it
+// through the native datapath.
+
+/**
+ * @brief Result of a weighted discrete minimax line fit.
+ */
+struct MinimaxLine {
+    double a;          // Slope
+    double b;          // Intercept
+    double level;      // max_j |a * x_j + b - t_j| / s_j at the solution
+    int iterations;    // Exchange steps taken
+};
+
+namespace minimax_detail {
+    /** @brief Solves a * x_k + b - sigma_k * h * s_k = t_k on a 3-point reference (sigma = +, -, +). */
+    inline bool solve_reference(const double* x, const double* t, const double* s, const size_t r[3],
+                                double& a, double& b, double& h) {
+        // Rows: [x_k, 1, -sigma_k * s_k] . [a, b, h] = t_k
+        double m[3][4];
+        for (int k = 0; k < 3; ++k) {
+            const double sigma = (k == 1) ? -1.0 : 1.0;
+            m[k][0] = x[r[k]];
+            m[k][1] = 1.0;
+            m[k][2] = -sigma * s[r[k]];
+            m[k][3] = t[r[k]];
+        }
+        // Gaussian elimination with partial pivoting
+        for (int c = 0; c < 3; ++c) {
+            int p = c;
+            for (int k = c + 1; k < 3; ++k) {
+                if (std::fabs(m[k][c]) > std::fabs(m[p][c])) p = k;
+            }
+            if (m[p][c] == 0.0) return false;
+            if (p != c) std::swap(m[p], m[c]);
+            for (int k = c + 1; k < 3; ++k) {
+                const double f = m[k][c] / m[c][c];
+                for (int j = c; j < 4; ++j) m[k][j] -= f * m[c][j];
+            }
+        }
+        h = m[2][3] / m[2][2];
+        b = (m[1][3] - m[1][2] * h) / m[1][1];
+        a = (m[0][3] - m[0][2] * h - m[0][1] * b) / m[0][0];
+        return true;
+    }
+}
+
+/**
+ * @brief Weighted minimax line through a discrete point set (Remez exchange).
+ * * Minimizes max_j |a * x_j + b - t_j| / s_j. x must be strictly increasing and s positive.
+ * With fewer than three points the line interpolates them (level 0); a single point
+ * gets slope 0.
+ *
+ * @param x Abscissas (strictly increasing).
+ * @param t Targets.
+ * @param s Error scales (the error at point j is measured in units of s_j).
+ * @param n Number of points.
+ * @param max_iterations Exchange limit (each step strictly increases the level).
+ */
+inline MinimaxLine minimax_linear_fit(const double* x, const double* t, const double* s, size_t n,
+                                      int max_iterations = 200) {
+    MinimaxLine line = {0.0, 0.0, 0.0, 0};
+    if (n == 0) return line;
+    if (n == 1) {
+        line.b = t[0];
+        return line;
+    }
+    if (n == 2) {
+        line.a = (t[1] - t[0]) / (x[1] - x[0]);
+        line.b = t[0] - line.a * x[0];
+        return line;
+    }
+
+    size_t r[3] = {0, n / 2, n - 1};
+    double best_level = -1.0;
+    for (int it = 0; it < max_iterations; ++it) {
+        double a, b, h;
+        if (!minimax_detail::solve_reference(x, t, s, r, a, b, h)) break;
+
+        // Largest weighted error over the whole set
+        size_t worst = 0;
+        double worst_err = 0.0;
+        double level = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            const double e = (a * x[j] + b - t[j]) / s[j];
+            if (std::fabs(e) > level) {
+                level = std::fabs(e);
+                worst = j;
+                worst_err = e;
+            }
+        }
+
+        // Keep the best solution seen; rounding can stall the exchange right at the optimum
+        if (best_level < 0.0 || level < best_level) {
+            line.a = a;
+            line.b = b;
+            line.level = level;
+            line.iterations = it + 1;
+            best_level = level;
+        }
+        if (level <= std::fabs(h) * (1.0 + 1e-12) || worst == r[0] || worst == r[1] || worst == r[2]) break;
+
+        // Single-point exchange that keeps the signs alternating across the reference
+        const bool up = (worst_err > 0.0);
+        auto sign_at = [&](int k) { return ((k == 1) ? -h : h) > 0.0; };
+        if (worst < r[0]) {
+            if (sign_at(0) == up) {
+                r[0] = worst;
+            } else {
+                r[2] = r[1]; r[1] = r[0]; r[0] = worst;
+            }
+        } else if (worst > r[2]) {
+            if (sign_at(2) == up) {
+                r[2] = worst;
+            } else {
+                r[0] = r[1]; r[1] = r[2]; r[2] = worst;
+            }
+        } else if (worst < r[1]) {
+            if (sign_at(0) == up) r[0] = worst; else r[1] = worst;
+        } else {
+            if (sign_at(1) == up) r[1] = worst; else r[2] = worst;
+        }
+    }
+    return line;
+}
+
+/**
+ * @brief Result of a weighted discrete minimax polynomial fit.
+ */
+struct MinimaxPoly {
+    std::vector<double> c;   // c[i] multiplies x^i
+    double level;            // max_j |p(x_j) - t_j| / s_j at the solution
+    int iterations;          // Exchange steps taken
+
+    double operator()(double x) const {
+        double v = 0.0;
+        for (size_t i = c.size(); i-- > 0;) v = v * x + c[i];
+        return v;
+    }
+};
+
+/**
+ * @brief Weighted minimax polynomial of the given degree through a discrete point set.
+ * * The degree-d generalization of minimax_linear_fit: a (d + 2)-point reference with
+ * alternating error signs, solved by Gaussian elimination, and the same single-point
+ * exchange. With at most d + 1 points the polynomial interpolates them (lower degree
+ * when there are fewer points, level 0).
+ *
+ * @param x Abscissas (strictly increasing).
+ * @param t Targets.
+ * @param s Error scales (the error at point j is measured in units of s_j).
+ * @param n Number of points.
+ * @param degree Polynomial degree (>= 0).
+ * @param max_iterations Exchange limit.
+ */
+inline MinimaxPoly minimax_poly_fit(const double* x, const double* t, const double* s, size_t n, int degree,
+                                    int max_iterations = 200) {
+    MinimaxPoly poly;
+    poly.c.assign(static_cast<size_t>(degree) + 1, 0.0);
+    poly.level = 0.0;
+    poly.iterations = 0;
+    if (n == 0) return poly;
+
+    // Solves sum_i c_i x_k^i - sigma_k * h * s_k = t_k (sigma alternating from +) on the
+    // reference r, or plain interpolation (no h column) when interpolate is set
+    auto solve = [&](const std::vector<size_t>& r, bool interpolate, std::vector<double>& c, double& h) {
+        const size_t m = r.size();
+        const size_t terms = interpolate ? m : m - 1;
+        std::vector<std::vector<double>> a(m, std::vector<double>(m + 1, 0.0));
+        for (size_t k = 0; k < m; ++k) {
+            double p = 1.0;
+            for (size_t i = 0; i < terms; ++i, p *= x[r[k]]) a[k][i] = p;
+            if (!interpolate) a[k][m - 1] = -((k % 2) ? -1.0 : 1.0) * s[r[k]];
+            a[k][m] = t[r[k]];
+        }
+        for (size_t col = 0; col < m; ++col) {
+            size_t p = col;
+            for (size_t k = col + 1; k < m; ++k) {
+                if (std::fabs(a[k][col]) > std::fabs(a[p][col])) p = k;
+            }
+            if (a[p][col] == 0.0) return false;
+            if (p != col) std::swap(a[p], a[col]);
+            for (size_t k = col + 1; k < m; ++k) {
+                const double f = a[k][col] / a[col][col];
+                for (size_t j = col; j <= m; ++j) a[k][j] -= f * a[col][j];
+            }
+        }
+        std::vector<double> v(m);
+        for (size_t k = m; k-- > 0;) {
+            double acc = a[k][m];
+            for (size_t j = k + 1; j < m; ++j) acc -= a[k][j] * v[j];
+            v[k] = acc / a[k][k];
+        }
+        c.assign(poly.c.size(), 0.0);
+        for (size_t i = 0; i < terms; ++i) c[i] = v[i];
+        h = interpolate ? 0.0 : v[m - 1];
+        return true;
+    };
+
+    const size_t m = static_cast<size_t>(degree) + 2;
+    if (n < m) {
+        std::vector<size_t> r(n);
+        for (size_t k = 0; k < n; ++k) r[k] = k;
+        double h;
+        solve(r, true, poly.c, h);
+        return poly;
+    }
+
+    // Reference spread evenly over the set
+    std::vector<size_t> r(m);
+    for (size_t k = 0; k < m; ++k) r[k] = k * (n - 1) / (m - 1);
+
+    double best_level = -1.0;
+    std::vector<double> c;
+    for (int it = 0; it < max_iterations; ++it) {
+        double h;
+        if (!solve(r, false, c, h)) break;
+
+        MinimaxPoly cand = {c, 0.0, it + 1};
+        size_t worst = 0;
+        double worst_err = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            const double e = (cand(x[j]) - t[j]) / s[j];
+            if (std::fabs(e) > cand.level) {
+                cand.level = std::fabs(e);
+                worst = j;
+                worst_err = e;
+            }
+        }
+
+        if (best_level < 0.0 || cand.level < best_level) {
+            poly = cand;
+            best_level = cand.level;
+        }
+        if (cand.level <= std::fabs(h) * (1.0 + 1e-12) || std::find(r.begin(), r.end(), worst) != r.end()) break;
+
+        // Single-point exchange that keeps the signs alternating across the reference
+        const bool up = (worst_err > 0.0);
+        auto sign_at = [&](size_t k) { return ((k % 2) ? -h : h) > 0.0; };
+        if (worst < r[0]) {
+            if (sign_at(0) == up) {
+                r[0] = worst;
+            } else {
+                r.pop_back();
+                r.insert(r.begin(), worst);
+            }
+        } else if (worst > r[m - 1]) {
+            if (sign_at(m - 1) == up) {
+                r[m - 1] = worst;
+            } else {
+                r.erase(r.begin());
+                r.push_back(worst);
+            }
+        } else {
+            size_t k = 0;
+            while (r[k + 1] < worst) ++k;
+            if (sign_at(k) == up) r[k] = worst; else r[k + 1] = worst;
+        }
+    }
+    return poly;
+}
+
+// =========================================================
+// BF16 Helpers
+// =========================================================
+
+/**
+ * @brief BF16 ULP size at an exact value (clamped to the minimum normal exponent).
+ */
+inline double bf16_ulp_at(double value) {
+    using F = FPFormat<FPType::BF16>;
+    const int exponent = (value == 0.0) ? 1 - F::BIAS : std::max(std::ilogb(value), 1 - F::BIAS);
+    return std::ldexp(1.0, exponent - static_cast<int>(F::MANT_BITS));
+}
+
+#endif // BF16_MINIMAX_FIT_HPP
@@ -0,0 +1,259 @@
+#ifndef BF16_MULTIPARTITE_FIT_HPP
+#define BF16_MULTIPARTITE_FIT_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "fp_utils.hpp"
+#include "fp_sweep.hpp"
+#include "fp_convert.hpp"
+#include "bf16_exp2_multipartite_core_native.hpp"
+#include "bf16_minimax_fit.hpp"
+#include "bf16_lattice_fit.hpp"
+
+// =========================================================
+// Table Generation of the Multipartite exp Engine
+// =========================================================
+//
+// The offset tables are closed-form: with f = a + y1 + y2 (+ dropped bits) and
+// 2^-f = 2^-a - 2^-a (1 - 2^-y1) - 2^-(a+y1) (1 - 2^-y2), each offset table replaces the
+// 2^-a factor by its value at the center of the prefix interval it can see (the top
+// PRE_W bits of a, plus half the span of the fields above it), and stores the exact drop
+// over its own field. Those tables are rounded to nearest once.
+//
+// The table of initial values then absorbs everything else (the prefix approximation,
+// the rounding of the offsets and the dropped low bits): with the offsets fixed, each TIV
+// entry only affects the core inputs whose TIV field addresses it, so the entries are
+// fitted independently. Each starts at the midrange of the TIV values that would make its
+// inputs exact, and the integer codes around it are scored with
+// bf16_exp_multipartite_core_approx_native on every core input of the entry.
+
+/**
+ * @brief Search parameters of the multipartite table generator.
+ */
+struct MultipartiteFitOptions {
+    int radius = 8;              // TIV code half-width around the midrange start, in OUT_F LSBs
+    int refine_passes = 4;       // Coordinate-descent sweeps over TO1, TO2 and TIV
+    int refine_radius = 4;       // Code half-width of a refinement move
+    bool base2 = true;           // Score 2^x inputs
+    bool base_e = true;          // Score e^x inputs
+    unsigned num_threads = 0;    // 0 = all cores; results do not depend on it
+};
+
+/**
+ * @brief Generated multipartite tables and their score.
+ */
+struct MultipartiteFitResult {
+    std::vector<uint32_t> tiv;   // Cfg::TIV_SIZE entries, 1.OUT_F
+    std::vector<uint32_t> to1;   // Cfg::TO1_SIZE entries, TO1_DW bits at OUT_F
+    std::vector<uint32_t> to2;   // Cfg::TO2_SIZE entries, TO2_DW bits at OUT_F
+    LatticeScore score;
+    uint64_t candidates;         // TIV codes scored
+    uint64_t rom_bits;           // Cfg::ROM_BITS
+
+    bf16_exp_multipartite_tables tables() const {
+        return {tiv.data(), to1.data(), to2.empty() ? nullptr : to2.data()};
+    }
+};
+
+namespace multipartite_detail {
+    using lattice_detail::CoreInput;
+
+    template<typename Cfg>
+    inline uint32_t evaluate(const CoreInput& in, const bf16_exp_multipartite_tables& tables) {
+        FPRaw out = in.base2 ? bf16_exp_multipartite_core_approx_native<Base::Two, Cfg>(in.parts, tables)
+                             : bf16_exp_multipartite_core_approx_native<Base::E, Cfg>(in.parts, tables);
+        return fp_recompose(out, FPType::BF16);
+    }
+
+    /**
+     * @brief Offset table of one field: entry (p, y) = round(2^-c_p * (1 - 2^-y) * 2^OUT_F)
+     * with c_p the center of prefix interval p, moved down by center_shift.
+     */
+    template<typename Cfg>
+    inline std::vector<uint32_t> offset_table(int pre_w, int field_w, int field_lsb, int data_w, double center_shift) {
+        std::vector<uint32_t> table(static_cast<size_t>(1) << (pre_w + field_w));
+        const int64_t max_code = (int64_t(1) << data_w) - 1;
+        for (size_t p = 0; p < (static_cast<size_t>(1) << pre_w); ++p) {
+            const double center = std::ldexp(static_cast<double>(p) + 0.5, -pre_w) + center_shift;
+            for (size_t y = 0; y < (static_cast<size_t>(1) << field_w); ++y) {
+                const double yv = std::ldexp(static_cast<double>(y), field_lsb - Cfg::IN_F);
+                const double drop = std::exp2(-center) * (1.0 - std::exp2(-yv));
+                table[(p << field_w) | y] = static_cast<uint32_t>(
+                    std::min(max_code, static_cast<int64_t>(std::llround(std::ldexp(drop, Cfg::OUT_F)))));
+            }
+        }
+        return table;
+    }
+
+    /** @brief TO1 / TO2 addresses of a reduced fraction: [ prefix | field ]. */
+    template<typename Cfg>
+    inline uint64_t to1_addr(uint64_t mant_val) {
+        using bf16_native::ones;
+        return (((mant_val >> (Cfg::IN_F - Cfg::TO1_PRE_W)) & ones<uint64_t>(Cfg::TO1_PRE_W)) << Cfg::TO1_W) |
+               ((mant_val >> Cfg::TO1_LSB) & ones<uint64_t>(Cfg::TO1_W));
+    }
+
+    template<typename Cfg>
+    inline uint64_t to2_addr(uint64_t mant_val) {
+        using bf16_native::ones;
+        return (((mant_val >> (Cfg::IN_F - Cfg::TO2_PRE_W)) & ones<uint64_t>(Cfg::TO2_PRE_W)) << Cfg::TO2_W) |
+               ((mant_val >> Cfg::TO2_LSB) & ones<uint64_t>(Cfg::TO2_W));
+    }
+
+    /** @brief TO1 + TO2 of a reduced fraction, as raw OUT_F codes. */
+    template<typename Cfg>
+    inline uint64_t offsets(uint64_t mant_val, const std::vector<uint32_t>& to1, const std::vector<uint32_t>& to2) {
+        uint64_t sum = to1[to1_addr<Cfg>(mant_val)];
+        if constexpr (Cfg::TO2_W > 0) sum += to2[to2_addr<Cfg>(mant_val)];
+        return sum;
+    }
+
+    /**
+     * @brief One coordinate-descent sweep over a table: each entry moves to the code within
+     * +-radius that strictly improves (max, sum) ULP error over the inputs that read it.
+     * Every other input is unaffected, so the global worst case never increases.
+     */
+    template<typename EvalFn>
+    inline uint64_t refine_table(std::vector<uint32_t>& table, int64_t max_code, int radius,
+                                 const std::vector<std::vector<const CoreInput*>>& users, EvalFn eval) {
+        uint64_t candidates = 0;
+        for (size_t e = 0; e < table.size(); ++e) {
+            if (users[e].empty()) continue;
+            double best_max, best_sum;
+            lattice_detail::score_with(users[e], eval, INFINITY, INFINITY, best_max, best_sum);
+            const int64_t start = table[e];
+            int64_t best = start;
+            for (int64_t v = std::max<int64_t>(0, start - radius); v <= std::min(max_code, start + radius); ++v) {
+                if (v == start) continue;
+                table[e] = static_cast<uint32_t>(v);
+                candidates++;
+                double max_ulp, sum_ulp;
+                if (lattice_detail::score_with(users[e], eval, best_max, best_sum, max_ulp, sum_ulp)) {
+                    best_max = max_ulp;
+                    best_sum = sum_ulp;
+                    best = v;
+                }
+            }
+            table[e] = static_cast<uint32_t>(best);
+        }
+        return candidates;
+    }
+}
+
+/**
+ * @brief Scores multipartite tables with the native multipartite core over the core inputs.
+ */
+template<typename Cfg>
+inline LatticeScore bf16_multipartite_evaluate(const bf16_exp_multipartite_tables& tables, bool base2 = true, bool base_e = true) {
+    LatticeScore score;
+    for (const lattice_detail::CoreInput& in : lattice_detail::core_inputs<Cfg>(base2, base_e)) {
+        const double e = calculate_ulp_error_raw<FPType::BF16>(in.ref, multipartite_detail::evaluate<Cfg>(in, tables));
+        score.inputs++;
+        score.max_ulp = std::max(score.max_ulp, e);
+        score.sum_ulp += e;
+    }
+    return score;
+}
+
+/**
+ * @brief Generates the TIV / TO1 / TO2 tables of Cfg. The offset tables are closed-form;
+ * each TIV entry keeps the code with the lowest worst-case ULP error over its inputs,
+ * ties broken by the lower mean. A negative radius returns an empty result.
+ */
+template<typename Cfg>
+inline MultipartiteFitResult bf16_multipartite_fit(const MultipartiteFitOptions& opts = MultipartiteFitOptions()) {
+    using lattice_detail::CoreInput;
+    MultipartiteFitResult result;
+    result.candidates = 0;
+    result.rom_bits = 0;
+    if (opts.radius < 0) return result;
+
+    // Offset tables: TO2 sees its prefix plus half the span of the TO1 field
+    result.to1 = multipartite_detail::offset_table<Cfg>(Cfg::TO1_PRE_W, Cfg::TO1_W, Cfg::TO1_LSB, Cfg::TO1_DW, 0.0);
+    if constexpr (Cfg::TO2_W > 0) {
+        result.to2 = multipartite_detail::offset_table<Cfg>(Cfg::TO2_PRE_W, Cfg::TO2_W, Cfg::TO2_LSB, Cfg::TO2_DW,
+                                                            std::ldexp(1.0, -Cfg::TIV_W - 1));
+    }
+
+    const std::vector<CoreInput> inputs = lattice_detail::core_inputs<Cfg>(opts.base2, opts.base_e);
+    std::vector<std::vector<const CoreInput*>> by_entry(Cfg::TIV_SIZE);
+    for (const CoreInput& in : inputs) by_entry[in.mant_val >> Cfg::TIV_LSB].push_back(&in);
+
+    const int64_t max_code = (int64_t(1) << Cfg::TIV_DW) - 1;
+    result.tiv.resize(Cfg::TIV_SIZE);
+    std::vector<uint64_t> entry_candidates(Cfg::TIV_SIZE, 0);
+    SweepOptions sweep;
+    sweep.num_threads = opts.num_threads;
+    sweep.chunk_size = 1;
+    fp_sweep_for_each(0, static_cast<uint64_t>(Cfg::TIV_SIZE), [&](uint64_t a) {
+        const std::vector<const CoreInput*>& entry_inputs = by_entry[a];
+        const double a_val = std::ldexp(static_cast<double>(a), -Cfg::TIV_W);
+        result.tiv[a] = static_cast<uint32_t>(std::min(max_code, static_cast<int64_t>(std::llround(std::ldexp(std::exp2(-a_val), Cfg::OUT_F)))));
+        if (entry_inputs.empty()) return;
+
+        // Midrange of the TIV values that make each input exact (reduced domain)
+        double lo = INFINITY;
+        double hi = -INFINITY;
+        for (const CoreInput* in : entry_inputs) {
+            const double need = std::ldexp(in->ref, -in->exponent_bias) +
+                                std::ldexp(static_cast<double>(multipartite_detail::offsets<Cfg>(in->mant_val, result.to1, result.to2)), -Cfg::OUT_F);
+            lo = std::min(lo, need);
+            hi = std::max(hi, need);
+        }
+        const int64_t center = std::llround(std::ldexp(0.5 * (lo + hi), Cfg::OUT_F));
+
+        std::vector<uint32_t> tiv(Cfg::TIV_SIZE, 0);
+        const bf16_exp_multipartite_tables tables = {tiv.data(), result.to1.data(), result.to2.empty() ? nullptr : result.to2.data()};
+        double best_max = INFINITY;
+        double best_sum = INFINITY;
+        for (int r = 0; r <= opts.radius; ++r) {
+            for (int d = -r; d <= r; d += (r > 0 ? 2 * r : 1)) {
+                const int64_t v = center + d;
+                if (v < 0 || v > max_code) continue;
+
+                tiv[a] = static_cast<uint32_t>(v);
+                entry_candidates[a]++;
+                double max_ulp, sum_ulp;
+                if (lattice_detail::score_with(entry_inputs, [&tables](const CoreInput& in) {
+                        return multipartite_detail::evaluate<Cfg>(in, tables);
+                    }, best_max, best_sum, max_ulp, sum_ulp)) {
+                    best_max = max_ulp;
+                    best_sum = sum_ulp;
+                    result.tiv[a] = static_cast<uint32_t>(v);
+                }
+            }
+        }
+    }, sweep);
+    for (int a = 0; a < Cfg::TIV_SIZE; ++a) result.candidates += entry_candidates[a];
+
+    // Joint refinement: the offsets are shared between TIV entries, so they are moved one
+    // entry at a time against all the inputs that read them
+    std::vector<std::vector<const CoreInput*>> by_to1(Cfg::TO1_SIZE), by_to2(Cfg::TO2_SIZE);
+    for (const CoreInput& in : inputs) {
+        by_to1[multipartite_detail::to1_addr<Cfg>(in.mant_val)].push_back(&in);
+        if constexpr (Cfg::TO2_W > 0) by_to2[multipartite_detail::to2_addr<Cfg>(in.mant_val)].push_back(&in);
+    }
+    const bf16_exp_multipartite_tables tables = result.tables();
+    auto eval = [&tables](const CoreInput& in) { return multipartite_detail::evaluate<Cfg>(in, tables); };
+    for (int pass = 0; pass < opts.refine_passes; ++pass) {
+        result.candidates += multipartite_detail::refine_table(result.to1, (int64_t(1) << Cfg::TO1_DW) - 1, opts.refine_radius, by_to1, eval);
+        if constexpr (Cfg::TO2_W > 0) {
+            result.candidates += multipartite_detail::refine_table(result.to2, (int64_t(1) << Cfg::TO2_DW) - 1, opts.refine_radius, by_to2, eval);
+        }
+        result.candidates += multipartite_detail::refine_table(result.tiv, max_code, opts.refine_radius, by_entry, eval);
+    }
+
+    for (const CoreInput& in : inputs) {
+        const double e = calculate_ulp_error_raw<FPType::BF16>(in.ref, eval(in));
+        result.score.inputs++;
+        result.score.max_ulp = std::max(result.score.max_ulp, e);
+        result.score.sum_ulp += e;
+    }
+    result.rom_bits = Cfg::ROM_BITS;
+    return result;
+}
+
+#endif // BF16_MULTIPARTITE_FIT_HPP
@@ -0,0 +1,133 @@
+#ifndef BF16_NONUNIFORM_FIT_HPP
+#define BF16_NONUNIFORM_FIT_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "fp_utils.hpp"
+#include "fp_convert.hpp"
+#include "bf16_exp2_nonuniform_core_native.hpp"
+#include "bf16_lattice_fit.hpp"
+
+// =========================================================
+// Breakpoint Placement of the Non-Uniform exp LUT
+// =========================================================
+//
+// A region r of the directory cut at depth d is exactly the segments [r << d, (r + 1) << d)
+// of a uniform LUT with 2^(L1_W + d) entries, so the candidate segments of every depth are
+// fitted with the lattice fitter (bf16_lattice_fit, one uniform fit per depth) and the
+// regions never interact: each region independently takes the smallest depth whose worst
+// segment is within target_ulp (the deepest level when none is). This balances the
+// worst-case ULP across regions with the fewest coefficient words for that target.
+
+/**
+ * @brief Search parameters of the non-uniform segmentation.
+ */
+struct NonuniformFitOptions {
+    int l1_w = 4;                // Directory address bits
+    double target_ulp = 0.5;     // Worst-case ULP error each region must reach (0.5 = correctly rounded)
+    int radius = 16;             // Lattice half-width of the per-depth coefficient fits
+    bool base2 = true;           // Score 2^x inputs
+    bool base_e = true;          // Score e^x inputs
+    unsigned num_threads = 0;    // 0 = all cores; results do not depend on it
+};
+
+/**
+ * @brief Segmentation of one directory region.
+ */
+struct NonuniformRegion {
+    int depth;         // log2 of the number of segments
+    int base;          // First coefficient word
+    double max_ulp;    // Worst ULP error over the region's core inputs
+};
+
+/**
+ * @brief Placed breakpoints, directory and coefficient ROM.
+ */
+struct NonuniformFitResult {
+    std::vector<NonuniformRegion> regions;   // 2^l1_w regions
+    std::vector<uint32_t> dir;               // (base << DEPTH_W) | depth, one word per region
+    std::vector<uint64_t> rom;               // Segment words in the coeffs_u64 layout, region by region
+    std::vector<uint64_t> expanded_rom;      // Equivalent uniform ROM (Widths::LUT_SIZE words)
+    LatticeScore score;                      // Over the core inputs, from the per-depth fits
+};
+
+/**
+ * @brief Places the breakpoints of a non-uniform LUT over the fine grid of the uniform
+ * width policy Widths and fits its coefficients. An l1_w outside [1, LUT_ADDR_W - 1] or
+ * a negative radius returns an empty result.
+ *
+ * @tparam Widths Uniform linear width policy (bf16_exp_cfg_t).
+ */
+template<typename Widths>
+inline NonuniformFitResult bf16_nonuniform_fit(const NonuniformFitOptions& opts = NonuniformFitOptions()) {
+    NonuniformFitResult result;
+    if (opts.l1_w < 1 || opts.l1_w >= Widths::LUT_ADDR_W || opts.radius < 0) return result;
+    const int sub_w = Widths::LUT_ADDR_W - opts.l1_w;
+    const int depth_w = bf16_cfg::floor_log2(sub_w) + 1;
+
+    // Candidate segments of every depth: uniform fits with 2^(l1_w + d) entries
+    std::vector<LatticeFitResult> fits;
+    for (int d = 0; d <= sub_w; ++d) {
+        LatticeFitOptions fit_opts;
+        fit_opts.coeff_f = Widths::COEFF_F;
+        fit_opts.lut_size = 1 << (opts.l1_w + d);
+        fit_opts.radius = opts.radius;
+        fit_opts.base2 = opts.base2;
+        fit_opts.base_e = opts.base_e;
+        fit_opts.num_threads = opts.num_threads;
+        fits.push_back(bf16_lattice_fit<Widths>(fit_opts));
+    }
+
+    // Smallest depth per region that meets the target
+    int base = 0;
+    for (int r = 0; r < (1 << opts.l1_w); ++r) {
+        NonuniformRegion region = {0, base, 0.0};
+        for (int d = 0; d <= sub_w; ++d) {
+            region.depth = d;
+            region.max_ulp = 0.0;
+            for (int s = r << d; s < ((r + 1) << d); ++s) region.max_ulp = std::max(region.max_ulp, fits[d].segments[s].max_ulp);
+            if (region.max_ulp <= opts.target_ulp) break;
+        }
+        const LatticeFitResult& fit = fits[region.depth];
+        for (int s = r << region.depth; s < ((r + 1) << region.depth); ++s) {
+            const LatticeSegment& seg = fit.segments[s];
+            result.rom.push_back(lattice_detail::pack<Widths>(seg.a_code, seg.b_code));
+            result.score.inputs += seg.inputs;
+            result.score.max_ulp = std::max(result.score.max_ulp, seg.max_ulp);
+            result.score.sum_ulp += seg.sum_ulp;
+        }
+        result.regions.push_back(region);
+        result.dir.push_back((static_cast<uint32_t>(base) << depth_w) | static_cast<uint32_t>(region.depth));
+        base += 1 << region.depth;
+    }
+
+    // Same words replicated over the fine grid
+    result.expanded_rom.resize(Widths::LUT_SIZE);
+    for (int i = 0; i < Widths::LUT_SIZE; ++i) {
+        const NonuniformRegion& region = result.regions[i >> sub_w];
+        result.expanded_rom[i] = result.rom[region.base + ((i & ((1 << sub_w) - 1)) >> (sub_w - region.depth))];
+    }
+    return result;
+}
+
+/**
+ * @brief Scores a directory and coefficient ROM with the native non-uniform core over the core inputs.
+ */
+template<typename Cfg>
+inline LatticeScore bf16_nonuniform_evaluate(const uint32_t* dir, const uint64_t* rom, bool base2 = true, bool base_e = true) {
+    LatticeScore score;
+    for (const lattice_detail::CoreInput& in : lattice_detail::core_inputs<Cfg>(base2, base_e)) {
+        FPRaw out = in.base2 ? bf16_exp_nonuniform_core_approx_native<Base::Two, Cfg>(in.parts, dir, rom)
+                             : bf16_exp_nonuniform_core_approx_native<Base::E, Cfg>(in.parts, dir, rom);
+        const double e = calculate_ulp_error_raw<FPType::BF16>(in.ref, fp_recompose(out, FPType::BF16));
+        score.inputs++;
+        score.max_ulp = std::max(score.max_ulp, e);
+        score.sum_ulp += e;
+    }
+    return score;
+}
+
+#endif // BF16_NONUNIFORM_FIT_HPP
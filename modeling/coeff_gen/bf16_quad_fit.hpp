@@ -0,0 +1,225 @@
+#ifndef BF16_QUAD_FIT_HPP
+#define BF16_QUAD_FIT_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "fp_utils.hpp"
+#include "fp_sweep.hpp"
+#include "fp_convert.hpp"
+#include "bf16_exp2_quad_core_native.hpp"
+#include "bf16_minimax_fit.hpp"
+#include "bf16_lattice_fit.hpp"
+
+// =========================================================
+// Coefficient Fitting of the Quadratic exp Engine
+// =========================================================
+//
+// Same scheme as the linear lattice fitter (bf16_lattice_fit.hpp), one degree up: each
+// segment gets a float minimax quadratic in the local argument t (the truncated t the
+// datapath actually feeds to its multipliers), against the exact results and against the
+// centers of the rounding intervals. The (c0, c1, c2) lattice around both is then
+// searched in rings of growing Chebyshev distance, with c2 held to a smaller window (its
+// LSB moves the result far less than those of c0 and c1), and every candidate is scored
+// with bf16_exp_quad_core_approx_native on every core input of the segment.
+
+/**
+ * @brief Search parameters of the quadratic fitter.
+ */
+struct QuadFitOptions {
+    int radius = 8;              // Lattice half-width of c0 and c1, in code LSBs
+    int radius_c2 = 2;           // Lattice half-width of c2
+    bool base2 = true;           // Score 2^x inputs
+    bool base_e = true;          // Score e^x inputs
+    unsigned num_threads = 0;    // 0 = all cores; results do not depend on it
+};
+
+/**
+ * @brief One fitted segment of the quadratic ROM.
+ */
+struct QuadSegment {
+    int index;              // ROM address
+    uint64_t c0_code;       // 1.C0_F
+    uint64_t c1_code;       // C1_F fraction bits, C1_W wide
+    uint64_t c2_code;       // C2_F fraction bits, C2_W wide
+    size_t inputs;          // Core inputs that address this segment
+    double max_ulp;         // Worst ULP error over those inputs
+    double sum_ulp;         // Sum of ULP errors over those inputs
+    uint64_t candidates;    // Lattice points scored
+};
+
+/**
+ * @brief Fitted quadratic ROM and its score.
+ */
+struct QuadFitResult {
+    std::vector<QuadSegment> segments;
+    std::vector<uint64_t> rom;   // Cfg::LUT_SIZE words of (c0 << C0_LSB) | (c1 << C1_LSB) | c2
+    LatticeScore score;
+    uint64_t rom_bits;           // LUT_SIZE * PACKED_W
+};
+
+namespace quad_detail {
+    using lattice_detail::CoreInput;
+
+    template<typename Cfg>
+    inline uint32_t evaluate(const CoreInput& in, const uint64_t* rom) {
+        FPRaw out = in.base2 ? bf16_exp_quad_core_approx_native<Base::Two, Cfg>(in.parts, rom)
+                             : bf16_exp_quad_core_approx_native<Base::E, Cfg>(in.parts, rom);
+        return fp_recompose(out, FPType::BF16);
+    }
+
+    template<typename Cfg>
+    inline uint64_t pack(uint64_t c0, uint64_t c1, uint64_t c2) {
+        return (c0 << Cfg::C0_LSB) | (c1 << Cfg::C1_LSB) | c2;
+    }
+
+    /**
+     * @brief Float minimax quadratics c0 - c1*t + c2*t^2 of a segment, as (c0, c1, c2)
+     * search centers: one against the exact results, one against the rounding-interval
+     * centers, both in the reduced domain (see lattice_detail::float_starts).
+     */
+    template<typename Cfg>
+    inline std::vector<std::vector<double>> float_starts(const std::vector<const CoreInput*>& inputs) {
+        struct Point { double t, y, y_scale, c, c_scale; };
+        std::vector<Point> pts;
+        pts.reserve(inputs.size());
+        for (const CoreInput* in : inputs) {
+            const double r = bf16_to_double(double_to_bf16_rne(in->ref));
+            const bool binade_start = (r > std::ldexp(1.0, 1 - FPFormat<FPType::BF16>::BIAS)) &&
+                                      (r == std::ldexp(1.0, std::ilogb(r)));
+            const double half = bf16_ulp_at(r) / (binade_start ? 4.0 : 2.0);
+            const uint64_t t_code = (in->mant_val >> Cfg::T_LSB) & bf16_native::ones<uint64_t>(Cfg::T_W);
+            pts.push_back({std::ldexp(static_cast<double>(t_code), -Cfg::T_W),
+                           std::ldexp(in->ref, -in->exponent_bias), std::ldexp(bf16_ulp_at(in->ref), -in->exponent_bias),
+                           std::ldexp(r, -in->exponent_bias), std::ldexp(half, -in->exponent_bias)});
+        }
+        std::sort(pts.begin(), pts.end(), [](const Point& p, const Point& q) { return p.t < q.t; });
+        pts.erase(std::unique(pts.begin(), pts.end(), [](const Point& p, const Point& q) { return p.t == q.t; }), pts.end());
+
+        const size_t n = pts.size();
+        std::vector<double> t(n), y(n), y_scale(n), c(n), c_scale(n);
+        for (size_t j = 0; j < n; ++j) {
+            t[j] = pts[j].t;
+            y[j] = pts[j].y;
+            y_scale[j] = pts[j].y_scale;
+            c[j] = pts[j].c;
+            c_scale[j] = pts[j].c_scale;
+        }
+        std::vector<std::vector<double>> starts;
+        for (const MinimaxPoly& p : {minimax_poly_fit(t.data(), y.data(), y_scale.data(), n, 2),
+                                     minimax_poly_fit(t.data(), c.data(), c_scale.data(), n, 2)}) {
+            starts.push_back({p.c[0], -p.c[1], p.c[2]});
+        }
+        return starts;
+    }
+}
+
+/**
+ * @brief Scores a quadratic ROM with the native quadratic core over the core inputs.
+ */
+template<typename Cfg>
+inline LatticeScore bf16_quad_evaluate(const uint64_t* rom, bool base2 = true, bool base_e = true) {
+    LatticeScore score;
+    for (const lattice_detail::CoreInput& in : lattice_detail::core_inputs<Cfg>(base2, base_e)) {
+        const double e = calculate_ulp_error_raw<FPType::BF16>(in.ref, quad_detail::evaluate<Cfg>(in, rom));
+        score.inputs++;
+        score.max_ulp = std::max(score.max_ulp, e);
+        score.sum_ulp += e;
+    }
+    return score;
+}
+
+/**
+ * @brief Fits the quadratic coefficient ROM of Cfg on the integer lattice, segment by
+ * segment in parallel. Each segment keeps the candidate with the lowest worst-case ULP
+ * error, ties broken by the lower mean. Negative radii return an empty result.
+ */
+template<typename Cfg>
+inline QuadFitResult bf16_quad_fit(const QuadFitOptions& opts = QuadFitOptions()) {
+    using lattice_detail::CoreInput;
+    QuadFitResult result;
+    result.rom_bits = 0;
+    if (opts.radius < 0 || opts.radius_c2 < 0) return result;
+
+    const int64_t max_code[3] = {(int64_t(1) << Cfg::C0_W) - 1, (int64_t(1) << Cfg::C1_W) - 1, (int64_t(1) << Cfg::C2_W) - 1};
+    const int frac[3] = {Cfg::C0_F, Cfg::C1_F, Cfg::C2_F};
+
+    const std::vector<CoreInput> inputs = lattice_detail::core_inputs<Cfg>(opts.base2, opts.base_e);
+    std::vector<std::vector<const CoreInput*>> by_segment(Cfg::LUT_SIZE);
+    for (const CoreInput& in : inputs) by_segment[in.rom_index].push_back(&in);
+
+    result.segments.resize(Cfg::LUT_SIZE);
+    SweepOptions sweep;
+    sweep.num_threads = opts.num_threads;
+    sweep.chunk_size = 1;
+    fp_sweep_for_each(0, static_cast<uint64_t>(Cfg::LUT_SIZE), [&](uint64_t seg) {
+        const std::vector<const CoreInput*>& seg_inputs = by_segment[seg];
+        QuadSegment& best = result.segments[seg];
+        best = {static_cast<int>(seg), 0, 0, 0, seg_inputs.size(), 0.0, 0.0, 0};
+        if (seg_inputs.empty()) return;
+
+        std::vector<uint64_t> rom(Cfg::LUT_SIZE, 0);
+        std::vector<std::vector<int64_t>> centers;
+        for (const std::vector<double>& c : quad_detail::float_starts<Cfg>(seg_inputs)) {
+            centers.push_back({std::llround(std::ldexp(c[0], frac[0])), std::llround(std::ldexp(c[1], frac[1])),
+                               std::llround(std::ldexp(c[2], frac[2]))});
+        }
+        auto window = [&](size_t k, const int64_t* v) {
+            return std::max(std::llabs(v[0] - centers[k][0]), std::llabs(v[1] - centers[k][1])) <= opts.radius &&
+                   std::llabs(v[2] - centers[k][2]) <= opts.radius_c2;
+        };
+
+        double best_max = INFINITY;
+        double best_sum = INFINITY;
+        for (size_t c = 0; c < centers.size(); ++c) {
+            for (int r = 0; r <= opts.radius; ++r) {
+                const int r2 = std::min(r, opts.radius_c2);
+                for (int d0 = -r; d0 <= r; ++d0) {
+                    for (int d1 = -r; d1 <= r; ++d1) {
+                        for (int d2 = -r2; d2 <= r2; ++d2) {
+                            if (std::max(std::max(std::abs(d0), std::abs(d1)), std::abs(d2)) != r) continue;
+                            const int64_t v[3] = {centers[c][0] + d0, centers[c][1] + d1, centers[c][2] + d2};
+                            bool in_range = true;
+                            for (int k = 0; k < 3; ++k) in_range &= (v[k] >= 0 && v[k] <= max_code[k]);
+                            if (!in_range) continue;
+
+                            // Already scored in the window of an earlier center
+                            bool seen = false;
+                            for (size_t k = 0; k < c; ++k) seen |= window(k, v);
+                            if (seen) continue;
+
+                            rom[seg] = quad_detail::pack<Cfg>(v[0], v[1], v[2]);
+                            best.candidates++;
+                            double max_ulp, sum_ulp;
+                            if (lattice_detail::score_with(seg_inputs, [&rom](const CoreInput& in) {
+                                    return quad_detail::evaluate<Cfg>(in, rom.data());
+                                }, best_max, best_sum, max_ulp, sum_ulp)) {
+                                best_max = max_ulp;
+                                best_sum = sum_ulp;
+                                best.c0_code = static_cast<uint64_t>(v[0]);
+                                best.c1_code = static_cast<uint64_t>(v[1]);
+                                best.c2_code = static_cast<uint64_t>(v[2]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        best.max_ulp = best_max;
+        best.sum_ulp = best_sum;
+    }, sweep);
+
+    result.rom.resize(Cfg::LUT_SIZE);
+    for (const QuadSegment& s : result.segments) {
+        result.rom[s.index] = quad_detail::pack<Cfg>(s.c0_code, s.c1_code, s.c2_code);
+        result.score.inputs += s.inputs;
+        result.score.max_ulp = std::max(result.score.max_ulp, s.max_ulp);
+        result.score.sum_ulp += s.sum_ulp;
+    }
+    result.rom_bits = static_cast<uint64_t>(Cfg::LUT_SIZE) * Cfg::PACKED_W;
+    return result;
+}
+
+#endif // BF16_QUAD_FIT_HPP
@@ -0,0 +1,172 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "bf16_dse.hpp"
+
+/**
+ * @brief Resource and timing report of the linear exp datapath (bf16_cost_model.hpp).
+ * * Prints the structural estimate (multiplier partial products and Dadda levels, adder
+ * widths, shifter stages, priority-encoder depth, ROM bits), the unit-gate area and the
+ * combinational and pipelined delays of the committed datapaths and their truncated,
+ * shift-and-add and rounding variants; the per-operation breakdown and the stage
+ * partitions of the committed datapath; and the width grid of dse_bf16_exp ranked by
+ * area or clock period. Everything is computed at compile time; no input is simulated.
+ *
+ * Usage: dse_bf16_cost [--cuts MASK] [--sort area|delay] [--csv out.csv]
+ */
+
+// Width grid of dse_bf16_exp
+typedef std::integer_sequence<int, 4, 5, 6, 7> LutAddrGrid;
+typedef std::integer_sequence<int, 12, 14, 16, 18, 20> CoeffFracGrid;
+typedef std::integer_sequence<int, 14, 18, 22> Log2eFracGrid;
+
+typedef bf16_exp_high_accuracy HA;
+typedef bf16_exp_low_area LA;
+
+struct CostRow {
+    std::string name;
+    ExpCostEstimate cost;
+};
+
+template<typename Cfg>
+CostRow row(const std::string& name) {
+    return {name, bf16_exp_cost_estimate<Cfg>()};
+}
+
+/** @brief Grid of width policies, in the order of dse_bf16_exp. */
+struct Grid {
+    std::vector<CostRow> rows;
+
+    template<int A, int C, int L>
+    void run() {
+        rows.push_back(row<bf16_exp_cfg_t<A, C, L>>("LUT " + std::to_string(1 << A) + "  1." + std::to_string(C) +
+                                                    "  1." + std::to_string(L)));
+    }
+
+    template<int A, int C, int... L>
+    void over_log2e(std::integer_sequence<int, L...>) { (run<A, C, L>(), ...); }
+
+    template<int A, int... C>
+    void over_coeff(std::integer_sequence<int, C...>) { (over_log2e<A, C>(Log2eFracGrid()), ...); }
+
+    template<int... A>
+    void over_lut(std::integer_sequence<int, A...>) { (over_coeff<A>(CoeffFracGrid()), ...); }
+};
+
+void print_rows(const std::vector<CostRow>& rows, uint32_t cuts) {
+    std::cout << "  " << std::left << std::setw(30) << "datapath" << std::right
+              << "  ROM bits  m*log2e pp/lv   a*x pp/lv  sub_w  shift r/n/r  LZC  logic GE  comb dly  pipe GE  pipe dly\n";
+    for (const CostRow& r : rows) {
+        const ExpCostEstimate& c = r.cost;
+        std::cout << "  " << std::left << std::setw(30) << r.name << std::right << std::setw(10) << c.rom_bits
+                  << std::setw(10) << c.log2e_pp_bits << "/" << std::left << std::setw(3) << c.log2e_levels << std::right
+                  << std::setw(8) << c.mult_pp_bits << "/" << std::left << std::setw(3) << c.mult_levels << std::right
+                  << std::setw(7) << c.sub_w << std::setw(7) << c.reduce_shift_stages << "/" << c.norm_shift_stages << "/"
+                  << std::left << std::setw(2) << c.round_shift_stages << std::right << std::setw(5) << c.lzc_depth
+                  << std::setw(10) << c.logic_area() << std::setw(10) << c.critical_delay(EXP_PIPE_CUTS_NONE)
+                  << std::setw(9) << c.area(cuts) << std::setw(10) << c.critical_delay(cuts) << "\n";
+    }
+}
+
+void print_breakdown(const CostRow& r) {
+    const ExpCostEstimate& c = r.cost;
+    std::cout << "\nPer operation, " << r.name << "\n";
+    std::cout << "  operation    area GE  delay  bits after\n";
+    for (int op = 0; op < EXP_PIPE_OPS; ++op) {
+        std::cout << "  " << std::left << std::setw(11) << exp_pipe_op_name(static_cast<ExpPipeOp>(op)) << std::right
+                  << std::setw(9) << c.op_area[op] << std::setw(7) << c.op_delay[op] << std::setw(12) << c.cut_bits[op] << "\n";
+    }
+
+    std::cout << "\nStage partitions, " << r.name << " (stage delays include " << bf16_cost::REG_DELAY << " for the register)\n";
+    std::cout << "  cuts  stages  reg bits   area GE  period  rel fmax  stage delays\n";
+    for (uint32_t cuts : {EXP_PIPE_CUTS_NONE, EXP_PIPE_CUTS_2, EXP_PIPE_CUTS_3, EXP_PIPE_CUTS_4, EXP_PIPE_CUTS_ALL}) {
+        const int stages = 1 + __builtin_popcount(cuts);
+        std::cout << "  0x" << std::hex << std::setfill('0') << std::setw(2) << cuts << std::dec << std::setfill(' ')
+                  << std::setw(8) << stages << std::setw(10) << c.register_bits(cuts) << std::setw(10) << c.area(cuts)
+                  << std::setw(8) << c.critical_delay(cuts) << std::fixed << std::setprecision(2) << std::setw(10)
+                  << static_cast<double>(c.critical_delay(EXP_PIPE_CUTS_NONE)) / c.critical_delay(cuts) << " ";
+        for (int s = 0; s < stages; ++s) std::cout << " " << c.stage_delay(cuts, s);
+        std::cout << "\n";
+    }
+}
+
+bool write_csv(const std::string& path, const std::vector<CostRow>& rows, uint32_t cuts) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        std::cerr << "Error opening file: " << path << std::endl;
+        return false;
+    }
+    out << "datapath,rom_bits,log2e_pp_bits,log2e_levels,mult_pp_bits,mult_levels,sub_w,reduce_shift_stages,"
+           "norm_shift_stages,round_shift_stages,lzc_depth,logic_ge,comb_delay,cuts,register_bits,area_ge,period\n";
+    for (const CostRow& r : rows) {
+        const ExpCostEstimate& c = r.cost;
+        out << r.name << "," << c.rom_bits << "," << c.log2e_pp_bits << "," << c.log2e_levels << "," << c.mult_pp_bits << ","
+            << c.mult_levels << "," << c.sub_w << "," << c.reduce_shift_stages << "," << c.norm_shift_stages << ","
+            << c.round_shift_stages << "," << c.lzc_depth << "," << c.logic_area() << "," << c.critical_delay(EXP_PIPE_CUTS_NONE)
+            << "," << cuts << "," << c.register_bits(cuts) << "," << c.area(cuts) << "," << c.critical_delay(cuts) << "\n";
+    }
+    return out.good();
+}
+
+int main(int argc, char** argv) {
+    uint32_t cuts = EXP_PIPE_CUTS_4;
+    std::string sort = "area";
+    std::string csv;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--cuts" && i + 1 < argc) {
+            cuts = static_cast<uint32_t>(std::stoul(argv[++i], nullptr, 0)) & EXP_PIPE_CUTS_ALL;
+        } else if (arg == "--sort" && i + 1 < argc) {
+            sort = argv[++i];
+        } else if (arg == "--csv" && i + 1 < argc) {
+            csv = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--cuts MASK] [--sort area|delay] [--csv out.csv]\n";
+            return 1;
+        }
+    }
+    if (sort != "area" && sort != "delay") {
+        std::cerr << "Error: --sort must be area or delay\n";
+        return 1;
+    }
+
+    std::cout << "=== BF16 exp Datapath Resource and Timing Estimate ===\n";
+    std::cout << "Unit-gate model (GE, gate delays); pipelined columns use cuts 0x" << std::hex << cuts << std::dec
+              << " (" << 1 + __builtin_popcount(cuts) << " stages)\n\n";
+
+    std::vector<CostRow> named = {
+        row<HA>("high accuracy"),
+        row<bf16_exp_trunc_mult_t<HA, 25>>("high accuracy, a*x keep 25"),
+        row<bf16_exp_csd_log2e_t<HA, 9, 0x5c551e>>("high accuracy, CSD 9 log2(e)"),
+        row<bf16_exp_rounding_t<HA, bf16_round_rtz>>("high accuracy, RTZ"),
+        row<bf16_exp_rounding_t<HA, bf16_round_stochastic<bf16_lfsr16>>>("high accuracy, stochastic 16"),
+        row<LA>("low area"),
+        row<bf16_exp_trunc_mult_t<LA, 23>>("low area, a*x keep 23"),
+        row<bf16_exp_csd_log2e_t<LA, 8>>("low area, CSD 8 log2(e)"),
+    };
+    std::cout << "Datapaths\n";
+    print_rows(named, cuts);
+    print_breakdown(named[0]);
+
+    Grid grid;
+    grid.over_lut(LutAddrGrid());
+    std::stable_sort(grid.rows.begin(), grid.rows.end(), [&](const CostRow& a, const CostRow& b) {
+        return sort == "area" ? a.cost.area(cuts) < b.cost.area(cuts) : a.cost.critical_delay(cuts) < b.cost.critical_delay(cuts);
+    });
+    std::cout << "\nWidth grid of dse_bf16_exp (" << grid.rows.size() << " policies) by " << (sort == "area" ? "area" : "clock period")
+              << " (accuracy: see dse_bf16_exp)\n";
+    print_rows(grid.rows, cuts);
+
+    if (!csv.empty()) {
+        std::vector<CostRow> all = named;
+        all.insert(all.end(), grid.rows.begin(), grid.rows.end());
+        if (!write_csv(csv, all, cuts)) return 1;
+        std::cout << "\nOutput written to: " << csv << "\n";
+    }
+    return 0;
+}
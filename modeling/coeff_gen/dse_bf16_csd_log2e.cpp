@@ -0,0 +1,149 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <utility>
+#include "bf16_dse.hpp"
+
+/**
+ * @brief Digit search of the shift-and-add log2(e) multiplier of the e^x range reduction.
+ * * For every number of canonical signed digits of the selected datapath's log2(e) constant,
+ * instantiates the native core with the shift-and-add multiplier (bf16_exp_csd_log2e_t),
+ * compares e^x on all 65536 inputs with the general multiplier and checks the ULP error of
+ * every negative input. Then searches the constants within --radius LSBs of log2(e) that
+ * recode to fewer digits (a different constant can still give the same e^x on every BF16
+ * input), and reports the fewest digits that keep e^x bit-identical and the fewest that
+ * stay within the ULP budget (by default: the general multiplier's worst case).
+ *
+ * Usage: dse_bf16_csd_log2e [--datapath high|low] [--ulp-budget U] [--radius R] [--threads T]
+ *                           [--reference-dir dir|none]
+ */
+
+template<typename Datapath>
+struct CsdSweep {
+    static constexpr int MAX_DIGITS = bf16_csd_encode(Datapath::LOG2E_BITS).digits;
+
+    const DseReferences* refs;
+    unsigned num_threads = 0;
+    std::vector<DseCsdPoint> points;    // From every digit down to one
+
+    template<int K>
+    void run() {
+        constexpr int digits = MAX_DIGITS - K;
+        if constexpr (digits >= 1) {
+            points.push_back(bf16_dse_evaluate_csd<bf16_exp_csd_log2e_t<Datapath, digits>, Datapath>(*refs, num_threads));
+        }
+    }
+
+    template<int... K>
+    void over_digits(std::integer_sequence<int, K...>) { (run<K>(), ...); }
+};
+
+void print_table(const std::vector<DseCsdPoint>& points) {
+    std::cout << "  digits  adders     log2(e)  e^x mismatches     max e^x    mean e^x\n";
+    for (const DseCsdPoint& p : points) {
+        std::cout << std::setw(8) << p.digits << std::setw(8) << p.adders << "    0x" << std::hex << std::setw(6)
+                  << std::setfill('0') << p.log2e_bits << std::setfill(' ') << std::dec << std::setw(16) << p.mismatches
+                  << std::fixed << std::setprecision(6) << std::setw(12) << p.expe_max_ulp << std::setw(12) << p.expe_mean_ulp << "\n";
+    }
+}
+
+/** @brief Fewest-digit point satisfying ok (the first one on ties: truncations before searched constants). */
+template<typename Pred>
+int fewest(const std::vector<DseCsdPoint>& points, Pred ok) {
+    int best = -1;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (ok(points[i]) && (best < 0 || points[i].digits < points[best].digits)) best = static_cast<int>(i);
+    }
+    return best;
+}
+
+void print_limit(const char* name, const std::vector<DseCsdPoint>& points, int limit, int mult_bits, int log2e_f) {
+    std::cout << "  " << std::left << std::setw(16) << name << std::right;
+    if (limit < 0) {
+        std::cout << "no digit count qualifies\n";
+        return;
+    }
+    const DseCsdPoint& p = points[limit];
+    std::cout << p.digits << " digits (" << p.adders << " adders instead of a " << mult_bits
+              << "-bit partial-product array), log2(e) = 0x" << std::hex << p.log2e_bits << std::dec << " (1." << log2e_f
+              << "), e^x max " << std::fixed << std::setprecision(6) << p.expe_max_ulp << " ULP\n";
+}
+
+template<typename Datapath>
+int sweep(const DseReferences& refs, unsigned num_threads, double ulp_budget, int radius) {
+    CsdSweep<Datapath> s;
+    s.refs = &refs;
+    s.num_threads = num_threads;
+
+    const bf16_csd_t full = bf16_csd_encode(Datapath::LOG2E_BITS);
+    std::cout << "log2(e): 0x" << std::hex << Datapath::LOG2E_BITS << std::dec << " (1." << Datapath::LOG2E_F << "), "
+              << full.digits << " CSD digits, +0x" << std::hex << full.pos << " -0x" << full.neg << std::dec << "\n";
+
+    auto start = std::chrono::steady_clock::now();
+    s.over_digits(std::make_integer_sequence<int, CsdSweep<Datapath>::MAX_DIGITS>());
+    const std::vector<DseCsdPoint> searched = bf16_dse_csd_search<Datapath>(radius, refs, num_threads);
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (ulp_budget < 0) ulp_budget = s.points[0].expe_max_ulp;
+    std::cout << "ULP budget: " << std::fixed << std::setprecision(6) << ulp_budget << "\n";
+
+    std::cout << "\nTruncated recodings of the constant:\n";
+    print_table(s.points);
+    std::cout << "\nBest constant within " << radius << " LSBs, per digit count:\n";
+    print_table(searched);
+    std::cout << "\n(" << s.points.size() << " truncations, " << 2 * radius + 1 << " constants searched in "
+              << std::setprecision(1) << elapsed_s << " s)\n\n";
+
+    std::vector<DseCsdPoint> all = s.points;
+    all.insert(all.end(), searched.begin(), searched.end());
+    const int mult_bits = Datapath::MANT_SRC_W * Datapath::LOG2E_W;
+    std::cout << "Fewest digits (bf16_exp_csd_log2e_t<Datapath, digits, log2(e)>):\n";
+    print_limit("bit-identical", all, fewest(all, [](const DseCsdPoint& p) { return p.mismatches == 0; }), mult_bits,
+                Datapath::LOG2E_F);
+    print_limit("within budget", all, fewest(all, [ulp_budget](const DseCsdPoint& p) { return p.expe_max_ulp <= ulp_budget; }),
+                mult_bits, Datapath::LOG2E_F);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    std::string datapath = "high";
+    double ulp_budget = -1.0;
+    int radius = 64;
+    unsigned num_threads = 0;
+    std::string reference_dir = "modeling/golden_ref";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--datapath" && i + 1 < argc) {
+            datapath = argv[++i];
+        } else if (arg == "--ulp-budget" && i + 1 < argc) {
+            ulp_budget = std::stod(argv[++i]);
+        } else if (arg == "--radius" && i + 1 < argc) {
+            radius = std::stoi(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            num_threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--reference-dir" && i + 1 < argc) {
+            reference_dir = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--datapath high|low] [--ulp-budget U] [--radius R] [--threads T]"
+                      << " [--reference-dir dir|none]\n";
+            return 1;
+        }
+    }
+    if ((datapath != "high" && datapath != "low") || radius < 0) {
+        std::cerr << "Error: --datapath must be high or low and --radius >= 0\n";
+        return 1;
+    }
+
+    DseReferences refs;
+    if (reference_dir != "none") refs.open(reference_dir);
+
+    std::cout << "=== BF16 e^x Shift-and-Add log2(e) Multiplier Search ===\n";
+    std::cout << "Datapath: " << (datapath == "high" ? "bf16_exp_high_accuracy" : "bf16_exp_low_area") << ", reference: "
+              << (refs.has_expe ? reference_dir + " tables" : std::string("double-precision recompute")) << "\n";
+
+    return datapath == "high" ? sweep<bf16_exp_high_accuracy>(refs, num_threads, ulp_budget, radius)
+                              : sweep<bf16_exp_low_area>(refs, num_threads, ulp_budget, radius);
+}
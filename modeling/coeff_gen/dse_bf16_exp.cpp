@@ -0,0 +1,179 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <utility>
+#include "bf16_dse.hpp"
+#include "packed_coeffs_writer.hpp"
+
+/**
+ * @brief Design-space exploration of the exp datapath widths.
+ * * Instantiates the native core for every (LUT_ADDR_W, COEFF_F, LOG2E_F) of the grid
+ * below, refits each configuration's ROM on the coefficient lattice, checks every
+ * negative BF16 input for 2^x and e^x, and prints the configurations with the Pareto
+ * front (worst-case ULP, mean ULP, ROM bits, multiplier bits) marked.
+ * With all three widths given, --packed-output writes the refitted ROM of that one
+ * configuration as a packed coefficient header in namespace --namespace.
+ *
+ * Usage: dse_bf16_exp [--lut-addr-w W] [--coeff-f F] [--log2e-f F] [--radius R]
+ *                     [--threads T] [--reference-dir dir|none] [--csv out.csv]
+ *                     [--packed-output packed.hpp [--namespace ns]]
+ */
+
+// Swept grid (a configuration is a template instantiation, so the grid is compile time)
+typedef std::integer_sequence<int, 4, 5, 6, 7> LutAddrGrid;
+typedef std::integer_sequence<int, 12, 14, 16, 18, 20> CoeffFracGrid;
+typedef std::integer_sequence<int, 14, 18, 22> Log2eFracGrid;
+
+/** @brief Runtime filter of the grid (-1 = every value). */
+struct GridFilter {
+    int lut_addr_w = -1;
+    int coeff_f = -1;
+    int log2e_f = -1;
+
+    bool selects(int a, int c, int l) const {
+        return (lut_addr_w < 0 || lut_addr_w == a) && (coeff_f < 0 || coeff_f == c) && (log2e_f < 0 || log2e_f == l);
+    }
+};
+
+struct Sweep {
+    GridFilter filter;
+    DseOptions opts;
+    const DseReferences* refs;
+    std::string packed_output;
+    std::string packed_namespace = "bf16_exp2_packed";
+    bool write_failed = false;
+    std::vector<DsePoint> points;
+
+    template<int A, int C, int L>
+    void run() {
+        typedef bf16_exp_cfg_t<A, C, L> Cfg;
+        if (!filter.selects(A, C, L)) return;
+        points.push_back(bf16_dse_evaluate<Cfg>(opts, *refs));
+        const DsePoint& p = points.back();
+        if (!packed_output.empty()) {
+            std::vector<uint64_t> codes_a(Cfg::LUT_SIZE), codes_b(Cfg::LUT_SIZE);
+            for (int i = 0; i < Cfg::LUT_SIZE; ++i) {
+                codes_a[i] = p.rom[i] & bf16_native::ones<uint64_t>(Cfg::COEFF_W);
+                codes_b[i] = p.rom[i] >> Cfg::COEFF_W;
+            }
+            write_failed |= !write_packed_coeff_codes<Cfg::COEFF_I, Cfg::COEFF_F, Cfg::LOG2E_I, Cfg::LOG2E_F>(
+                packed_output, codes_a.data(), codes_b.data(), Cfg::LUT_SIZE, packed_namespace);
+        }
+        std::cout << "  LUT " << std::setw(3) << p.lut_size << "  COEFF 1." << std::setw(2) << std::left << C
+                  << "  LOG2E 1." << std::setw(2) << L << std::right << std::fixed << std::setprecision(6)
+                  << "  max " << p.max_ulp() << "  mean " << p.mean_ulp << std::endl;
+    }
+
+    template<int A, int C, int... L>
+    void over_log2e(std::integer_sequence<int, L...>) { (run<A, C, L>(), ...); }
+
+    template<int A, int... C>
+    void over_coeff(std::integer_sequence<int, C...>) { (over_log2e<A, C>(Log2eFracGrid()), ...); }
+
+    template<int... A>
+    void over_lut(std::integer_sequence<int, A...>) { (over_coeff<A>(CoeffFracGrid()), ...); }
+};
+
+bool write_csv(const std::string& path, const std::vector<DsePoint>& points) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        std::cerr << "Error opening file: " << path << std::endl;
+        return false;
+    }
+    out << "lut_addr_w,lut_size,coeff_f,log2e_f,rom_bits,coeff_w,in_w,mant_src_w,log2e_w,mult_bits,calc_w,"
+           "exp2_max_ulp,expe_max_ulp,mean_ulp,pareto,area_ge,delay\n";
+    out << std::setprecision(9);
+    for (const DsePoint& p : points) {
+        out << p.lut_addr_w << "," << p.lut_size << "," << p.coeff_f << "," << p.log2e_f << "," << p.rom_bits << ","
+            << p.coeff_w << "," << p.in_w << "," << p.mant_src_w << "," << p.log2e_w << "," << p.mult_bits() << ","
+            << p.calc_w << "," << p.exp2_max_ulp << "," << p.expe_max_ulp << "," << p.mean_ulp << ","
+            << (p.pareto ? 1 : 0) << "," << p.area_ge << "," << p.delay << "\n";
+    }
+    return out.good();
+}
+
+int main(int argc, char** argv) {
+    Sweep sweep;
+    std::string reference_dir = "modeling/golden_ref";
+    std::string csv;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--lut-addr-w" && i + 1 < argc) {
+            sweep.filter.lut_addr_w = std::stoi(argv[++i]);
+        } else if (arg == "--coeff-f" && i + 1 < argc) {
+            sweep.filter.coeff_f = std::stoi(argv[++i]);
+        } else if (arg == "--log2e-f" && i + 1 < argc) {
+            sweep.filter.log2e_f = std::stoi(argv[++i]);
+        } else if (arg == "--radius" && i + 1 < argc) {
+            sweep.opts.radius = std::stoi(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            sweep.opts.num_threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--reference-dir" && i + 1 < argc) {
+            reference_dir = argv[++i];
+        } else if (arg == "--csv" && i + 1 < argc) {
+            csv = argv[++i];
+        } else if (arg == "--packed-output" && i + 1 < argc) {
+            sweep.packed_output = argv[++i];
+        } else if (arg == "--namespace" && i + 1 < argc) {
+            sweep.packed_namespace = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--lut-addr-w W] [--coeff-f F] [--log2e-f F] [--radius R]"
+                      << " [--threads T] [--reference-dir dir|none] [--csv out.csv]"
+                      << " [--packed-output packed.hpp [--namespace ns]]\n";
+            return 1;
+        }
+    }
+    if (sweep.opts.radius < 0) {
+        std::cerr << "Error: radius must be >= 0\n";
+        return 1;
+    }
+    if (!sweep.packed_output.empty() &&
+        (sweep.filter.lut_addr_w < 0 || sweep.filter.coeff_f < 0 || sweep.filter.log2e_f < 0)) {
+        std::cerr << "Error: --packed-output needs --lut-addr-w, --coeff-f and --log2e-f\n";
+        return 1;
+    }
+
+    DseReferences refs;
+    if (reference_dir != "none") refs.open(reference_dir);
+    sweep.refs = &refs;
+
+    std::cout << "=== BF16 exp Datapath Design-Space Exploration ===\n";
+    std::cout << "Reference: " << (refs.has_exp2 && refs.has_expe ? reference_dir + " tables" : std::string("double-precision recompute"))
+              << ", lattice radius: " << sweep.opts.radius << "\n\n";
+
+    auto start = std::chrono::steady_clock::now();
+    sweep.over_lut(LutAddrGrid());
+    double sweep_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (sweep.points.empty()) {
+        std::cerr << "Error: the filter selects no configuration of the grid\n";
+        return 1;
+    }
+    bf16_dse_mark_pareto(sweep.points);
+
+    std::cout << "\n" << sweep.points.size() << " configurations in " << std::setprecision(1) << sweep_s << " s\n\n";
+    std::cout << "  LUT  COEFF  LOG2E  ROM bits  a*x mult  m*log2e  CALC_W   area GE  delay   max 2^x   max e^x  mean ULP  Pareto\n";
+    for (const DsePoint& p : sweep.points) {
+        std::cout << std::setw(5) << p.lut_size << std::setw(7) << p.coeff_f << std::setw(7) << p.log2e_f
+                  << std::setw(10) << p.rom_bits
+                  << std::setw(6) << p.coeff_w << "x" << std::left << std::setw(3) << p.in_w << std::right
+                  << std::setw(6) << p.mant_src_w << "x" << std::left << std::setw(3) << p.log2e_w << std::right
+                  << std::setw(7) << p.calc_w << std::setw(10) << p.area_ge << std::setw(7) << p.delay << std::setprecision(6)
+                  << std::setw(10) << p.exp2_max_ulp << std::setw(10) << p.expe_max_ulp << std::setw(10) << p.mean_ulp
+                  << (p.pareto ? "       *" : "") << "\n";
+    }
+
+    if (!sweep.packed_output.empty()) {
+        if (sweep.write_failed) return 1;
+        std::cout << "\nOutput written to: " << sweep.packed_output << "\n";
+    }
+    if (!csv.empty()) {
+        if (!write_csv(csv, sweep.points)) return 1;
+        std::cout << "\nOutput written to: " << csv << "\n";
+    }
+    return 0;
+}
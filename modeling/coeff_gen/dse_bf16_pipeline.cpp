@@ -0,0 +1,143 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "bf16_exp2_pipeline.hpp"
+
+/**
+ * @brief Throughput report of the pipelined exp unit for several stage partitions.
+ * * Streams the BF16 inputs through the cycle-accurate model (bf16_exp2_pipeline.hpp) of
+ * each partition, with a source that presents an input and a sink that takes a result
+ * with the given per-cycle probabilities, and prints stages, latency, design and
+ * achieved II, throughput, register occupancy and stall cycles. Every output is checked
+ * against bf16_exp_approx.
+ *
+ * Usage: dse_bf16_pipeline [--datapath high|low] [--base 2|e] [--cuts MASK] [--mult-cycles N]
+ *                          [--valid P] [--ready P] [--seed S]
+ */
+
+struct PipelineRow {
+    uint32_t cuts;
+    std::string layout;     // Operations per stage
+    int stages;
+    int latency;            // Without stalls
+    int ii;                 // Without stalls
+    ExpPipeStats stats;
+    int mismatches;         // Against bf16_exp_approx
+};
+
+/** @brief Short operation names per stage, e.g. "dec red | lut mul | ...". */
+template<Base B, typename Cfg>
+std::string layout_of(const Bf16ExpPipeline<B, Cfg>& pipe) {
+    static const char* abbrev[EXP_PIPE_OPS] = {"dec", "red", "lut", "mul", "add", "nrm", "rnd", "rec"};
+    std::string s;
+    for (int st = 0; st < pipe.stages(); ++st) {
+        if (st) s += " | ";
+        for (int op = pipe.first_op(st); op < pipe.first_op(st + 1); ++op) s += std::string(op == pipe.first_op(st) ? "" : " ") + abbrev[op];
+    }
+    return s;
+}
+
+template<Base B, typename Cfg>
+PipelineRow measure(uint32_t cuts, int mult_cycles, double valid_p, double ready_p, uint64_t seed) {
+    ExpPipeOptions opts;
+    opts.cuts = cuts;
+    opts.op_cycles[static_cast<int>(ExpPipeOp::Multiply)] = mult_cycles;
+    const Bf16ExpPipeline<B, Cfg> pipe(opts);
+
+    std::vector<uint16_t> in(0x10000), out(0x10000, 0);
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) in[raw] = static_cast<uint16_t>(raw);
+
+    std::mt19937_64 rng(seed);
+    std::bernoulli_distribution valid(valid_p), ready(ready_p);
+    PipelineRow row;
+    row.cuts = cuts;
+    row.layout = layout_of(pipe);
+    row.stages = pipe.stages();
+    row.latency = pipe.latency();
+    row.ii = pipe.initiation_interval();
+    row.stats = bf16_exp_pipeline_stream<B, Cfg>(in.data(), in.size(), out.data(), opts,
+                                                 [&](uint64_t) { return valid(rng); }, [&](uint64_t) { return ready(rng); });
+    row.mismatches = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) row.mismatches += out[raw] != bf16_exp_approx<B, Cfg>(in[raw]);
+    return row;
+}
+
+template<Base B, typename Cfg>
+int report(const std::vector<uint32_t>& partitions, int mult_cycles, double valid_p, double ready_p, uint64_t seed) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<PipelineRow> rows;
+    for (uint32_t cuts : partitions) rows.push_back(measure<B, Cfg>(cuts, mult_cycles, valid_p, ready_p, seed));
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    int mismatches = 0;
+    std::cout << "\n cuts  stages  lat  II   meas II  results/cyc  occupancy  in stalls  out stalls    cycles  mismatches  layout\n";
+    for (const PipelineRow& r : rows) {
+        const ExpPipeStats& s = r.stats;
+        std::cout << "  0x" << std::hex << std::setfill('0') << std::setw(2) << r.cuts << std::dec << std::setfill(' ')
+                  << std::setw(7) << r.stages << std::setw(5) << r.latency << std::setw(4) << r.ii
+                  << std::fixed << std::setprecision(3) << std::setw(10) << s.measured_ii() << std::setw(13) << s.throughput()
+                  << std::setw(11) << s.occupancy() << std::setw(11) << s.input_stalls << std::setw(12) << s.output_stalls
+                  << std::setw(10) << s.cycles << std::setw(12) << r.mismatches << "  " << r.layout << "\n";
+        mismatches += r.mismatches;
+    }
+    std::cout << "\n(" << rows.size() << " partitions x " << rows[0].stats.emitted << " inputs in " << std::setprecision(1)
+              << elapsed_s << " s; " << (mismatches ? "OUTPUTS DIFFER from bf16_exp_approx" : "all outputs == bf16_exp_approx") << ")\n";
+    return mismatches ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    std::string datapath = "high";
+    bool base2 = true;
+    std::vector<uint32_t> partitions = {EXP_PIPE_CUTS_NONE, EXP_PIPE_CUTS_2, EXP_PIPE_CUTS_3, EXP_PIPE_CUTS_4, EXP_PIPE_CUTS_ALL};
+    int mult_cycles = 1;
+    double valid_p = 1.0;
+    double ready_p = 1.0;
+    uint64_t seed = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--datapath" && i + 1 < argc) {
+            datapath = argv[++i];
+        } else if (arg == "--base" && i + 1 < argc) {
+            std::string b = argv[++i];
+            base2 = (b == "2");
+        } else if (arg == "--cuts" && i + 1 < argc) {
+            partitions.push_back(static_cast<uint32_t>(std::stoul(argv[++i], nullptr, 0)) & EXP_PIPE_CUTS_ALL);
+        } else if (arg == "--mult-cycles" && i + 1 < argc) {
+            mult_cycles = std::stoi(argv[++i]);
+        } else if (arg == "--valid" && i + 1 < argc) {
+            valid_p = std::stod(argv[++i]);
+        } else if (arg == "--ready" && i + 1 < argc) {
+            ready_p = std::stod(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = std::stoull(argv[++i], nullptr, 0);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--datapath high|low] [--base 2|e] [--cuts MASK] [--mult-cycles N]"
+                      << " [--valid P] [--ready P] [--seed S]\n";
+            return 1;
+        }
+    }
+    if ((datapath != "high" && datapath != "low") || mult_cycles < 1 || valid_p <= 0.0 || valid_p > 1.0 ||
+        ready_p <= 0.0 || ready_p > 1.0) {
+        std::cerr << "Error: --datapath must be high or low, --mult-cycles >= 1, --valid and --ready in (0, 1]\n";
+        return 1;
+    }
+
+    std::cout << "=== BF16 exp Pipelined Unit Report ===\n";
+    std::cout << "Datapath: " << (datapath == "high" ? "bf16_exp_high_accuracy" : "bf16_exp_low_area") << ", base: "
+              << (base2 ? "2" : "e") << ", multiplier: " << mult_cycles << " cycle(s)/result, source valid "
+              << valid_p << ", sink ready " << ready_p << "\n";
+    std::cout << "(cuts: bit i = register after operation i, operations: ";
+    for (int op = 0; op < EXP_PIPE_OPS; ++op) std::cout << (op ? ", " : "") << exp_pipe_op_name(static_cast<ExpPipeOp>(op));
+    std::cout << ")\n";
+
+    if (datapath == "high") {
+        return base2 ? report<Base::Two, bf16_exp_high_accuracy>(partitions, mult_cycles, valid_p, ready_p, seed)
+                     : report<Base::E, bf16_exp_high_accuracy>(partitions, mult_cycles, valid_p, ready_p, seed);
+    }
+    return base2 ? report<Base::Two, bf16_exp_low_area>(partitions, mult_cycles, valid_p, ready_p, seed)
+                 : report<Base::E, bf16_exp_low_area>(partitions, mult_cycles, valid_p, ready_p, seed);
+}
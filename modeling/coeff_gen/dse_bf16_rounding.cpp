@@ -0,0 +1,113 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "bf16_dse.hpp"
+
+/**
+ * @brief Exhaustive accuracy report of the rounding policies of the exp back end.
+ * * Runs every negative BF16 input through the native core of the selected datapath with
+ * each rounding policy (bf16_exp_rounding_t): RNE, round toward zero, round half away and
+ * stochastic rounding from two LFSRs, and prints per base the worst-case and mean ULP, the
+ * share of correctly rounded outputs, the mean signed error (bias) and the ULP histogram.
+ * Stochastic policies are swept on one thread from the LFSR seed, so reports repeat.
+ *
+ * Usage: dse_bf16_rounding [--datapath high|low] [--seed S] [--threads T] [--reference-dir dir|none]
+ */
+
+struct RoundingRow {
+    std::string name;
+    DseRoundingStats exp2;
+    DseRoundingStats expe;
+};
+
+template<typename Datapath, typename Rounding>
+RoundingRow measure(const char* name, const DseReferences& refs, unsigned num_threads, uint64_t seed) {
+    typedef bf16_exp_rounding_t<Datapath, Rounding> Cfg;
+    RoundingRow row;
+    row.name = name;
+    if constexpr (Rounding::MODE == RoundMode::Stochastic) {
+        Rounding::Source::seed(seed);
+        row.exp2 = bf16_dse_rounding_stats<Base::Two, Cfg>(refs, 1);
+        Rounding::Source::seed(seed);
+        row.expe = bf16_dse_rounding_stats<Base::E, Cfg>(refs, 1);
+    } else {
+        row.exp2 = bf16_dse_rounding_stats<Base::Two, Cfg>(refs, num_threads);
+        row.expe = bf16_dse_rounding_stats<Base::E, Cfg>(refs, num_threads);
+    }
+    return row;
+}
+
+void print_rows(const std::vector<RoundingRow>& rows, bool base2) {
+    std::cout << (base2 ? "2^x" : "e^x") << " (" << rows[0].exp2.hist.count << " negative inputs)\n";
+    std::cout << "  policy                   max ULP  mean ULP  correct %   bias ULP";
+    for (int b = 0; b < UlpHistogram::NONFINITE_BIN; ++b) std::cout << std::setw(8) << UlpHistogram::label(b);
+    std::cout << "\n";
+    for (const RoundingRow& r : rows) {
+        const DseRoundingStats& s = base2 ? r.exp2 : r.expe;
+        std::cout << "  " << std::left << std::setw(22) << r.name << std::right << std::fixed << std::setprecision(6)
+                  << std::setw(10) << s.hist.max_ulp << std::setw(10) << s.hist.mean_ulp()
+                  << std::setprecision(2) << std::setw(11) << 100.0 * static_cast<double>(s.correctly_rounded) / s.hist.count
+                  << std::setprecision(5) << std::setw(11) << s.mean_signed_ulp;
+        for (int b = 0; b < UlpHistogram::NONFINITE_BIN; ++b) std::cout << std::setw(8) << s.hist.bins[b];
+        std::cout << "\n";
+    }
+    std::cout << "\n";
+}
+
+template<typename Datapath>
+int report(const DseReferences& refs, unsigned num_threads, uint64_t seed) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<RoundingRow> rows;
+    rows.push_back(measure<Datapath, bf16_round_rne>("nearest even (RNE)", refs, num_threads, seed));
+    rows.push_back(measure<Datapath, bf16_round_rtz>("toward zero (RTZ)", refs, num_threads, seed));
+    rows.push_back(measure<Datapath, bf16_round_half_away>("half away", refs, num_threads, seed));
+    rows.push_back(measure<Datapath, bf16_round_stochastic<bf16_lfsr16>>("stochastic LFSR16/16", refs, num_threads, seed));
+    rows.push_back(measure<Datapath, bf16_round_stochastic<bf16_lfsr32, 8>>("stochastic LFSR32/8", refs, num_threads, seed));
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "\n";
+    print_rows(rows, true);
+    print_rows(rows, false);
+    std::cout << "(" << rows.size() << " policies in " << std::setprecision(1) << elapsed_s << " s)\n";
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    std::string datapath = "high";
+    uint64_t seed = 0;
+    unsigned num_threads = 0;
+    std::string reference_dir = "modeling/golden_ref";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--datapath" && i + 1 < argc) {
+            datapath = argv[++i];
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = std::stoull(argv[++i], nullptr, 0);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            num_threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--reference-dir" && i + 1 < argc) {
+            reference_dir = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--datapath high|low] [--seed S] [--threads T] [--reference-dir dir|none]\n";
+            return 1;
+        }
+    }
+    if (datapath != "high" && datapath != "low") {
+        std::cerr << "Error: --datapath must be high or low\n";
+        return 1;
+    }
+
+    DseReferences refs;
+    if (reference_dir != "none") refs.open(reference_dir);
+
+    std::cout << "=== BF16 exp Rounding Policy Report ===\n";
+    std::cout << "Datapath: " << (datapath == "high" ? "bf16_exp_high_accuracy" : "bf16_exp_low_area") << ", reference: "
+              << (refs.has_exp2 && refs.has_expe ? reference_dir + " tables" : std::string("long double recompute"))
+              << ", LFSR seed: " << (seed ? std::to_string(seed) : std::string("reset state")) << "\n";
+
+    return datapath == "high" ? report<bf16_exp_high_accuracy>(refs, num_threads, seed)
+                              : report<bf16_exp_low_area>(refs, num_threads, seed);
+}
@@ -0,0 +1,150 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <utility>
+#include "bf16_dse.hpp"
+
+/**
+ * @brief Truncation sweep of the a * x multiplier of the linear exp datapaths.
+ * * For every number of dropped product columns of the grid below, instantiates the
+ * native core of the selected datapath with a truncated multiplier (bf16_exp_trunc_mult_t),
+ * once with the expected-value correction and once without, checks every negative BF16
+ * input for 2^x and e^x, and reports the fewest kept columns whose worst-case ULP stays
+ * within the target (by default: the worst case of the full multiplier).
+ *
+ * Usage: dse_bf16_trunc_mult [--datapath high|low] [--target-ulp U] [--threads T]
+ *                            [--reference-dir dir|none] [--csv out.csv]
+ */
+
+// Swept number of dropped columns (a truncation is a template instantiation)
+typedef std::make_integer_sequence<int, 40> TruncGrid;
+
+template<typename Datapath>
+struct TruncSweep {
+    const DseReferences* refs;
+    unsigned num_threads = 0;
+    std::vector<DseTruncPoint> corrected;    // Expected-value correction
+    std::vector<DseTruncPoint> plain;        // No correction
+
+    template<int T>
+    void run() {
+        if constexpr (T < Datapath::MULT_W) {
+            corrected.push_back(bf16_dse_evaluate_trunc<bf16_exp_trunc_mult_t<Datapath, Datapath::MULT_W - T>>(*refs, num_threads));
+            plain.push_back(bf16_dse_evaluate_trunc<bf16_exp_trunc_mult_t<Datapath, Datapath::MULT_W - T, 0>>(*refs, num_threads));
+        }
+    }
+
+    template<int... T>
+    void over_trunc(std::integer_sequence<int, T...>) { (run<T>(), ...); }
+};
+
+void print_limit(const char* name, const std::vector<DseTruncPoint>& points, double target_ulp, int mult_w) {
+    const int limit = bf16_dse_trunc_limit(points, target_ulp);
+    std::cout << "  " << std::left << std::setw(22) << name << std::right;
+    if (limit < 0) {
+        std::cout << "no truncation meets the target\n";
+        return;
+    }
+    const DseTruncPoint& p = points[limit];
+    const DseTruncPoint& full = points[0];
+    std::cout << "keep " << p.keep_w << " of " << mult_w << " columns (drop " << p.trunc_w << ", correction " << p.corr
+              << "), " << p.pp_bits << " of " << full.pp_bits << " partial-product bits ("
+              << std::setprecision(1) << 100.0 * (1.0 - static_cast<double>(p.pp_bits) / full.pp_bits) << "% fewer), max "
+              << std::setprecision(6) << p.max_ulp() << " ULP\n";
+}
+
+bool write_csv(const std::string& path, const std::vector<DseTruncPoint>& corrected, const std::vector<DseTruncPoint>& plain) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        std::cerr << "Error opening file: " << path << std::endl;
+        return false;
+    }
+    out << "keep_w,trunc_w,corr,pp_bits,exp2_max_ulp,expe_max_ulp,mean_ulp\n";
+    out << std::setprecision(9);
+    for (const std::vector<DseTruncPoint>* points : {&corrected, &plain}) {
+        for (const DseTruncPoint& p : *points) {
+            out << p.keep_w << "," << p.trunc_w << "," << p.corr << "," << p.pp_bits << "," << p.exp2_max_ulp << ","
+                << p.expe_max_ulp << "," << p.mean_ulp << "\n";
+        }
+    }
+    return out.good();
+}
+
+template<typename Datapath>
+int sweep(const DseReferences& refs, unsigned num_threads, double target_ulp, const std::string& csv) {
+    TruncSweep<Datapath> s;
+    s.refs = &refs;
+    s.num_threads = num_threads;
+
+    auto start = std::chrono::steady_clock::now();
+    s.over_trunc(TruncGrid());
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (target_ulp < 0) target_ulp = s.corrected[0].max_ulp();
+    std::cout << "a*x multiplier: " << Datapath::COEFF_W << "x" << Datapath::IN_W << ", " << Datapath::MULT_W
+              << "-column product, target: " << std::fixed << std::setprecision(6) << target_ulp << " ULP\n\n";
+    std::cout << "  drop  keep  PP bits   corr   max 2^x   max e^x  mean ULP |  no corr: max 2^x   max e^x  mean ULP\n";
+    for (size_t i = 0; i < s.corrected.size(); ++i) {
+        const DseTruncPoint& c = s.corrected[i];
+        const DseTruncPoint& p = s.plain[i];
+        std::cout << std::setw(6) << c.trunc_w << std::setw(6) << c.keep_w << std::setw(9) << c.pp_bits << std::setw(7) << c.corr
+                  << std::setw(10) << c.exp2_max_ulp << std::setw(10) << c.expe_max_ulp << std::setw(10) << c.mean_ulp
+                  << " |           " << std::setw(10) << p.exp2_max_ulp << std::setw(10) << p.expe_max_ulp << std::setw(10)
+                  << p.mean_ulp << "\n";
+    }
+    std::cout << "\n(" << 2 * s.corrected.size() << " truncations in " << std::setprecision(1) << elapsed_s << " s)\n\n";
+
+    std::cout << "Smallest multiplier within the target:\n";
+    print_limit("expected-value corr.", s.corrected, target_ulp, Datapath::MULT_W);
+    print_limit("no correction", s.plain, target_ulp, Datapath::MULT_W);
+
+    if (!csv.empty()) {
+        if (!write_csv(csv, s.corrected, s.plain)) return 1;
+        std::cout << "\nOutput written to: " << csv << "\n";
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    std::string datapath = "high";
+    double target_ulp = -1.0;
+    unsigned num_threads = 0;
+    std::string reference_dir = "modeling/golden_ref";
+    std::string csv;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--datapath" && i + 1 < argc) {
+            datapath = argv[++i];
+        } else if (arg == "--target-ulp" && i + 1 < argc) {
+            target_ulp = std::stod(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            num_threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--reference-dir" && i + 1 < argc) {
+            reference_dir = argv[++i];
+        } else if (arg == "--csv" && i + 1 < argc) {
+            csv = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--datapath high|low] [--target-ulp U] [--threads T]"
+                      << " [--reference-dir dir|none] [--csv out.csv]\n";
+            return 1;
+        }
+    }
+    if (datapath != "high" && datapath != "low") {
+        std::cerr << "Error: --datapath must be high or low\n";
+        return 1;
+    }
+
+    DseReferences refs;
+    if (reference_dir != "none") refs.open(reference_dir);
+
+    std::cout << "=== BF16 exp Truncated a*x Multiplier Sweep ===\n";
+    std::cout << "Datapath: " << (datapath == "high" ? "bf16_exp_high_accuracy" : "bf16_exp_low_area") << ", reference: "
+              << (refs.has_exp2 && refs.has_expe ? reference_dir + " tables" : std::string("double-precision recompute")) << "\n";
+
+    return datapath == "high" ? sweep<bf16_exp_high_accuracy>(refs, num_threads, target_ulp, csv)
+                              : sweep<bf16_exp_low_area>(refs, num_threads, target_ulp, csv);
+}
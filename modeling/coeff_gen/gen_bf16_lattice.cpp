@@ -0,0 +1,94 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "bf16_lattice_fit.hpp"
+#include "packed_coeffs_writer.hpp"
+
+/**
+ * @brief Quantization-aware coefficient fitter for the fixed-point exp datapath.
+ * * Searches the integer coefficient lattice around the float minimax line of every
+ * segment and scores each candidate with the bit-accurate native core (see
+ * bf16_lattice_fit.hpp). Reports the fitted ROM against the committed one, and
+ * optionally writes it as a packed coefficient header in the committed layout.
+ *
+ * Usage: gen_bf16_lattice [--coeff-f F] [--lut-size N] [--radius R] [--base two|e|both]
+ *                         [--threads T] [--packed-output packed.hpp]
+ */
+
+int main(int argc, char** argv) {
+    LatticeFitOptions opts;
+    std::string base = "both";
+    std::string packed_output;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--coeff-f" && i + 1 < argc) {
+            opts.coeff_f = std::stoi(argv[++i]);
+        } else if (arg == "--lut-size" && i + 1 < argc) {
+            opts.lut_size = std::stoi(argv[++i]);
+        } else if (arg == "--radius" && i + 1 < argc) {
+            opts.radius = std::stoi(argv[++i]);
+        } else if (arg == "--base" && i + 1 < argc) {
+            base = argv[++i];
+        } else if (arg == "--threads" && i + 1 < argc) {
+            opts.num_threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--packed-output" && i + 1 < argc) {
+            packed_output = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--coeff-f F] [--lut-size N] [--radius R] [--base two|e|both]"
+                      << " [--threads T] [--packed-output packed.hpp]\n";
+            return 1;
+        }
+    }
+
+    if (base != "two" && base != "e" && base != "both") {
+        std::cerr << "Error: Unknown base " << base << " (expected two, e or both)\n";
+        return 1;
+    }
+    opts.base2 = (base != "e");
+    opts.base_e = (base != "two");
+
+    std::cout << "=== Quantization-Aware Coefficient Fit (base " << base << ") ===\n";
+    std::cout << "Coefficients: unsigned " << bf16_cfg::COEFF_I << "." << opts.coeff_f
+              << ", LUT entries: " << opts.lut_size << ", lattice radius: " << opts.radius << "\n";
+
+    auto start = std::chrono::steady_clock::now();
+    LatticeFitResult fit = bf16_lattice_fit(opts);
+    double fit_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (fit.segments.empty()) {
+        std::cerr << "Error: need 0 <= coeff-f <= " << bf16_cfg::COEFF_F << ", a power-of-two lut-size <= "
+                  << bf16_cfg::LUT_SIZE << " and radius >= 0\n";
+        return 1;
+    }
+
+    uint64_t candidates = 0;
+    for (const LatticeSegment& s : fit.segments) candidates += s.candidates;
+
+    const LatticeScore committed = bf16_lattice_evaluate(bf16_exp2_packed::coeffs_u64, opts.base2, opts.base_e);
+    const uint64_t committed_bits = static_cast<uint64_t>(bf16_cfg::LUT_SIZE) * 2 * bf16_cfg::COEFF_W;
+
+    std::cout << std::fixed << std::setprecision(6);
+    std::cout << "Core inputs scored: " << fit.score.inputs << "\n";
+    std::cout << "Candidates scored:  " << candidates << " (" << std::setprecision(1) << fit_ms << " ms)\n\n";
+    std::cout << std::setprecision(6);
+    std::cout << "                 max ULP      mean ULP     ROM bits\n";
+    std::cout << "Committed ROM:   " << committed.max_ulp << "     " << committed.mean_ulp() << "     " << committed_bits << "\n";
+    std::cout << "Lattice fit:     " << fit.score.max_ulp << "     " << fit.score.mean_ulp() << "     " << fit.rom_bits << "\n";
+
+    if (!packed_output.empty()) {
+        std::vector<uint64_t> codes_a(bf16_cfg::LUT_SIZE), codes_b(bf16_cfg::LUT_SIZE);
+        for (int i = 0; i < bf16_cfg::LUT_SIZE; ++i) {
+            codes_a[i] = fit.rom[i] & bf16_native::ones<uint64_t>(bf16_cfg::COEFF_W);
+            codes_b[i] = fit.rom[i] >> bf16_cfg::COEFF_W;
+        }
+        if (!write_packed_coeff_codes<bf16_cfg::COEFF_I, bf16_cfg::COEFF_F, bf16_cfg::LOG2E_I, bf16_cfg::LOG2E_F>(
+                packed_output, codes_a.data(), codes_b.data(), bf16_cfg::LUT_SIZE)) {
+            return 1;
+        }
+        std::cout << "\nOutput written to: " << packed_output << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,221 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <ctime>
+#include <cstdio>
+#include <charconv>
+#include <algorithm>
+#include "bf16_lattice_fit.hpp"
+#include "packed_coeffs_writer.hpp"
+
+/**
+ * @brief Native replacement for gen_bf16_discrete_minmax.py.
+ * * Fits each LUT segment with discrete minimax lines in the datapath's reduced domain
+ * (both bases' core inputs, see bf16_minimax_rom_fit in bf16_lattice_fit.hpp), quantizes
+ * them to the packed format and scores the quantized ROM through bf16_exp_core_approx_native,
+ * widening the search around the lines until every core input is correctly rounded. Only
+ * then it writes, in one pass, a float coefficient header (each coefficient exactly its
+ * fixed-point code) and a packed fixed-point header (the same words gen_packed_coeffs
+ * packs from it). Both go to the build directory by default: the committed ROM is not
+ * this fit (it rounds every core input the same way, but its pre-rounding values differ),
+ * so replacing it is a separate, reviewed change.
+ *
+ * Usage: gen_bf16_minimax [--entries N] [--max-radius R] [--threads T]
+ *                         [--output coeffs.hpp] [--packed-output packed.hpp]
+ */
+
+// The float header covers the BF16 inputs of the 2^x core: [-(1 - 2^-8), -2^INPUT_MIN_EXP]
+const double INTERVAL_START = -(1.0 - std::ldexp(1.0, -(static_cast<int>(FPFormat<FPType::BF16>::MANT_BITS) + 1)));
+const double INTERVAL_END = -std::ldexp(1.0, bf16_cfg::INPUT_MIN_EXP);
+
+/**
+ * @brief Shortest round-trip decimal of a double, always with a decimal point ("0.25", "1.0").
+ */
+std::string shortest_decimal(double v) {
+    char buf[64];
+    auto res = std::to_chars(buf, buf + sizeof(buf), v);
+    std::string s(buf, res.ptr);
+    if (s.find_first_of(".en") == std::string::npos) s += ".0";
+    return s;
+}
+
+std::string format_printf(const char* fmt, double v) {
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), fmt, v);
+    return buf;
+}
+
+bool write_coeffs_header(const std::string& path, const LatticeFitResult& fit, const std::vector<float>& a,
+                         const std::vector<float>& b, double start, double end) {
+    std::ofstream f(path);
+    if (!f.is_open()) {
+        std::cerr << "Error opening file: " << path << std::endl;
+        return false;
+    }
+
+    const int n = static_cast<int>(a.size());
+    const double worst_ulp = fit.score.max_ulp;
+    const double avg_ulp = fit.score.mean_ulp();
+
+    char stamp[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+    const std::string s = shortest_decimal(start);
+    const std::string e = shortest_decimal(end);
+
+    f << "#ifndef BF16_EXP2_COEFFS_HPP\n";
+    f << "#define BF16_EXP2_COEFFS_HPP\n\n";
+    f << "#include <cstdint>\n\n";
+    f << "// =============================================================\n";
+    f << "// exp2(x) Linear Approximation Coefficients for BF16\n";
+    f << "// =============================================================\n";
+    f << "//\n";
+    f << "// Generated: " << stamp << "\n";
+    f << "// Interval:  [" << s << ", " << e << "]\n";
+    f << "// LUT Size:  " << n << "\n";
+    f << "//\n";
+    f << "// Approximation: y = a * x + b\n";
+    f << "//\n";
+    f << "// Error Metrics (BF16 ULP, packed ROM through the native datapath, 2^x and e^x):\n";
+    f << "//   Worst-case: " << format_printf("%.6f", worst_ulp) << " ULP\n";
+    f << "//   Average:    " << format_printf("%.6f", avg_ulp) << " ULP\n";
+    f << "// =============================================================\n\n";
+
+    f << "namespace bf16_exp2 {\n\n";
+    f << "constexpr int LUT_SIZE = " << n << ";\n";
+    f << "constexpr float INTERVAL_START = " << s << "f;\n";
+    f << "constexpr float INTERVAL_END = " << e << "f;\n\n";
+
+    f << "// Slope coefficients (a)\n";
+    f << "static const float coeffs_a[LUT_SIZE] = {\n";
+    for (int i = 0; i < n; ++i) {
+        f << "    " << format_printf("% .10e", a[i]) << "f" << (i < n - 1 ? "," : "")
+          << "  // Idx " << i << " ulp=" << format_printf("%.4f", fit.segments[i].max_ulp) << "\n";
+    }
+    f << "};\n\n";
+
+    f << "// Intercept coefficients (b)\n";
+    f << "static const float coeffs_b[LUT_SIZE] = {\n";
+    for (int i = 0; i < n; ++i) {
+        f << "    " << format_printf("% .10e", b[i]) << "f" << (i < n - 1 ? "," : "") << "\n";
+    }
+    f << "};\n\n";
+
+    f << "/**\n";
+    f << " * @brief Calculate LUT index from input value.\n";
+    f << " * \n";
+    f << " * @param x Input value in [" << s << ", " << e << "]\n";
+    f << " * @return int LUT index [0, " << n - 1 << "]\n";
+    f << " */\n";
+    f << "inline int get_lut_index(float x) {\n";
+    f << "    float normalized = (x - INTERVAL_START) / (INTERVAL_END - INTERVAL_START);\n";
+    f << "    int idx = static_cast<int>(normalized * LUT_SIZE);\n";
+    f << "    // Clamp to valid range\n";
+    f << "    if (idx < 0) idx = 0;\n";
+    f << "    if (idx >= LUT_SIZE) idx = LUT_SIZE - 1;\n";
+    f << "    return idx;\n";
+    f << "}\n\n";
+
+    f << "/**\n";
+    f << " * @brief Compute exp2(x) approximation using LUT.\n";
+    f << " * \n";
+    f << " * @param x Input value in [" << s << ", " << e << "]\n";
+    f << " * @return float Approximation of 2^x\n";
+    f << " */\n";
+    f << "inline float exp2_approx(float x) {\n";
+    f << "    int idx = get_lut_index(x);\n";
+    f << "    return coeffs_a[idx] * x + coeffs_b[idx];\n";
+    f << "}\n\n";
+
+    f << "} // namespace bf16_exp2\n\n";
+    f << "#endif // BF16_EXP2_COEFFS_HPP\n";
+    return f.good();
+}
+
+int main(int argc, char** argv) {
+    LatticeFitOptions opts;
+    int max_radius = 16;
+    std::string output = "build/bf16_exp2_coeffs.hpp";
+    std::string packed_output = "build/bf16_exp2_packed_coeffs.hpp";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--entries" && i + 1 < argc) {
+            opts.lut_size = std::stoi(argv[++i]);
+        } else if (arg == "--max-radius" && i + 1 < argc) {
+            max_radius = std::stoi(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            opts.num_threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--output" && i + 1 < argc) {
+            output = argv[++i];
+        } else if (arg == "--packed-output" && i + 1 < argc) {
+            packed_output = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--entries N] [--max-radius R] [--threads T]"
+                      << " [--output coeffs.hpp] [--packed-output packed.hpp]\n";
+            return 1;
+        }
+    }
+
+    std::cout << "============================================================\n";
+    std::cout << "exp2(x) LUT Coefficient Generator for BF16 (discrete minimax)\n";
+    std::cout << "============================================================\n\n";
+    std::cout << "Interval: [" << shortest_decimal(INTERVAL_START) << ", " << shortest_decimal(INTERVAL_END) << "] (Closed interval)\n";
+    std::cout << "LUT entries: " << opts.lut_size << ", coefficients: unsigned " << bf16_cfg::COEFF_I << "." << bf16_cfg::COEFF_F << "\n";
+
+    auto t0 = std::chrono::steady_clock::now();
+    const LatticeFitResult fit = bf16_minimax_rom_fit(opts, max_radius);
+    double fit_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    if (fit.segments.empty() || max_radius < 0) {
+        std::cerr << "Error: need a power-of-two entry count <= " << bf16_cfg::LUT_SIZE << " and max-radius >= 0\n";
+        return 1;
+    }
+
+    // Segments are ROM addresses (largest |x| first), which is the float header's order
+    const int entries = opts.lut_size;
+    uint64_t candidates = 0;
+    for (const LatticeSegment& s : fit.segments) {
+        candidates += s.candidates;
+        if ((s.index + 1) % std::max(1, entries / 10) == 0 || s.index == entries - 1) {
+            std::cout << "  Entry " << std::setw(3) << s.index + 1 << "/" << entries << ": inputs=" << s.inputs
+                      << " max_ulp=" << format_printf("%.4f", s.max_ulp) << "\n";
+        }
+    }
+
+    std::cout << "\nCore inputs scored (2^x and e^x): " << fit.score.inputs << "\n";
+    std::cout << "Candidates scored: " << candidates << "\n";
+    std::cout << "Worst-case ULP error: " << format_printf("%.6f", fit.score.max_ulp) << "\n";
+    std::cout << "Average ULP error:    " << format_printf("%.6f", fit.score.mean_ulp()) << "\n";
+    std::cout << "Fit time: " << format_printf("%.1f", fit_ms) << " ms\n\n";
+    if (fit.score.max_ulp > 0.5) {
+        std::cerr << "Error: no ROM within max-radius " << max_radius << " rounds every core input correctly; nothing written\n";
+        return 1;
+    }
+
+    // Float header: coefficient i is segment i's code, exact in float (COEFF_W <= 24 bits)
+    static_assert(bf16_cfg::COEFF_W <= 24, "float coefficients must hold the codes exactly");
+    const uint64_t code_mask = bf16_native::ones<uint64_t>(bf16_cfg::COEFF_W);
+    std::vector<float> a(entries), b(entries);
+    std::vector<uint64_t> codes_a(bf16_cfg::LUT_SIZE), codes_b(bf16_cfg::LUT_SIZE);
+    for (int i = 0; i < entries; ++i) {
+        a[i] = static_cast<float>(std::ldexp(static_cast<double>(fit.segments[i].a_code), -bf16_cfg::COEFF_F));
+        b[i] = static_cast<float>(std::ldexp(static_cast<double>(fit.segments[i].b_code), -bf16_cfg::COEFF_F));
+    }
+    for (int i = 0; i < bf16_cfg::LUT_SIZE; ++i) {
+        codes_a[i] = fit.rom[i] & code_mask;
+        codes_b[i] = fit.rom[i] >> bf16_cfg::COEFF_W;
+    }
+
+    if (!write_coeffs_header(output, fit, a, b, INTERVAL_START, INTERVAL_END)) return 1;
+    std::cout << "Output written to: " << output << "\n";
+    if (!write_packed_coeff_codes<bf16_cfg::COEFF_I, bf16_cfg::COEFF_F, bf16_cfg::LOG2E_I, bf16_cfg::LOG2E_F>(
+            packed_output, codes_a.data(), codes_b.data(), bf16_cfg::LUT_SIZE)) {
+        return 1;
+    }
+    std::cout << "Output written to: " << packed_output << "\n";
+
+    return 0;
+}
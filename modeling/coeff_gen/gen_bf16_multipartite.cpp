@@ -0,0 +1,153 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "bf16_multipartite_fit.hpp"
+#include "bf16_quad_fit.hpp"
+#include "bf16_exp2_quad.hpp"
+#include "bf16_dse.hpp"
+#include "packed_coeffs_writer.hpp"
+
+/**
+ * @brief Table generator of the multipartite (multiplier-free) exp engine.
+ * * Generates the tables of every candidate width policy below (see
+ * bf16_multipartite_fit.hpp), checks every negative BF16 input for 2^x and e^x, and
+ * prints the candidates next to the quadratic and linear datapaths. The tables of the
+ * committed policy (the first candidate) are written as the multipartite table header.
+ *
+ * Usage: gen_bf16_multipartite [--radius R] [--refine-passes N] [--refine-radius R]
+ *                              [--threads T] [--reference-dir dir|none] [--output tables.hpp]
+ */
+
+// Committed tripartite datapath: TIV 7 bits, TO1 4|5, TO2 2|5, 1.17 entries, log2(e) 1.22
+typedef bf16_exp_multipartite_cfg_t<7, 4, 5, 2, 5, 17, 22> MultipartiteCommitted;
+
+/** @brief Measured cost and error of one engine configuration. */
+struct MultipartitePoint {
+    std::string name;
+    int field_bits;         // Bits of the reduced fraction that address the tables (LUT bits for the others)
+    uint64_t rom_bits;
+    uint64_t mult_bits;     // Partial-product bits of the polynomial and log2(e) multipliers
+    double exp2_max_ulp;    // Exhaustive over the negative inputs
+    double expe_max_ulp;
+    double mean_ulp;        // Over the core inputs of both bases
+};
+
+template<typename Cfg>
+MultipartitePoint run_multipartite(const std::string& name, const MultipartiteFitOptions& opts, const DseReferences& refs,
+                                   MultipartiteFitResult* fit_out) {
+    const MultipartiteFitResult fit = bf16_multipartite_fit<Cfg>(opts);
+    const bf16_exp_multipartite_tables tables = fit.tables();
+
+    MultipartitePoint p;
+    p.name = name;
+    p.field_bits = Cfg::TIV_W + Cfg::TO1_W + Cfg::TO2_W;
+    p.rom_bits = fit.rom_bits;
+    p.mult_bits = static_cast<uint64_t>(Cfg::MANT_SRC_W) * Cfg::LOG2E_W;
+    p.exp2_max_ulp = bf16_dse_exhaustive_with<Base::Two>([&tables](const FPRaw& parts) {
+        return bf16_exp_multipartite_core_approx_native<Base::Two, Cfg>(parts, tables);
+    }, refs.has_exp2 ? &refs.exp2 : nullptr, opts.num_threads).max_ulp;
+    p.expe_max_ulp = bf16_dse_exhaustive_with<Base::E>([&tables](const FPRaw& parts) {
+        return bf16_exp_multipartite_core_approx_native<Base::E, Cfg>(parts, tables);
+    }, refs.has_expe ? &refs.expe : nullptr, opts.num_threads).max_ulp;
+    p.mean_ulp = fit.score.mean_ulp();
+    if (fit_out) *fit_out = fit;
+    return p;
+}
+
+template<typename Cfg>
+MultipartitePoint run_quad(const std::string& name, const DseReferences& refs, unsigned num_threads) {
+    MultipartitePoint p;
+    p.name = name;
+    p.field_bits = Cfg::LUT_ADDR_W;
+    p.rom_bits = static_cast<uint64_t>(Cfg::LUT_SIZE) * Cfg::PACKED_W;
+    p.mult_bits = static_cast<uint64_t>(Cfg::C2_W) * Cfg::T_W + static_cast<uint64_t>(Cfg::C1_W) * Cfg::T_W +
+                  static_cast<uint64_t>(Cfg::MANT_SRC_W) * Cfg::LOG2E_W;
+    p.exp2_max_ulp = bf16_dse_exhaustive_with<Base::Two>([](const FPRaw& parts) {
+        return bf16_exp_quad_core_approx_native<Base::Two, Cfg>(parts);
+    }, refs.has_exp2 ? &refs.exp2 : nullptr, num_threads).max_ulp;
+    p.expe_max_ulp = bf16_dse_exhaustive_with<Base::E>([](const FPRaw& parts) {
+        return bf16_exp_quad_core_approx_native<Base::E, Cfg>(parts);
+    }, refs.has_expe ? &refs.expe : nullptr, num_threads).max_ulp;
+    p.mean_ulp = bf16_quad_evaluate<Cfg>(Cfg::ROM).mean_ulp();
+    return p;
+}
+
+template<typename Cfg>
+MultipartitePoint run_linear(const std::string& name, const DseReferences& refs, unsigned num_threads) {
+    MultipartitePoint p;
+    p.name = name;
+    p.field_bits = Cfg::LUT_ADDR_W;
+    p.rom_bits = static_cast<uint64_t>(Cfg::LUT_SIZE) * Cfg::PACKED_W;
+    p.mult_bits = static_cast<uint64_t>(Cfg::COEFF_W) * Cfg::IN_W + static_cast<uint64_t>(Cfg::MANT_SRC_W) * Cfg::LOG2E_W;
+    p.exp2_max_ulp = bf16_dse_exhaustive<Base::Two, Cfg>(Cfg::ROM, refs.has_exp2 ? &refs.exp2 : nullptr, num_threads).max_ulp;
+    p.expe_max_ulp = bf16_dse_exhaustive<Base::E, Cfg>(Cfg::ROM, refs.has_expe ? &refs.expe : nullptr, num_threads).max_ulp;
+    p.mean_ulp = bf16_lattice_evaluate<Cfg>(Cfg::ROM).mean_ulp();
+    return p;
+}
+
+int main(int argc, char** argv) {
+    MultipartiteFitOptions opts;
+    std::string reference_dir = "modeling/golden_ref";
+    std::string output = "modeling/coeff_gen/bf16_exp2_multipartite_tables.hpp";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--radius" && i + 1 < argc) {
+            opts.radius = std::stoi(argv[++i]);
+        } else if (arg == "--refine-passes" && i + 1 < argc) {
+            opts.refine_passes = std::stoi(argv[++i]);
+        } else if (arg == "--refine-radius" && i + 1 < argc) {
+            opts.refine_radius = std::stoi(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            opts.num_threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--reference-dir" && i + 1 < argc) {
+            reference_dir = argv[++i];
+        } else if (arg == "--output" && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--radius R] [--refine-passes N] [--refine-radius R] [--threads T]"
+                      << " [--reference-dir dir|none] [--output tables.hpp]\n";
+            return 1;
+        }
+    }
+    if (opts.radius < 0 || opts.refine_passes < 0 || opts.refine_radius < 0) {
+        std::cerr << "Error: radii and passes must be >= 0\n";
+        return 1;
+    }
+
+    DseReferences refs;
+    if (reference_dir != "none") refs.open(reference_dir);
+
+    std::cout << "=== BF16 exp Multipartite Engine Table Generation ===\n";
+    std::cout << "Reference: " << (refs.has_exp2 && refs.has_expe ? reference_dir + " tables" : std::string("double-precision recompute"))
+              << ", TIV radius: " << opts.radius << ", refinement: " << opts.refine_passes << " x +-" << opts.refine_radius << "\n\n";
+
+    auto start = std::chrono::steady_clock::now();
+    MultipartiteFitResult committed;
+    std::vector<MultipartitePoint> points;
+    points.push_back(run_multipartite<MultipartiteCommitted>("tripartite (committed)", opts, refs, &committed));
+    points.push_back(run_multipartite<bf16_exp_multipartite_cfg_t<7, 3, 4, 2, 5, 16, 22>>("tripartite small", opts, refs, nullptr));
+    points.push_back(run_multipartite<bf16_exp_multipartite_cfg_t<6, 3, 5, 2, 5, 16, 22>>("tripartite 64", opts, refs, nullptr));
+    points.push_back(run_multipartite<bf16_exp_multipartite_cfg_t<8, 4, 8, 0, 0, 18, 22>>("bipartite 256", opts, refs, nullptr));
+    points.push_back(run_quad<bf16_exp_quad>("quad 16", refs, opts.num_threads));
+    points.push_back(run_linear<bf16_exp_high_accuracy>("linear high-accuracy", refs, opts.num_threads));
+    points.push_back(run_linear<bf16_exp_low_area>("linear low-area", refs, opts.num_threads));
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "                       addr bits  ROM bits  mult bits   max 2^x   max e^x  mean ULP\n";
+    for (const MultipartitePoint& p : points) {
+        std::cout << std::left << std::setw(24) << p.name << std::right << std::setw(9) << p.field_bits
+                  << std::setw(10) << p.rom_bits << std::setw(11) << p.mult_bits << std::fixed << std::setprecision(6)
+                  << std::setw(10) << p.exp2_max_ulp << std::setw(10) << p.expe_max_ulp << std::setw(10) << p.mean_ulp << "\n";
+    }
+    std::cout << "\n(mult bits of the multipartite engines: log2(e) only; " << std::setprecision(1) << elapsed_s << " s)\n";
+
+    if (!write_multipartite_tables<MultipartiteCommitted>(output, committed.tiv.data(), committed.to1.data(),
+                                                          committed.to2.data(), "bf16_exp2_multipartite")) {
+        return 1;
+    }
+    std::cout << "\nOutput written to: " << output << "\n";
+    return 0;
+}
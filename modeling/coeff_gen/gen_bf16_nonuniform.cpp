@@ -0,0 +1,129 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "bf16_nonuniform_fit.hpp"
+#include "bf16_dse.hpp"
+#include "packed_coeffs_writer.hpp"
+
+/**
+ * @brief Breakpoint placement and coefficient generator of the non-uniform exp LUT.
+ * * Segments the 128-entry grid of the committed linear datapath (see
+ * bf16_nonuniform_fit.hpp) for several directory widths, checks every negative BF16
+ * input for 2^x and e^x, and prints the candidates next to the uniform LUTs. The
+ * segmentation with the committed directory width is written as the non-uniform header.
+ *
+ * Usage: gen_bf16_nonuniform [--l1-w W] [--target-ulp U] [--radius R] [--threads T]
+ *                            [--reference-dir dir|none] [--output nonuniform.hpp]
+ */
+
+/** @brief Measured cost and error of one segmentation. */
+struct NonuniformPoint {
+    std::string name;
+    int entries;            // Coefficient words
+    uint64_t rom_bits;      // Coefficient words plus directory
+    double exp2_max_ulp;    // Exhaustive over the negative inputs
+    double expe_max_ulp;
+    double mean_ulp;        // Over the core inputs of both bases
+};
+
+/** @brief Exhaustive check of a ROM in the uniform layout (a segmentation through its expanded ROM). */
+NonuniformPoint measure(const std::string& name, int entries, uint64_t rom_bits, const uint64_t* rom, const DseReferences& refs,
+                        unsigned num_threads) {
+    NonuniformPoint p;
+    p.name = name;
+    p.entries = entries;
+    p.rom_bits = rom_bits;
+    p.exp2_max_ulp = bf16_dse_exhaustive<Base::Two, bf16_exp_cfg>(rom, refs.has_exp2 ? &refs.exp2 : nullptr, num_threads).max_ulp;
+    p.expe_max_ulp = bf16_dse_exhaustive<Base::E, bf16_exp_cfg>(rom, refs.has_expe ? &refs.expe : nullptr, num_threads).max_ulp;
+    p.mean_ulp = bf16_lattice_evaluate<bf16_exp_cfg>(rom).mean_ulp();
+    return p;
+}
+
+int main(int argc, char** argv) {
+    NonuniformFitOptions opts;
+    std::string reference_dir = "modeling/golden_ref";
+    std::string output = "modeling/coeff_gen/bf16_exp2_nonuniform_coeffs.hpp";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--l1-w" && i + 1 < argc) {
+            opts.l1_w = std::stoi(argv[++i]);
+        } else if (arg == "--target-ulp" && i + 1 < argc) {
+            opts.target_ulp = std::stod(argv[++i]);
+        } else if (arg == "--radius" && i + 1 < argc) {
+            opts.radius = std::stoi(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            opts.num_threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--reference-dir" && i + 1 < argc) {
+            reference_dir = argv[++i];
+        } else if (arg == "--output" && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--l1-w W] [--target-ulp U] [--radius R] [--threads T]"
+                      << " [--reference-dir dir|none] [--output nonuniform.hpp]\n";
+            return 1;
+        }
+    }
+    if (opts.l1_w < 1 || opts.l1_w >= bf16_exp_cfg::LUT_ADDR_W || opts.radius < 0) {
+        std::cerr << "Error: --l1-w must be in [1, " << bf16_exp_cfg::LUT_ADDR_W - 1 << "] and --radius >= 0\n";
+        return 1;
+    }
+
+    DseReferences refs;
+    if (reference_dir != "none") refs.open(reference_dir);
+
+    std::cout << "=== BF16 exp Non-Uniform LUT Segmentation ===\n";
+    std::cout << "Reference: " << (refs.has_exp2 && refs.has_expe ? reference_dir + " tables" : std::string("double-precision recompute"))
+              << ", target: " << opts.target_ulp << " ULP, grid: " << bf16_exp_cfg::LUT_SIZE << " x 1." << bf16_exp_cfg::COEFF_F << "\n\n";
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<NonuniformPoint> points;
+    NonuniformFitResult committed;
+    for (int l1_w = 1; l1_w < bf16_exp_cfg::LUT_ADDR_W; ++l1_w) {
+        NonuniformFitOptions o = opts;
+        o.l1_w = l1_w;
+        NonuniformFitResult fit = bf16_nonuniform_fit<bf16_exp_cfg>(o);
+
+        std::string depths;
+        for (const NonuniformRegion& r : fit.regions) depths += static_cast<char>('0' + r.depth);
+        std::cout << "L1 " << l1_w << " depths: " << depths << "\n";
+
+        const int sub_w = bf16_exp_cfg::LUT_ADDR_W - l1_w;
+        const int seg_count = static_cast<int>(fit.rom.size());
+        const int depth_w = bf16_cfg::floor_log2(sub_w) + 1;
+        const int base_w = bf16_cfg::floor_log2(std::max(1, seg_count - 1)) + 1;
+        const uint64_t dir_bits = static_cast<uint64_t>(fit.dir.size()) * (base_w + depth_w);
+        const std::string name = "non-uniform L1 " + std::to_string(l1_w) + (l1_w == opts.l1_w ? " (committed)" : "");
+        points.push_back(measure(name, seg_count, static_cast<uint64_t>(seg_count) * 2 * bf16_exp_cfg::COEFF_W + dir_bits,
+                                 fit.expanded_rom.data(), refs, opts.num_threads));
+        if (l1_w == opts.l1_w) committed = fit;
+    }
+    for (int lut_size : {64, 128}) {
+        LatticeFitOptions o;
+        o.lut_size = lut_size;
+        o.radius = opts.radius;
+        o.num_threads = opts.num_threads;
+        const LatticeFitResult fit = bf16_lattice_fit<bf16_exp_cfg>(o);
+        points.push_back(measure("uniform " + std::to_string(lut_size), lut_size, fit.rom_bits, fit.rom.data(), refs, opts.num_threads));
+    }
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "\n                            entries  ROM bits   max 2^x   max e^x  mean ULP\n";
+    for (const NonuniformPoint& p : points) {
+        std::cout << std::left << std::setw(28) << p.name << std::right << std::setw(8) << p.entries << std::setw(10) << p.rom_bits
+                  << std::fixed << std::setprecision(6) << std::setw(10) << p.exp2_max_ulp << std::setw(10) << p.expe_max_ulp
+                  << std::setw(10) << p.mean_ulp << "\n";
+    }
+    std::cout << "\n(ROM bits include the directory; " << std::setprecision(1) << elapsed_s << " s)\n";
+
+    std::vector<double> region_ulp;
+    for (const NonuniformRegion& r : committed.regions) region_ulp.push_back(r.max_ulp);
+    if (!write_nonuniform_coeff_codes<bf16_exp_cfg>(output, opts.l1_w, committed.dir.data(), committed.rom.data(),
+                                                   static_cast<int>(committed.rom.size()), region_ulp.data(), "bf16_exp2_nonuniform")) {
+        return 1;
+    }
+    std::cout << "\nOutput written to: " << output << "\n";
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "bf16_quad_fit.hpp"
+#include "bf16_dse.hpp"
+#include "packed_coeffs_writer.hpp"
+
+/**
+ * @brief Coefficient generator of the quadratic exp engine.
+ * * Fits the ROM of every candidate width policy below on the coefficient lattice (see
+ * bf16_quad_fit.hpp), checks every negative BF16 input for 2^x and e^x, and prints the
+ * candidates next to the linear datapaths. The ROM of the committed policy (the first
+ * candidate) is written as the quadratic coefficient header.
+ *
+ * Usage: gen_bf16_quad [--radius R] [--radius-c2 R] [--threads T]
+ *                      [--reference-dir dir|none] [--output quad.hpp]
+ */
+
+// Committed quadratic datapath: 16 segments, t 14 bits, c0 1.16, c1 .16, c2 .12, log2(e) 1.22
+typedef bf16_exp_quad_cfg_t<4, 14, 16, 16, 12, 22> QuadCommitted;
+
+/** @brief Measured cost and error of one engine configuration. */
+struct QuadPoint {
+    std::string name;
+    int lut_size;
+    uint64_t rom_bits;
+    uint64_t mult_bits;     // Partial-product bits of the polynomial and log2(e) multipliers
+    double exp2_max_ulp;    // Exhaustive over the negative inputs
+    double expe_max_ulp;
+    double mean_ulp;        // Over the core inputs of both bases
+};
+
+template<typename Cfg>
+QuadPoint run_quad(const std::string& name, const QuadFitOptions& opts, const DseReferences& refs, std::vector<uint64_t>* rom_out) {
+    const QuadFitResult fit = bf16_quad_fit<Cfg>(opts);
+    const uint64_t* rom = fit.rom.data();
+
+    QuadPoint p;
+    p.name = name;
+    p.lut_size = Cfg::LUT_SIZE;
+    p.rom_bits = fit.rom_bits;
+    p.mult_bits = static_cast<uint64_t>(Cfg::C2_W) * Cfg::T_W + static_cast<uint64_t>(Cfg::C1_W) * Cfg::T_W +
+                  static_cast<uint64_t>(Cfg::MANT_SRC_W) * Cfg::LOG2E_W;
+    p.exp2_max_ulp = bf16_dse_exhaustive_with<Base::Two>([rom](const FPRaw& parts) {
+        return bf16_exp_quad_core_approx_native<Base::Two, Cfg>(parts, rom);
+    }, refs.has_exp2 ? &refs.exp2 : nullptr, opts.num_threads).max_ulp;
+    p.expe_max_ulp = bf16_dse_exhaustive_with<Base::E>([rom](const FPRaw& parts) {
+        return bf16_exp_quad_core_approx_native<Base::E, Cfg>(parts, rom);
+    }, refs.has_expe ? &refs.expe : nullptr, opts.num_threads).max_ulp;
+    p.mean_ulp = fit.score.mean_ulp();
+    if (rom_out) *rom_out = fit.rom;
+    return p;
+}
+
+template<typename Cfg>
+QuadPoint run_linear(const std::string& name, const DseReferences& refs, unsigned num_threads) {
+    QuadPoint p;
+    p.name = name;
+    p.lut_size = Cfg::LUT_SIZE;
+    p.rom_bits = static_cast<uint64_t>(Cfg::LUT_SIZE) * Cfg::PACKED_W;
+    p.mult_bits = static_cast<uint64_t>(Cfg::COEFF_W) * Cfg::IN_W + static_cast<uint64_t>(Cfg::MANT_SRC_W) * Cfg::LOG2E_W;
+    p.exp2_max_ulp = bf16_dse_exhaustive<Base::Two, Cfg>(Cfg::ROM, refs.has_exp2 ? &refs.exp2 : nullptr, num_threads).max_ulp;
+    p.expe_max_ulp = bf16_dse_exhaustive<Base::E, Cfg>(Cfg::ROM, refs.has_expe ? &refs.expe : nullptr, num_threads).max_ulp;
+    p.mean_ulp = bf16_lattice_evaluate<Cfg>(Cfg::ROM).mean_ulp();
+    return p;
+}
+
+int main(int argc, char** argv) {
+    QuadFitOptions opts;
+    std::string reference_dir = "modeling/golden_ref";
+    std::string output = "modeling/coeff_gen/bf16_exp2_quad_coeffs.hpp";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--radius" && i + 1 < argc) {
+            opts.radius = std::stoi(argv[++i]);
+        } else if (arg == "--radius-c2" && i + 1 < argc) {
+            opts.radius_c2 = std::stoi(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            opts.num_threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--reference-dir" && i + 1 < argc) {
+            reference_dir = argv[++i];
+        } else if (arg == "--output" && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--radius R] [--radius-c2 R] [--threads T]"
+                      << " [--reference-dir dir|none] [--output quad.hpp]\n";
+            return 1;
+        }
+    }
+    if (opts.radius < 0 || opts.radius_c2 < 0) {
+        std::cerr << "Error: radii must be >= 0\n";
+        return 1;
+    }
+
+    DseReferences refs;
+    if (reference_dir != "none") refs.open(reference_dir);
+
+    std::cout << "=== BF16 exp Quadratic Engine Coefficient Fit ===\n";
+    std::cout << "Reference: " << (refs.has_exp2 && refs.has_expe ? reference_dir + " tables" : std::string("double-precision recompute"))
+              << ", lattice radius: " << opts.radius << " (c2: " << opts.radius_c2 << ")\n\n";
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<uint64_t> rom;
+    std::vector<QuadPoint> points;
+    points.push_back(run_quad<QuadCommitted>("quad 16 (committed)", opts, refs, &rom));
+    points.push_back(run_quad<bf16_exp_quad_cfg_t<5, 13, 15, 15, 12, 22>>("quad 32", opts, refs, nullptr));
+    points.push_back(run_quad<bf16_exp_quad_cfg_t<4, 13, 15, 15, 12, 22>>("quad 16 narrow", opts, refs, nullptr));
+    points.push_back(run_linear<bf16_exp_high_accuracy>("linear high-accuracy", refs, opts.num_threads));
+    points.push_back(run_linear<bf16_exp_low_area>("linear low-area", refs, opts.num_threads));
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "                         LUT  ROM bits  mult bits   max 2^x   max e^x  mean ULP\n";
+    for (const QuadPoint& p : points) {
+        std::cout << std::left << std::setw(22) << p.name << std::right << std::setw(6) << p.lut_size
+                  << std::setw(10) << p.rom_bits << std::setw(11) << p.mult_bits << std::fixed << std::setprecision(6)
+                  << std::setw(10) << p.exp2_max_ulp << std::setw(10) << p.expe_max_ulp << std::setw(10) << p.mean_ulp << "\n";
+    }
+    std::cout << "\n(" << std::setprecision(1) << elapsed_s << " s)\n";
+
+    if (!write_quad_coeff_codes<QuadCommitted>(output, rom.data(), "bf16_exp2_quad_packed")) return 1;
+    std::cout << "\nOutput written to: " << output << "\n";
+    return 0;
+}
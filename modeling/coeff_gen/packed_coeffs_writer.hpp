@@ -0,0 +1,360 @@
+#ifndef PACKED_COEFFS_WRITER_HPP
+#define PACKED_COEFFS_WRITER_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cctype>
+#include "ac_fixed.h"
+#include "ac_int.h"
+
+/**
+ * @brief Writes the packed fixed-point coefficient header used by bf16_exp2_core.hpp.
+ * * Coefficients are given as raw unsigned COEFF_I.COEFF_F codes and packed as
+ * (b << COEFF_W) | a. log2(e) is emitted in LOG2E_I.LOG2E_F, and the packed words are
+ * mirrored as plain uint64_t for the native/SIMD kernels.
+ *
+ * @param output_filename Header to write.
+ * @param codes_a Slope codes, lut_size entries.
+ * @param codes_b Intercept codes, lut_size entries.
+ * @param ns Namespace of the tables; the include guard is derived from it, so headers of
+ *           several datapath configurations can be included side by side.
+ * @return false if the file cannot be written.
+ */
+template<int COEFF_I, int COEFF_F, int LOG2E_I, int LOG2E_F>
+bool write_packed_coeff_codes(const std::string& output_filename, const uint64_t* codes_a, const uint64_t* codes_b, int lut_size,
+                              const std::string& ns = "bf16_exp2_packed") {
+    constexpr int COEFF_W = COEFF_I + COEFF_F;
+    constexpr int LOG2E_W = LOG2E_I + LOG2E_F;
+    constexpr int PACKED_W = 2 * COEFF_W;
+
+    std::ofstream out(output_filename);
+    if (!out.is_open()) {
+        std::cerr << "Error opening file: " << output_filename << std::endl;
+        return false;
+    }
+
+    std::string guard = ns + "_COEFFS_HPP";
+    for (char& c : guard) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+
+    // Header guard and includes
+    out << "#ifndef " << guard << "\n";
+    out << "#define " << guard << "\n\n";
+    out << "#include <cstdint>\n";
+    out << "#include \"ac_int.h\"\n";
+    out << "#include \"ac_fixed.h\"\n\n";
+    out << "namespace " << ns << " {\n\n";
+
+    out << "constexpr int LUT_SIZE = " << lut_size << ";\n";
+    out << "constexpr int COEFF_I = " << COEFF_I << ";\n";
+    out << "constexpr int COEFF_F = " << COEFF_F << ";\n";
+    out << "constexpr int COEFF_W = " << COEFF_W << ";\n";
+    out << "constexpr int PACKED_W = " << PACKED_W << ";\n\n";
+
+    out << "constexpr int LOG2E_I = " << LOG2E_I << ";\n";
+    out << "constexpr int LOG2E_F = " << LOG2E_F << ";\n";
+    out << "constexpr int LOG2E_W = " << LOG2E_W << ";\n\n";
+
+    // Generate Log2E constant
+    typedef ac_fixed<LOG2E_W, LOG2E_I, false> log2e_t;
+    log2e_t log2e_val = M_LOG2E; // 1.442695...
+
+    // We need to output the raw bits of the fixed point value to ensure exact reconstruction
+    // ac_fixed stores bits as an integer.
+    ac_int<LOG2E_W, false> log2e_bits = log2e_val.template slc<LOG2E_W>(0);
+
+    out << "// Log2(e) in " << LOG2E_I << "." << LOG2E_F << " format\n";
+    out << "// Value: " << log2e_val.to_double() << "\n";
+    // Output as ac_int to ensure bit-exactness in HLS
+    out << "static const ac_int<LOG2E_W, false> log2e_int_val = 0x" << std::hex << log2e_bits.to_int64() << ";\n\n";
+
+    out << std::dec << "// Packed coefficients: [ b (" << COEFF_W << " bits) | a (" << COEFF_W << " bits) ]\n";
+    out << "// Format: unsigned " << COEFF_I << "." << COEFF_F << "\n";
+    out << "static const ac_int<PACKED_W, false> coeffs[LUT_SIZE] = {\n";
+
+    typedef ac_int<PACKED_W, false> packed_t;
+
+    // Keep the packed words for the plain-integer mirror below
+    std::vector<unsigned long long> packed_words;
+
+    for (int i = 0; i < lut_size; ++i) {
+        // Pack: b is in upper bits, a is in lower bits
+        // packed = (b << COEFF_W) | a
+        packed_t packed_val = 0;
+        packed_t a_bits = ac_int<COEFF_W, false>(codes_a[i]);
+        packed_t b_bits = ac_int<COEFF_W, false>(codes_b[i]);
+
+        packed_val = (b_bits << COEFF_W) | a_bits;
+
+        // Output as hex integer literal
+        out << "    0x" << std::hex << packed_val.to_int64() << "ULL";
+        packed_words.push_back(packed_val.to_uint64());
+
+        if (i < lut_size - 1) {
+            out << ",";
+        }
+        out << " // Index " << std::dec << i << "\n";
+    }
+
+    out << "};\n\n";
+
+    // Same words as plain integers for native (non-HLS) simulation kernels
+    out << "// Plain-integer mirror of coeffs[] for native/SIMD simulation kernels\n";
+    out << "static const uint64_t coeffs_u64[LUT_SIZE] = {\n";
+    for (int i = 0; i < lut_size; ++i) {
+        out << "    0x" << std::hex << packed_words[i] << "ULL";
+        if (i < lut_size - 1) {
+            out << ",";
+        }
+        out << "\n";
+    }
+    out << std::dec << "};\n\n";
+    out << "} // namespace " << ns << "\n\n";
+    out << "#endif // " << guard << "\n";
+
+    return out.good();
+}
+
+/**
+ * @brief Float front end of write_packed_coeff_codes.
+ * * Each coefficient is quantized to unsigned COEFF_I.COEFF_F with the ac_fixed default
+ * (truncation), as the float fitters' coefficients have always been.
+ */
+template<int COEFF_I, int COEFF_F, int LOG2E_I, int LOG2E_F>
+bool write_packed_coeffs(const std::string& output_filename, const float* coeffs_a, const float* coeffs_b, int lut_size) {
+    typedef ac_fixed<COEFF_I + COEFF_F, COEFF_I, false> coeff_t;
+
+    std::vector<uint64_t> codes_a(lut_size), codes_b(lut_size);
+    for (int i = 0; i < lut_size; ++i) {
+        // Convert float to fixed-point
+        coeff_t a_fixed = coeffs_a[i];
+        coeff_t b_fixed = coeffs_b[i];
+        codes_a[i] = a_fixed.template slc<COEFF_I + COEFF_F>(0).to_uint64();
+        codes_b[i] = b_fixed.template slc<COEFF_I + COEFF_F>(0).to_uint64();
+    }
+    return write_packed_coeff_codes<COEFF_I, COEFF_F, LOG2E_I, LOG2E_F>(output_filename, codes_a.data(), codes_b.data(), lut_size);
+}
+
+/**
+ * @brief Writes the coefficient header of the quadratic engine (bf16_exp2_quad_core.hpp).
+ * * words are the packed ROM words, (c0 << C0_LSB) | (c1 << C1_LSB) | c2. The header
+ * records the free parameters of the width policy, so the datapath can be rebuilt from
+ * it, and log2(e) in 1.LOG2E_F like the linear headers.
+ *
+ * @tparam Cfg Quadratic width policy (bf16_exp_quad_cfg_t).
+ * @param output_filename Header to write.
+ * @param words Cfg::LUT_SIZE packed ROM words.
+ * @param ns Namespace of the tables (the include guard is derived from it).
+ * @return false if the file cannot be written.
+ */
+template<typename Cfg>
+bool write_quad_coeff_codes(const std::string& output_filename, const uint64_t* words, const std::string& ns) {
+    std::ofstream out(output_filename);
+    if (!out.is_open()) {
+        std::cerr << "Error opening file: " << output_filename << std::endl;
+        return false;
+    }
+
+    std::string guard = ns + "_COEFFS_HPP";
+    for (char& c : guard) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+
+    out << "#ifndef " << guard << "\n";
+    out << "#define " << guard << "\n\n";
+    out << "#include <cstdint>\n";
+    out << "#include \"ac_int.h\"\n\n";
+    out << "namespace " << ns << " {\n\n";
+
+    out << "constexpr int LUT_SIZE = " << Cfg::LUT_SIZE << ";\n";
+    out << "constexpr int T_W = " << Cfg::T_W << ";\n";
+    out << "constexpr int C0_F = " << Cfg::C0_F << ";\n";
+    out << "constexpr int C0_W = " << Cfg::C0_W << ";\n";
+    out << "constexpr int C1_F = " << Cfg::C1_F << ";\n";
+    out << "constexpr int C1_W = " << Cfg::C1_W << ";\n";
+    out << "constexpr int C2_F = " << Cfg::C2_F << ";\n";
+    out << "constexpr int C2_W = " << Cfg::C2_W << ";\n";
+    out << "constexpr int PACKED_W = " << Cfg::PACKED_W << ";\n\n";
+
+    out << "constexpr int LOG2E_I = " << Cfg::LOG2E_I << ";\n";
+    out << "constexpr int LOG2E_F = " << Cfg::LOG2E_F << ";\n";
+    out << "constexpr int LOG2E_W = " << Cfg::LOG2E_W << ";\n\n";
+
+    out << "// Log2(e) in " << Cfg::LOG2E_I << "." << Cfg::LOG2E_F << " format\n";
+    out << "static const ac_int<LOG2E_W, false> log2e_int_val = 0x" << std::hex << Cfg::LOG2E_BITS << ";\n\n";
+
+    out << std::dec << "// Packed coefficients: [ c0 (" << Cfg::C0_W << " bits) | c1 (" << Cfg::C1_W << " bits) | c2 ("
+        << Cfg::C2_W << " bits) ]\n";
+    out << "// p(t) = c0 - t * (c1 - c2 * t), t in [0, 1) the " << Cfg::T_W << " bits below the segment bits\n";
+    out << "static const ac_int<PACKED_W, false> coeffs[LUT_SIZE] = {\n";
+    for (int i = 0; i < Cfg::LUT_SIZE; ++i) {
+        out << "    0x" << std::hex << words[i] << "ULL" << (i < Cfg::LUT_SIZE - 1 ? "," : "") << " // Index " << std::dec << i << "\n";
+    }
+    out << "};\n\n";
+
+    out << "// Plain-integer mirror of coeffs[] for native/SIMD simulation kernels\n";
+    out << "static const uint64_t coeffs_u64[LUT_SIZE] = {\n";
+    for (int i = 0; i < Cfg::LUT_SIZE; ++i) {
+        out << "    0x" << std::hex << words[i] << "ULL" << (i < Cfg::LUT_SIZE - 1 ? "," : "") << "\n";
+    }
+    out << std::dec << "};\n\n";
+    out << "} // namespace " << ns << "\n\n";
+    out << "#endif // " << guard << "\n";
+
+    return out.good();
+}
+
+/**
+ * @brief Writes the table header of the multipartite engine (bf16_exp2_multipartite_core.hpp).
+ * * Records the free parameters of the width policy and log2(e) like the other headers,
+ * then TIV, TO1 and (for a tripartite or larger policy) TO2 as plain uint32_t codes on
+ * the OUT_F grid.
+ *
+ * @tparam Cfg Multipartite width policy (bf16_exp_multipartite_cfg_t).
+ * @param output_filename Header to write.
+ * @param tiv Cfg::TIV_SIZE entries.
+ * @param to1 Cfg::TO1_SIZE entries.
+ * @param to2 Cfg::TO2_SIZE entries (unused when Cfg::TO2_W == 0).
+ * @param ns Namespace of the tables (the include guard is derived from it).
+ * @return false if the file cannot be written.
+ */
+template<typename Cfg>
+bool write_multipartite_tables(const std::string& output_filename, const uint32_t* tiv, const uint32_t* to1, const uint32_t* to2,
+                                const std::string& ns) {
+    std::ofstream out(output_filename);
+    if (!out.is_open()) {
+        std::cerr << "Error opening file: " << output_filename << std::endl;
+        return false;
+    }
+
+    std::string guard = ns + "_TABLES_HPP";
+    for (char& c : guard) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+
+    out << "#ifndef " << guard << "\n";
+    out << "#define " << guard << "\n\n";
+    out << "#include <cstdint>\n";
+    out << "#include \"ac_int.h\"\n\n";
+    out << "namespace " << ns << " {\n\n";
+
+    out << "constexpr int TIV_W = " << Cfg::TIV_W << ";\n";
+    out << "constexpr int TO1_PRE_W = " << Cfg::TO1_PRE_W << ";\n";
+    out << "constexpr int TO1_W = " << Cfg::TO1_W << ";\n";
+    out << "constexpr int TO2_PRE_W = " << Cfg::TO2_PRE_W << ";\n";
+    out << "constexpr int TO2_W = " << Cfg::TO2_W << ";\n";
+    out << "constexpr int OUT_F = " << Cfg::OUT_F << ";\n";
+    out << "constexpr int ROM_BITS = " << Cfg::ROM_BITS << ";\n\n";
+
+    out << "constexpr int LOG2E_I = " << Cfg::LOG2E_I << ";\n";
+    out << "constexpr int LOG2E_F = " << Cfg::LOG2E_F << ";\n";
+    out << "constexpr int LOG2E_W = " << Cfg::LOG2E_W << ";\n\n";
+
+    out << "// Log2(e) in " << Cfg::LOG2E_I << "." << Cfg::LOG2E_F << " format\n";
+    out << "static const ac_int<LOG2E_W, false> log2e_int_val = 0x" << std::hex << Cfg::LOG2E_BITS << ";\n\n";
+
+    auto write_table = [&out](const char* name, const char* comment, const uint32_t* table, int size) {
+        out << std::dec << "// " << comment << "\n";
+        out << "static const uint32_t " << name << "[" << size << "] = {\n";
+        for (int i = 0; i < size; ++i) {
+            if (i % 8 == 0) out << "   ";
+            out << " 0x" << std::hex << table[i] << (i < size - 1 ? "," : "");
+            if (i % 8 == 7 || i == size - 1) out << "\n";
+        }
+        out << "};\n\n";
+    };
+
+    // 2^-f = TIV(f[TIV]) - TO1(f[TO1_PRE] | f[TO1]) - TO2(f[TO2_PRE] | f[TO2])
+    write_table("tiv", "Table of initial values, 1.OUT_F, indexed by the TIV field of f", tiv, Cfg::TIV_SIZE);
+    write_table("to1", "First offsets, indexed by [ prefix | TO1 field ]", to1, Cfg::TO1_SIZE);
+    if (Cfg::TO2_W > 0) {
+        write_table("to2", "Second offsets, indexed by [ prefix | TO2 field ]", to2, Cfg::TO2_SIZE);
+    }
+
+    out << std::dec << "} // namespace " << ns << "\n\n";
+    out << "#endif // " << guard << "\n";
+
+    return out.good();
+}
+
+/**
+ * @brief Writes the coefficient header of the non-uniform LUT (bf16_exp2_nonuniform_core.hpp).
+ * * Records the uniform policy the segments are cut from (LUT_ADDR_W, COEFF_F, log2(e)),
+ * the directory width and the segment count, then the directory words and the coefficient
+ * words in the coeffs_u64 layout.
+ *
+ * @tparam Widths Uniform linear width policy (bf16_exp_cfg_t).
+ * @param output_filename Header to write.
+ * @param l1_w Directory address bits.
+ * @param dir 2^l1_w directory words, (base << DEPTH_W) | depth.
+ * @param rom Coefficient words.
+ * @param seg_count Number of coefficient words.
+ * @param region_ulp Worst ULP error per region (written as comments), or nullptr.
+ * @param ns Namespace of the tables (the include guard is derived from it).
+ * @return false if the file cannot be written.
+ */
+template<typename Widths>
+bool write_nonuniform_coeff_codes(const std::string& output_filename, int l1_w, const uint32_t* dir, const uint64_t* rom,
+                                  int seg_count, const double* region_ulp, const std::string& ns) {
+    std::ofstream out(output_filename);
+    if (!out.is_open()) {
+        std::cerr << "Error opening file: " << output_filename << std::endl;
+        return false;
+    }
+
+    std::string guard = ns + "_COEFFS_HPP";
+    for (char& c : guard) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+
+    const int sub_w = Widths::LUT_ADDR_W - l1_w;
+    int depth_w = 1;
+    while ((1 << depth_w) <= sub_w) depth_w++;
+
+    out << "#ifndef " << guard << "\n";
+    out << "#define " << guard << "\n\n";
+    out << "#include <cstdint>\n";
+    out << "#include \"ac_int.h\"\n\n";
+    out << "namespace " << ns << " {\n\n";
+
+    out << "constexpr int LUT_ADDR_W = " << Widths::LUT_ADDR_W << ";\n";
+    out << "constexpr int L1_W = " << l1_w << ";\n";
+    out << "constexpr int L1_SIZE = " << (1 << l1_w) << ";\n";
+    out << "constexpr int SEG_COUNT = " << seg_count << ";\n";
+    out << "constexpr int COEFF_I = " << Widths::COEFF_I << ";\n";
+    out << "constexpr int COEFF_F = " << Widths::COEFF_F << ";\n";
+    out << "constexpr int COEFF_W = " << Widths::COEFF_W << ";\n";
+    out << "constexpr int PACKED_W = " << 2 * Widths::COEFF_W << ";\n\n";
+
+    out << "constexpr int LOG2E_I = " << Widths::LOG2E_I << ";\n";
+    out << "constexpr int LOG2E_F = " << Widths::LOG2E_F << ";\n";
+    out << "constexpr int LOG2E_W = " << Widths::LOG2E_W << ";\n\n";
+
+    out << "// Log2(e) in " << Widths::LOG2E_I << "." << Widths::LOG2E_F << " format\n";
+    out << "static const ac_int<LOG2E_W, false> log2e_int_val = 0x" << std::hex << Widths::LOG2E_BITS << ";\n\n";
+
+    out << std::dec << "// Directory: [ base | depth (" << depth_w << " bits) ], indexed by the top " << l1_w
+        << " bits of the inverted LUT address;\n";
+    out << "// region r is cut into 2^depth segments, coefficient word base + (sub >> (" << sub_w << " - depth))\n";
+    out << "static const uint32_t dir[L1_SIZE] = {\n";
+    for (int r = 0; r < (1 << l1_w); ++r) {
+        const uint32_t depth = dir[r] & ((1u << depth_w) - 1);
+        out << "    0x" << std::hex << dir[r] << std::dec << (r < (1 << l1_w) - 1 ? "," : "") << " // Region " << r
+            << ": base " << (dir[r] >> depth_w) << ", " << (1 << depth) << " segment" << (depth ? "s" : "");
+        if (region_ulp) out << ", max ulp=" << std::fixed << std::setprecision(4) << region_ulp[r] << std::defaultfloat;
+        out << "\n";
+    }
+    out << "};\n\n";
+
+    out << "// Packed coefficients: [ b (" << Widths::COEFF_W << " bits) | a (" << Widths::COEFF_W << " bits) ]\n";
+    out << "// Format: unsigned " << Widths::COEFF_I << "." << Widths::COEFF_F << "\n";
+    out << "static const uint64_t coeffs_u64[SEG_COUNT] = {\n";
+    for (int i = 0; i < seg_count; ++i) {
+        out << "    0x" << std::hex << rom[i] << "ULL" << (i < seg_count - 1 ? "," : "") << " // Index " << std::dec << i << "\n";
+    }
+    out << "};\n\n";
+    out << "} // namespace " << ns << "\n\n";
+    out << "#endif // " << guard << "\n";
+
+    return out.good();
+}
+
+#endif // PACKED_COEFFS_WRITER_HPP
@@ -3,10 +3,32 @@
 
 #include "../utils/fp_utils.hpp"
 #include "bf16_exp2_core.hpp"
+#include "bf16_exp2_core_native.hpp"
 #include <cstdint>
 
 /**
- * @brief Custom approximation of exp2(x) for BF16.
+ * @brief Compile-time model selection.
+ * Define BF16_EXP2_NATIVE_MODEL to route bf16_exp2_approx through the native-integer
+ * core (bulk simulation). By default the ac_fixed (HLS) core is used.
+ */
+#ifdef BF16_EXP2_NATIVE_MODEL
+#define BF16_EXP2_CORE_IMPL bf16_exp_core_approx_native
+#else
+#define BF16_EXP2_CORE_IMPL bf16_exp_core_approx
+#endif
+
+/**
+ * @brief Route of an input through bf16_exp_approx_with.
+ */
+enum class ExpPath {
+    Core,       // Exponent in [-9, 7], negative: core approximation
+    PlusOne,    // +/-0, +Inf, positive inputs and tiny negative inputs
+    PlusZero,   // -Inf and large negative inputs
+    QNaN,       // NaN inputs: qNaN indefinite
+};
+
+/**
+ * @brief Special-case routing of bf16_exp_approx_with.
  * 
  * Logic:
  * 1. Special Cases:
@@ -18,96 +40,165 @@
  * 3. Negative Inputs (x < 0):
  *    - Exp < -9: Return 1.0
  *    - Exp > 7:  Return +0.0
- *    - Exp [-9, 7]: Placeholder for approximation
- * 
- * @param raw_input Raw 16-bit BF16 payload
- * @return Raw 16-bit BF16 result
+ *    - Exp [-9, 7]: Core approximation
+ *
+ * @param input_parts Decomposed BF16 input structure.
+ * @return Path of the input (ExpPath::Core when the core has to be evaluated).
  */
-inline uint16_t bf16_exp2_approx(uint16_t raw_input, bool base2 = true) {
-    // 1. Decompose input
-    FPRaw input_parts = fp_decompose(static_cast<uint32_t>(raw_input), FPType::BF16);
-
-    // Prepare result structure
-    FPRaw result_parts = {};
-    result_parts.sign = false; // 2^x is always positive (unless NaN)
-
-    // Temporary variable for core approximation result
-    FPRaw core_approx_result = {};
-
-    // Flags for special cases
-    bool set_plus_one = false;
-    bool set_plus_zero = false;
-    bool set_qnan_indefinite = false;
-
-    // --- LOGIC START ---
-
+inline ExpPath bf16_exp_classify(const FPRaw& input_parts) {
     if (input_parts.status.is_nan) {
         // NaN -> NaN
-        set_qnan_indefinite = true;
+        return ExpPath::QNaN;
     }
-    else if (input_parts.status.is_zero) {
+    if (input_parts.status.is_zero) {
         // 2^0 = 1
-        set_plus_one = true;
+        return ExpPath::PlusOne;
     }
-    else if (input_parts.status.is_inf) {
-        if (input_parts.sign) {
-            // 2^(-inf) = 0
-            set_plus_zero = true;
-        } else {
-            // 2^(+inf) -> 1.0 (per requirement "positive values always return 1")
-            set_plus_one = true;
-        }
+    if (input_parts.status.is_inf) {
+        // 2^(-inf) = 0; 2^(+inf) -> 1.0 (per requirement "positive values always return 1")
+        return input_parts.sign ? ExpPath::PlusZero : ExpPath::PlusOne;
     }
-    else {
-        // --- HANDLE NORMAL/DENORMAL NUMBERS ---
-        if (!input_parts.sign) {
-            // Case: Positive inputs (x > 0)
-            // Requirement: Always return 1.0
-            set_plus_one = true;
-        } 
-        else {
-            // Case: Negative inputs (x < 0)
-            int32_t x_exp = input_parts.exponent;
-
-            if (x_exp < -9) {
-                // Exponent < -9 -> Return 1.0
-                set_plus_one = true;
-            } 
-            else if (x_exp > 7) {
-                // Exponent > 7 -> Return +0.0
-                set_plus_zero = true;
-            } 
-            else {
-                // Exponent range -> [-9, 7] -> Use Core Approximation
-                core_approx_result = bf16_exp2_core_approx(input_parts, base2);
-            }
-        }
+
+    // --- HANDLE NORMAL/DENORMAL NUMBERS ---
+    if (!input_parts.sign) {
+        // Case: Positive inputs (x > 0)
+        // Requirement: Always return 1.0
+        return ExpPath::PlusOne;
+    }
+
+    // Case: Negative inputs (x < 0)
+    int32_t x_exp = input_parts.exponent;
+    if (x_exp < -9) {
+        // Exponent < -9 -> Return 1.0
+        return ExpPath::PlusOne;
     }
+    if (x_exp > 7) {
+        // Exponent > 7 -> Return +0.0
+        return ExpPath::PlusZero;
+    }
+    // Exponent range -> [-9, 7] -> Use Core Approximation
+    return ExpPath::Core;
+}
 
-    // --- LOGIC END ---
+/**
+ * @brief Result of a special-case path (ExpPath::Core gives an empty structure).
+ */
+inline FPRaw bf16_exp_special_result(ExpPath path) {
+    FPRaw result_parts = {};
+    result_parts.sign = false; // 2^x is always positive (unless NaN)
 
-    // Set result based on flags
-    if (set_qnan_indefinite) {
+    if (path == ExpPath::QNaN) {
         result_parts.status.is_nan = true;
         result_parts.sign = true; // qNaN indefinite is always negative
         // Quiet NaN with cleared payload: MSB=1, rest=0
         // BF16 has 7 mantissa bits, so bit 6 is the MSB (0-indexed)
-        result_parts.mantissa = 1 << 6; 
-    } else if (set_plus_one) {
+        result_parts.mantissa = 1 << 6;
+    } else if (path == ExpPath::PlusOne) {
         result_parts.exponent = 0;
         result_parts.mantissa = 0;
         result_parts.hidden_bit = 1;
-        result_parts.sign = false;
-    } else if (set_plus_zero) {
+    } else if (path == ExpPath::PlusZero) {
         result_parts.status.is_zero = true;
-        result_parts.sign = false;
-    } else {
-        result_parts = core_approx_result;
     }
+    return result_parts;
+}
+
+/**
+ * @brief Custom approximation of exp2(x) (or e^x) for BF16.
+ * * Decomposes the input, routes it with bf16_exp_classify and recomposes either the
+ * special-case result or the core approximation.
+ * 
+ * The core approximation is a callable, so models of other datapath configurations
+ * (e.g. bf16_exp_core_approx_native<B, Cfg> with their own ROM) share the special cases.
+ * The routing is the same for both bases; the callable carries the base.
+ *
+ * @param raw_input Raw 16-bit BF16 payload
+ * @param core Callable FPRaw(const FPRaw&) evaluating the core on inputs with exponent in [-9, 7]
+ * @return Raw 16-bit BF16 result
+ */
+template<typename CoreFn>
+inline uint16_t bf16_exp_approx_with(uint16_t raw_input, CoreFn core) {
+    // 1. Decompose input
+    FPRaw input_parts = fp_decompose(static_cast<uint32_t>(raw_input), FPType::BF16);
+
+    // 2. Special cases or core approximation
+    ExpPath path = bf16_exp_classify(input_parts);
+    FPRaw result_parts = (path == ExpPath::Core) ? core(input_parts) : bf16_exp_special_result(path);
 
     // 3. Recompose result
     uint32_t result_32 = fp_recompose(result_parts, FPType::BF16);
     return static_cast<uint16_t>(result_32);
 }
 
+/**
+ * @brief Custom approximation of exp2(x) (or e^x) for BF16 with the configured core.
+ * * See bf16_exp_approx_with; the core is BF16_EXP2_CORE_IMPL (ac_fixed by default).
+ * Call sites pick the datapath, e.g. bf16_exp_approx<Base::E, bf16_exp_low_area>.
+ *
+ * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Datapath (bf16_exp_high_accuracy, the committed one, by default).
+ * @param raw_input Raw 16-bit BF16 payload
+ * @return Raw 16-bit BF16 result
+ */
+template<Base B, typename Cfg = bf16_exp_high_accuracy>
+inline uint16_t bf16_exp_approx(uint16_t raw_input) {
+    return bf16_exp_approx_with(raw_input, [](const FPRaw& parts) { return BF16_EXP2_CORE_IMPL<B, Cfg>(parts); });
+}
+
+/**
+ * @brief Runtime-base wrapper around bf16_exp_approx (kept for compatibility).
+ * 
+ * @param raw_input Raw 16-bit BF16 payload
+ * @param base2 If true, calculates 2^x. If false, calculates e^x.
+ * @return Raw 16-bit BF16 result
+ */
+inline uint16_t bf16_exp2_approx(uint16_t raw_input, bool base2 = true) {
+    return base2 ? bf16_exp_approx<Base::Two>(raw_input) : bf16_exp_approx<Base::E>(raw_input);
+}
+
+/**
+ * @brief Fingerprint of the datapath configuration (FNV-1a over the key widths,
+ * log2(e) constant, packed coefficient ROM and, when used, the CSD log2(e) digits, a
+ * rounding mode other than RNE with its LFSR (width, taps, default seed) and the a*x
+ * multiplier truncation).
+ * * Stored in binary golden files so a table can be matched to the model that produced it.
+ *
+ * @tparam Cfg Datapath (bf16_exp_high_accuracy, the committed one, by default).
+ */
+template<typename Cfg = bf16_exp_high_accuracy>
+inline uint64_t bf16_exp2_config_hash() {
+    uint64_t h = 0xCBF29CE484222325ull;
+    auto mix = [&h](uint64_t v) {
+        for (int i = 0; i < 8; ++i) {
+            h ^= (v >> (8 * i)) & 0xFF;
+            h *= 0x100000001B3ull;
+        }
+    };
+
+    const int widths[] = {Cfg::INPUT_MIN_EXP, Cfg::INPUT_MAX_EXP, Cfg::LOG2E_W, Cfg::LOG2E_F,
+                          Cfg::IN_W, Cfg::IN_F, Cfg::LUT_SIZE, Cfg::COEFF_W, Cfg::COEFF_F,
+                          Cfg::CALC_W, Cfg::POLY_OUT_W};
+    for (int w : widths) mix(static_cast<uint64_t>(static_cast<int64_t>(w)));
+    mix(Cfg::LOG2E_BITS);
+    if (Cfg::LOG2E_CSD_DIGITS > 0) {
+        mix(Cfg::LOG2E_CSD_POS);
+        mix(Cfg::LOG2E_CSD_NEG);
+    }
+    if (Cfg::Rounding::MODE != RoundMode::NearestEven) {
+        mix(static_cast<uint64_t>(Cfg::Rounding::MODE));
+        mix(static_cast<uint64_t>(Cfg::Rounding::RAND_W));
+        if constexpr (Cfg::Rounding::MODE == RoundMode::Stochastic) {
+            mix(static_cast<uint64_t>(Cfg::Rounding::Source::W));
+            mix(Cfg::Rounding::Source::TAPS);
+            mix(Cfg::Rounding::Source::SEED);
+        }
+    }
+    if (Cfg::MULT_TRUNC_W > 0) {
+        mix(static_cast<uint64_t>(Cfg::MULT_TRUNC_W));
+        mix(Cfg::MULT_CORR);
+    }
+    for (int i = 0; i < Cfg::LUT_SIZE; ++i) mix(Cfg::ROM[i]);
+    return h;
+}
+
 #endif // BF16_EXP2_HPP
\ No newline at end of file
@@ -0,0 +1,403 @@
+#ifndef BF16_EXP2_BATCH_HPP
+#define BF16_EXP2_BATCH_HPP
+
+#include "bf16_exp2.hpp"
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define BF16_EXP2_BATCH_X86 1
+#endif
+
+/**
+ * @brief Instruction set used by the batched exp2 kernels.
+ */
+enum class Bf16BatchIsa {
+    Scalar,
+    AVX2,
+    AVX512BW,
+};
+
+/**
+ * @namespace bf16_exp2_simd
+ * @brief Integer SIMD re-implementation of bf16_exp2_approx.
+ * * Each 64-bit lane carries one input through the same steps as bf16_exp2_core_approx:
+ * special-case routing, range reduction (optionally times log2(e)), LUT fetch (gather),
+ * b - a*x, priority encode (smear + popcount), normalization and RNE rounding.
+ * Every fixed-point position below is derived from bf16_cfg, so the kernels follow
+ * the model when the packed coefficient header is regenerated.
+ */
+namespace bf16_exp2_simd {
+    /** @brief Special-case results (match the flags in bf16_exp2_approx). */
+    constexpr uint64_t OUT_PLUS_ONE = 0x3F80;
+    constexpr uint64_t OUT_PLUS_ZERO = 0x0000;
+    constexpr uint64_t OUT_QNAN_INDEFINITE = 0xFFC0;
+    constexpr uint64_t OUT_PLUS_INF = 0x7F80;
+
+    /** @brief Input field layout (BF16). */
+    constexpr int IN_MANT_W = bf16_cfg::TARGET_MANT_W;
+    constexpr uint64_t IN_MANT_MASK = (1ull << IN_MANT_W) - 1;
+    constexpr uint64_t IN_ABS_MASK = 0x7FFF;
+    constexpr uint64_t IN_INF_ABS = 0x7F80;
+    constexpr int IN_SIGN_POS = 15;
+
+    /** @brief Biased exponent window handled by the core. */
+    constexpr int64_t CORE_MIN_BEXP = bf16_cfg::INPUT_MIN_EXP + bf16_cfg::TARGET_EXP_BIAS;
+    constexpr int64_t CORE_MAX_BEXP = bf16_cfg::INPUT_MAX_EXP + bf16_cfg::TARGET_EXP_BIAS;
+
+    /**
+     * @brief Range reduction is done with a pre-shift of -INPUT_MIN_EXP bits,
+     * so the exponent shift (e - INPUT_MIN_EXP) is always a non-negative left shift.
+     */
+    constexpr int PRE_SHIFT = -bf16_cfg::INPUT_MIN_EXP;
+    constexpr int SRC_ALIGN = bf16_cfg::IN_F - bf16_cfg::MANT_SRC_F;   // mant_src -> unified
+    constexpr int MULT_ALIGN = bf16_cfg::IN_F - bf16_cfg::MANT_MULT_F; // mant_mult -> unified
+    constexpr uint64_t IN_F_MASK = (1ull << bf16_cfg::IN_F) - 1;
+    constexpr int LUT_SHIFT = bf16_cfg::IN_F - bf16_cfg::LUT_ADDR_W;
+
+    /** @brief Packed coefficient word: [ b | a ], COEFF_W bits each. */
+    constexpr uint64_t COEFF_MASK = (1ull << bf16_cfg::COEFF_W) - 1;
+    constexpr int B_ALIGN = bf16_cfg::CALC_F - bf16_cfg::COEFF_F;
+
+    /** @brief Polynomial datapath widths. */
+    constexpr uint64_t CALC_MASK = (bf16_cfg::CALC_W >= 64) ? ~0ull : ((1ull << bf16_cfg::CALC_W) - 1);
+    constexpr int SLICE_SHIFT = bf16_cfg::CALC_W - bf16_cfg::POLY_OUT_W;
+    constexpr uint64_t EXT_MANT_MASK = (1ull << bf16_cfg::EXT_MANT_W) - 1;
+    constexpr uint64_t HIDDEN_BIT = 1ull << bf16_cfg::HIDDEN_BIT_IDX;
+    constexpr int64_t MAX_BEXP = 0xFF;
+
+    static_assert(bf16_cfg::CALC_W < 64, "SIMD kernels need CALC_W to fit in a 64-bit lane");
+    static_assert(bf16_cfg::IN_CONV_INT_W + bf16_cfg::IN_F + PRE_SHIFT < 64,
+                  "SIMD kernels need the pre-shifted unified value to fit in a 64-bit lane");
+    static_assert(bf16_cfg::MANT_MULT_W <= 32, "SIMD kernels use a 32x32 multiply for mant_src * log2(e)");
+    static_assert(bf16_cfg::COEFF_W <= 32, "SIMD kernels use 32x32 partial products for a * x");
+
+    /** @brief log2(e) as a plain integer (LOG2E_F fractional bits), the constant of the scalar core. */
+    inline uint64_t log2e_bits() {
+        return bf16_exp_high_accuracy::LOG2E_BITS;
+    }
+
+    static_assert(bf16_exp_high_accuracy::LOG2E_F == bf16_cfg::LOG2E_F && bf16_exp_high_accuracy::LOG2E_W == bf16_cfg::LOG2E_W,
+                  "SIMD kernels multiply by log2(e) in the bf16_cfg position");
+
+#ifdef BF16_EXP2_BATCH_X86
+    // =========================================================
+    // AVX2 kernel (4 lanes)
+    // =========================================================
+
+    /** @brief Per-lane 64-bit popcount (nibble LUT + SAD). */
+    __attribute__((target("avx2")))
+    inline __m256i popcnt64_avx2(__m256i v) {
+        const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                             0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i nib = _mm256_set1_epi8(0x0F);
+        __m256i lo = _mm256_and_si256(v, nib);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nib);
+        __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lut, lo), _mm256_shuffle_epi8(lut, hi));
+        return _mm256_sad_epu8(cnt, _mm256_setzero_si256());
+    }
+
+    /** @brief Priority encoder: returns msb_idx + 1 per lane (0 for a zero lane). */
+    __attribute__((target("avx2")))
+    inline __m256i bit_length_avx2(__m256i v) {
+        v = _mm256_or_si256(v, _mm256_srli_epi64(v, 1));
+        v = _mm256_or_si256(v, _mm256_srli_epi64(v, 2));
+        v = _mm256_or_si256(v, _mm256_srli_epi64(v, 4));
+        v = _mm256_or_si256(v, _mm256_srli_epi64(v, 8));
+        v = _mm256_or_si256(v, _mm256_srli_epi64(v, 16));
+        v = _mm256_or_si256(v, _mm256_srli_epi64(v, 32));
+        return popcnt64_avx2(v);
+    }
+
+    __attribute__((target("avx2")))
+    inline __m256i exp2_lanes_avx2(__m256i x, bool base2) {
+        const __m256i one = _mm256_set1_epi64x(1);
+        const __m256i zero = _mm256_setzero_si256();
+
+        // --- Field extraction ---
+        __m256i sign = _mm256_srli_epi64(x, IN_SIGN_POS);
+        __m256i abs = _mm256_and_si256(x, _mm256_set1_epi64x(IN_ABS_MASK));
+        __m256i bexp = _mm256_srli_epi64(abs, IN_MANT_W);
+        __m256i mant_src = _mm256_or_si256(_mm256_and_si256(x, _mm256_set1_epi64x(IN_MANT_MASK)),
+                                           _mm256_set1_epi64x(1ll << IN_MANT_W));
+
+        // --- Range reduction to unified format (pre-shifted by PRE_SHIFT) ---
+        __m256i v0;
+        if (base2) {
+            v0 = _mm256_slli_epi64(mant_src, SRC_ALIGN);
+        } else {
+            __m256i mult = _mm256_mul_epu32(mant_src, _mm256_set1_epi64x((long long)log2e_bits()));
+            v0 = _mm256_slli_epi64(mult, MULT_ALIGN);
+        }
+        __m256i shift = _mm256_sub_epi64(bexp, _mm256_set1_epi64x(CORE_MIN_BEXP));
+        __m256i val = _mm256_sllv_epi64(v0, shift); // Out-of-window lanes become 0 and are overridden below
+        val = _mm256_srli_epi64(val, PRE_SHIFT);
+        __m256i frac = _mm256_and_si256(val, _mm256_set1_epi64x(IN_F_MASK));
+        __m256i int_part = _mm256_srli_epi64(val, bf16_cfg::IN_F);
+
+        // --- LUT fetch ---
+        __m256i lut_index = _mm256_and_si256(_mm256_srli_epi64(frac, LUT_SHIFT),
+                                             _mm256_set1_epi64x(bf16_cfg::LUT_MAX_IDX));
+        __m256i idx = _mm256_sub_epi64(_mm256_set1_epi64x(bf16_cfg::LUT_MAX_IDX), lut_index);
+        __m256i packed = _mm256_i64gather_epi64(
+            reinterpret_cast<const long long*>(bf16_exp2_packed::coeffs_u64), idx, 8);
+        __m256i a = _mm256_and_si256(packed, _mm256_set1_epi64x(COEFF_MASK));
+        __m256i b = _mm256_srli_epi64(packed, bf16_cfg::COEFF_W);
+
+        // --- b - a*x (a*x from two 32x32 partial products) ---
+        __m256i ax = _mm256_add_epi64(_mm256_mul_epu32(a, frac),
+                                      _mm256_slli_epi64(_mm256_mul_epu32(a, _mm256_srli_epi64(frac, 32)), 32));
+        __m256i res = _mm256_and_si256(_mm256_sub_epi64(_mm256_slli_epi64(b, B_ALIGN), ax),
+                                       _mm256_set1_epi64x(CALC_MASK));
+
+        // --- Priority encoder + normalization ---
+        __m256i bit_len = bit_length_avx2(res);
+        __m256i norm = _mm256_sllv_epi64(res, _mm256_sub_epi64(_mm256_set1_epi64x(bf16_cfg::CALC_W), bit_len));
+        __m256i m_raw = _mm256_srli_epi64(_mm256_and_si256(norm, _mm256_set1_epi64x(CALC_MASK)), SLICE_SHIFT);
+        __m256i final_exp = _mm256_sub_epi64(_mm256_sub_epi64(bit_len, _mm256_set1_epi64x(1 + bf16_cfg::POLY_OUT_F)),
+                                             int_part);
+
+        // --- RNE rounding ---
+        __m256i min_exp = _mm256_set1_epi64x(bf16_cfg::TARGET_MIN_EXP);
+        __m256i is_sub = _mm256_cmpgt_epi64(min_exp, final_exp);
+        __m256i shift_val = _mm256_add_epi64(_mm256_set1_epi64x(bf16_cfg::BASE_SHIFT),
+                                             _mm256_and_si256(is_sub, _mm256_sub_epi64(min_exp, final_exp)));
+        __m256i shift_m1 = _mm256_sub_epi64(shift_val, one);
+        __m256i kept = _mm256_srlv_epi64(m_raw, shift_val);
+        __m256i lsb = _mm256_and_si256(kept, one);
+        __m256i guard = _mm256_and_si256(_mm256_srlv_epi64(m_raw, shift_m1), one);
+        __m256i sticky_mask = _mm256_sub_epi64(_mm256_sllv_epi64(one, shift_m1), one);
+        __m256i sticky_zero = _mm256_cmpeq_epi64(_mm256_and_si256(m_raw, sticky_mask), zero);
+        __m256i sticky = _mm256_andnot_si256(sticky_zero, one);
+        __m256i round_up = _mm256_and_si256(guard, _mm256_or_si256(lsb, sticky));
+        __m256i m_ext = _mm256_add_epi64(_mm256_and_si256(kept, _mm256_set1_epi64x(EXT_MANT_MASK)), round_up);
+
+        // --- Post-rounding normalization ---
+        __m256i adj_exp = _mm256_blendv_epi8(final_exp, min_exp, is_sub);
+        __m256i carry = _mm256_and_si256(_mm256_srli_epi64(m_ext, bf16_cfg::CARRY_BIT_IDX), one);
+        adj_exp = _mm256_add_epi64(adj_exp, carry);
+        m_ext = _mm256_srlv_epi64(m_ext, carry);
+
+        // --- BF16 packing (mirrors fp_recompose) ---
+        __m256i mant_out = _mm256_and_si256(m_ext, _mm256_set1_epi64x(IN_MANT_MASK));
+        __m256i bexp_out = _mm256_add_epi64(adj_exp, _mm256_set1_epi64x(bf16_cfg::TARGET_EXP_BIAS));
+        __m256i core = _mm256_or_si256(_mm256_slli_epi64(bexp_out, IN_MANT_W), mant_out);
+        core = _mm256_blendv_epi8(core, _mm256_set1_epi64x(OUT_PLUS_INF),
+                                  _mm256_cmpgt_epi64(bexp_out, _mm256_set1_epi64x(MAX_BEXP - 1)));
+        core = _mm256_blendv_epi8(core, zero, _mm256_cmpgt_epi64(one, bexp_out));
+        __m256i no_hidden = _mm256_cmpeq_epi64(_mm256_and_si256(m_ext, _mm256_set1_epi64x(HIDDEN_BIT)), zero);
+        core = _mm256_blendv_epi8(core, mant_out, _mm256_and_si256(is_sub, no_hidden));
+        core = _mm256_blendv_epi8(core, zero, _mm256_cmpeq_epi64(m_ext, zero));
+
+        // --- Special-case routing ---
+        __m256i r = core;
+        r = _mm256_blendv_epi8(r, _mm256_set1_epi64x(OUT_PLUS_ZERO),
+                               _mm256_cmpgt_epi64(bexp, _mm256_set1_epi64x(CORE_MAX_BEXP)));
+        r = _mm256_blendv_epi8(r, _mm256_set1_epi64x(OUT_PLUS_ONE),
+                               _mm256_cmpgt_epi64(_mm256_set1_epi64x(CORE_MIN_BEXP), bexp));
+        r = _mm256_blendv_epi8(r, _mm256_set1_epi64x(OUT_PLUS_ONE), _mm256_cmpeq_epi64(sign, zero));
+        r = _mm256_blendv_epi8(r, _mm256_set1_epi64x(OUT_QNAN_INDEFINITE),
+                               _mm256_cmpgt_epi64(abs, _mm256_set1_epi64x(IN_INF_ABS)));
+        return r;
+    }
+
+    __attribute__((target("avx2")))
+    inline size_t exp2_batch_avx2(const uint16_t* in, uint16_t* out, size_t n, bool base2) {
+        const __m256i pick_lo = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i x = _mm256_cvtepu16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i)));
+            __m256i r = exp2_lanes_avx2(x, base2);
+            __m128i r32 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(r, pick_lo));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi32(r32, r32));
+        }
+        return i;
+    }
+
+    // =========================================================
+    // AVX-512BW kernel (8 lanes)
+    // =========================================================
+
+    // GCC 12 reports false -Wuninitialized hits inside its own AVX-512 intrinsic headers
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+    __attribute__((target("avx512f,avx512bw")))
+    inline __m512i bit_length_avx512(__m512i v) {
+        v = _mm512_or_si512(v, _mm512_srli_epi64(v, 1));
+        v = _mm512_or_si512(v, _mm512_srli_epi64(v, 2));
+        v = _mm512_or_si512(v, _mm512_srli_epi64(v, 4));
+        v = _mm512_or_si512(v, _mm512_srli_epi64(v, 8));
+        v = _mm512_or_si512(v, _mm512_srli_epi64(v, 16));
+        v = _mm512_or_si512(v, _mm512_srli_epi64(v, 32));
+
+        const __m512i lut = _mm512_set4_epi32(0x04030302, 0x03020201, 0x03020201, 0x02010100);
+        const __m512i nib = _mm512_set1_epi8(0x0F);
+        __m512i lo = _mm512_and_si512(v, nib);
+        __m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), nib);
+        __m512i cnt = _mm512_add_epi8(_mm512_shuffle_epi8(lut, lo), _mm512_shuffle_epi8(lut, hi));
+        return _mm512_sad_epu8(cnt, _mm512_setzero_si512());
+    }
+
+    __attribute__((target("avx512f,avx512bw")))
+    inline __m512i exp2_lanes_avx512(__m512i x, bool base2) {
+        const __m512i one = _mm512_set1_epi64(1);
+        const __m512i zero = _mm512_setzero_si512();
+
+        // --- Field extraction ---
+        __m512i sign = _mm512_srli_epi64(x, IN_SIGN_POS);
+        __m512i abs = _mm512_and_si512(x, _mm512_set1_epi64(IN_ABS_MASK));
+        __m512i bexp = _mm512_srli_epi64(abs, IN_MANT_W);
+        __m512i mant_src = _mm512_or_si512(_mm512_and_si512(x, _mm512_set1_epi64(IN_MANT_MASK)),
+                                           _mm512_set1_epi64(1ll << IN_MANT_W));
+
+        // --- Range reduction to unified format (pre-shifted by PRE_SHIFT) ---
+        __m512i v0;
+        if (base2) {
+            v0 = _mm512_slli_epi64(mant_src, SRC_ALIGN);
+        } else {
+            __m512i mult = _mm512_mul_epu32(mant_src, _mm512_set1_epi64((long long)log2e_bits()));
+            v0 = _mm512_slli_epi64(mult, MULT_ALIGN);
+        }
+        __m512i shift = _mm512_sub_epi64(bexp, _mm512_set1_epi64(CORE_MIN_BEXP));
+        __m512i val = _mm512_srli_epi64(_mm512_sllv_epi64(v0, shift), PRE_SHIFT);
+        __m512i frac = _mm512_and_si512(val, _mm512_set1_epi64(IN_F_MASK));
+        __m512i int_part = _mm512_srli_epi64(val, bf16_cfg::IN_F);
+
+        // --- LUT fetch ---
+        __m512i lut_index = _mm512_and_si512(_mm512_srli_epi64(frac, LUT_SHIFT),
+                                             _mm512_set1_epi64(bf16_cfg::LUT_MAX_IDX));
+        __m512i idx = _mm512_sub_epi64(_mm512_set1_epi64(bf16_cfg::LUT_MAX_IDX), lut_index);
+        __m512i packed = _mm512_i64gather_epi64(idx, bf16_exp2_packed::coeffs_u64, 8);
+        __m512i a = _mm512_and_si512(packed, _mm512_set1_epi64(COEFF_MASK));
+        __m512i b = _mm512_srli_epi64(packed, bf16_cfg::COEFF_W);
+
+        // --- b - a*x ---
+        __m512i ax = _mm512_add_epi64(_mm512_mul_epu32(a, frac),
+                                      _mm512_slli_epi64(_mm512_mul_epu32(a, _mm512_srli_epi64(frac, 32)), 32));
+        __m512i res = _mm512_and_si512(_mm512_sub_epi64(_mm512_slli_epi64(b, B_ALIGN), ax),
+                                       _mm512_set1_epi64(CALC_MASK));
+
+        // --- Priority encoder + normalization ---
+        __m512i bit_len = bit_length_avx512(res);
+        __m512i norm = _mm512_sllv_epi64(res, _mm512_sub_epi64(_mm512_set1_epi64(bf16_cfg::CALC_W), bit_len));
+        __m512i m_raw = _mm512_srli_epi64(_mm512_and_si512(norm, _mm512_set1_epi64(CALC_MASK)), SLICE_SHIFT);
+        __m512i final_exp = _mm512_sub_epi64(_mm512_sub_epi64(bit_len, _mm512_set1_epi64(1 + bf16_cfg::POLY_OUT_F)),
+                                             int_part);
+
+        // --- RNE rounding ---
+        __m512i min_exp = _mm512_set1_epi64(bf16_cfg::TARGET_MIN_EXP);
+        __mmask8 is_sub = _mm512_cmpgt_epi64_mask(min_exp, final_exp);
+        __m512i shift_val = _mm512_mask_add_epi64(_mm512_set1_epi64(bf16_cfg::BASE_SHIFT), is_sub,
+                                                  _mm512_set1_epi64(bf16_cfg::BASE_SHIFT),
+                                                  _mm512_sub_epi64(min_exp, final_exp));
+        __m512i shift_m1 = _mm512_sub_epi64(shift_val, one);
+        __m512i kept = _mm512_srlv_epi64(m_raw, shift_val);
+        __m512i lsb = _mm512_and_si512(kept, one);
+        __m512i guard = _mm512_and_si512(_mm512_srlv_epi64(m_raw, shift_m1), one);
+        __m512i sticky_mask = _mm512_sub_epi64(_mm512_sllv_epi64(one, shift_m1), one);
+        __mmask8 sticky = _mm512_test_epi64_mask(m_raw, sticky_mask);
+        __mmask8 round_up = _mm512_test_epi64_mask(guard, one) &
+                            (_mm512_test_epi64_mask(lsb, one) | sticky);
+        __m512i m_ext = _mm512_mask_add_epi64(_mm512_and_si512(kept, _mm512_set1_epi64(EXT_MANT_MASK)),
+                                              round_up,
+                                              _mm512_and_si512(kept, _mm512_set1_epi64(EXT_MANT_MASK)), one);
+
+        // --- Post-rounding normalization ---
+        __m512i adj_exp = _mm512_mask_blend_epi64(is_sub, final_exp, min_exp);
+        __m512i carry = _mm512_and_si512(_mm512_srli_epi64(m_ext, bf16_cfg::CARRY_BIT_IDX), one);
+        adj_exp = _mm512_add_epi64(adj_exp, carry);
+        m_ext = _mm512_srlv_epi64(m_ext, carry);
+
+        // --- BF16 packing (mirrors fp_recompose) ---
+        __m512i mant_out = _mm512_and_si512(m_ext, _mm512_set1_epi64(IN_MANT_MASK));
+        __m512i bexp_out = _mm512_add_epi64(adj_exp, _mm512_set1_epi64(bf16_cfg::TARGET_EXP_BIAS));
+        __m512i core = _mm512_or_si512(_mm512_slli_epi64(bexp_out, IN_MANT_W), mant_out);
+        core = _mm512_mask_blend_epi64(_mm512_cmpge_epi64_mask(bexp_out, _mm512_set1_epi64(MAX_BEXP)),
+                                       core, _mm512_set1_epi64(OUT_PLUS_INF));
+        core = _mm512_mask_blend_epi64(_mm512_cmplt_epi64_mask(bexp_out, one), core, zero);
+        __mmask8 no_hidden = _mm512_testn_epi64_mask(m_ext, _mm512_set1_epi64(HIDDEN_BIT));
+        core = _mm512_mask_blend_epi64(is_sub & no_hidden, core, mant_out);
+        core = _mm512_mask_blend_epi64(_mm512_testn_epi64_mask(m_ext, m_ext), core, zero);
+
+        // --- Special-case routing ---
+        __m512i r = core;
+        r = _mm512_mask_blend_epi64(_mm512_cmpgt_epi64_mask(bexp, _mm512_set1_epi64(CORE_MAX_BEXP)),
+                                    r, _mm512_set1_epi64(OUT_PLUS_ZERO));
+        r = _mm512_mask_blend_epi64(_mm512_cmplt_epi64_mask(bexp, _mm512_set1_epi64(CORE_MIN_BEXP)),
+                                    r, _mm512_set1_epi64(OUT_PLUS_ONE));
+        r = _mm512_mask_blend_epi64(_mm512_testn_epi64_mask(sign, sign), r, _mm512_set1_epi64(OUT_PLUS_ONE));
+        r = _mm512_mask_blend_epi64(_mm512_cmpgt_epi64_mask(abs, _mm512_set1_epi64(IN_INF_ABS)),
+                                    r, _mm512_set1_epi64(OUT_QNAN_INDEFINITE));
+        return r;
+    }
+
+    __attribute__((target("avx512f,avx512bw")))
+    inline size_t exp2_batch_avx512(const uint16_t* in, uint16_t* out, size_t n, bool base2) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m512i x = _mm512_cvtepu16_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)));
+            __m512i r = exp2_lanes_avx512(x, base2);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm512_cvtepi64_epi16(r));
+        }
+        return i;
+    }
+#pragma GCC diagnostic pop
+#endif // BF16_EXP2_BATCH_X86
+}
+
+/**
+ * @brief Returns the best instruction set supported by the running CPU (detected once).
+ */
+inline Bf16BatchIsa bf16_exp2_batch_isa() {
+#ifdef BF16_EXP2_BATCH_X86
+    static const Bf16BatchIsa isa = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return Bf16BatchIsa::AVX512BW;
+        if (__builtin_cpu_supports("avx2")) return Bf16BatchIsa::AVX2;
+        return Bf16BatchIsa::Scalar;
+    }();
+    return isa;
+#else
+    return Bf16BatchIsa::Scalar;
+#endif
+}
+
+/**
+ * @brief Batched bf16_exp2_approx on an explicitly chosen instruction set.
+ * * Elements not covered by full vectors (and every element for Bf16BatchIsa::Scalar)
+ * go through the scalar bit-accurate model. The caller must make sure the CPU supports
+ * the requested ISA (see bf16_exp2_batch_isa).
+ */
+inline void bf16_exp2_approx_batch(const uint16_t* in, uint16_t* out, size_t n, bool base2, Bf16BatchIsa isa) {
+    size_t done = 0;
+#ifdef BF16_EXP2_BATCH_X86
+    if (isa == Bf16BatchIsa::AVX512BW) {
+        done = bf16_exp2_simd::exp2_batch_avx512(in, out, n, base2);
+    } else if (isa == Bf16BatchIsa::AVX2) {
+        done = bf16_exp2_simd::exp2_batch_avx2(in, out, n, base2);
+    }
+#else
+    (void)isa;
+#endif
+    for (size_t i = done; i < n; ++i) {
+        out[i] = bf16_exp2_approx(in[i], base2);
+    }
+}
+
+/**
+ * @brief Batched bf16_exp2_approx, bit-identical to the scalar model.
+ * * Picks AVX-512BW, AVX2 or the scalar model at runtime.
+ *
+ * @param in Raw BF16 inputs
+ * @param out Raw BF16 results (may alias in)
+ * @param n Number of elements
+ * @param base2 If true, calculates 2^x. If false, calculates e^x.
+ */
+inline void bf16_exp2_approx_batch(const uint16_t* in, uint16_t* out, size_t n, bool base2 = true) {
+    bf16_exp2_approx_batch(in, out, n, base2, bf16_exp2_batch_isa());
+}
+
+#endif // BF16_EXP2_BATCH_HPP
@@ -3,6 +3,7 @@
 
 #include "../utils/fp_utils.hpp"
 #include "../../modeling/coeff_gen/bf16_exp2_packed_coeffs.hpp"
+#include "../../modeling/coeff_gen/bf16_exp2_low_area_packed_coeffs.hpp"
 #include "ac_fixed.h"
 
 /**
@@ -102,114 +103,615 @@ namespace bf16_cfg {
     constexpr int IN_CONV_W = IN_CONV_INT_W + IN_CONV_FRAC_W;
 }
 
-/** @brief Typedef for input fixed-point mantissa. */
-typedef ac_fixed<bf16_cfg::IN_W, bf16_cfg::IN_I, false> mant_t;
+/** @brief Rounding direction of the BF16 back end (bf16_exp_round). */
+enum class RoundMode {
+    NearestEven,   // RNE: guard && (lsb || sticky)
+    TowardZero,    // RTZ: truncate, no incrementer and no carry renormalization
+    HalfAway,      // Round half away from zero: guard
+    Stochastic,    // Up with probability (discarded fraction), from an LFSR
+};
 
-/** @brief Structure holding normalized polynomial result. */
-struct PolyResult {
-    ac_fixed<bf16_cfg::POLY_OUT_W, bf16_cfg::POLY_OUT_I, false> mantissa;
-    int32_t exponent;
+/**
+ * @brief Galois LFSR, the random source of stochastic rounding.
+ * * Advances one step per rounded result and returns its W-bit state. The state is
+ * thread_local, so each simulation thread models its own unit; seed() makes a run
+ * reproducible (single-threaded sweeps give the same sequence as the hardware).
+ *
+ * @tparam W_    State width.
+ * @tparam TAPS_ Feedback mask (maximal-length polynomial for W_).
+ * @tparam SEED_ Non-zero reset state.
+ */
+template<int W_, uint64_t TAPS_, uint64_t SEED_>
+struct bf16_lfsr_t {
+    static constexpr int W = W_;
+    static constexpr uint64_t TAPS = TAPS_;
+    static constexpr uint64_t SEED = SEED_;
+    static inline thread_local uint64_t state = SEED_;
+
+    /** @brief Resets the state (0 is the lock-up state and is replaced by SEED). */
+    static void seed(uint64_t s = SEED_) {
+        const uint64_t mask = (W_ >= 64) ? ~uint64_t(0) : ((uint64_t(1) << W_) - 1);
+        state = (s & mask) ? (s & mask) : SEED_;
+    }
+
+    static uint64_t next() {
+        const uint64_t lsb = state & 1;
+        state >>= 1;
+        if (lsb) state ^= TAPS_;
+        return state;
+    }
+
+    static_assert(W_ >= 2 && W_ <= 64 && SEED_ != 0, "LFSR needs a non-zero state of 2 to 64 bits");
+};
+
+/** @brief 16-bit maximal LFSR (x^16 + x^14 + x^13 + x^11 + 1). */
+typedef bf16_lfsr_t<16, 0xB400, 0xACE1> bf16_lfsr16;
+
+/** @brief 32-bit maximal LFSR (x^32 + x^22 + x^2 + x + 1). */
+typedef bf16_lfsr_t<32, 0x80200003, 0x1F2E3D4C> bf16_lfsr32;
+
+/** @brief Rounding policies of the back end: RoundMode plus, for stochastic rounding, its random source. */
+struct bf16_round_rne {
+    static constexpr RoundMode MODE = RoundMode::NearestEven;
+    static constexpr int RAND_W = 0;
+};
+
+struct bf16_round_rtz {
+    static constexpr RoundMode MODE = RoundMode::TowardZero;
+    static constexpr int RAND_W = 0;
+};
+
+struct bf16_round_half_away {
+    static constexpr RoundMode MODE = RoundMode::HalfAway;
+    static constexpr int RAND_W = 0;
 };
 
 /**
- * @brief Calculates 2^(-x) using piecewise linear approximation for x in [0, 1].
- * * Formula: result = a * (-x) + b
- * Uses a Look-Up Table (LUT) for coefficients 'a' and 'b' based on the leading
- * bits of the input fractional part.
- * * @param mant_val Input value in fixed-point format.
- * @return Normalized PolyResult containing mantissa and exponent.
+ * @brief Stochastic rounding: the top RAND_W_ discarded bits plus RAND_W_ random bits from
+ * Lfsr; a carry out rounds up (probability = discarded fraction, to 2^-RAND_W_).
  */
-inline PolyResult bf16_exp2_poly(mant_t mant_val) {
-    // Extract LUT index from the MSBs of the fractional part
-    uint8_t lut_index = mant_val.slc<bf16_cfg::LUT_ADDR_W>(bf16_cfg::IN_F - bf16_cfg::LUT_ADDR_W);
+template<typename Lfsr = bf16_lfsr16, int RAND_W_ = Lfsr::W>
+struct bf16_round_stochastic {
+    typedef Lfsr Source;
+    static constexpr RoundMode MODE = RoundMode::Stochastic;
+    static constexpr int RAND_W = RAND_W_;
 
-    // Fetch coefficients based on the inverted index for the 2^-x mapping
-    int idx = bf16_cfg::LUT_MAX_IDX - lut_index;
-    ac_int<bf16_exp2_packed::PACKED_W, false> packed = bf16_exp2_packed::coeffs[idx];
+    static_assert(RAND_W_ >= 1 && RAND_W_ <= Lfsr::W && RAND_W_ <= 32, "random bits come from the LFSR state");
+};
 
-    typedef ac_fixed<bf16_cfg::COEFF_W, bf16_cfg::COEFF_I, false> coeff_t;
-    typedef ac_fixed<bf16_cfg::CALC_W, bf16_cfg::CALC_I, true> calc_t;
+/**
+ * @brief Rounding decision of policy Rounding.
+ * * @param lsb Bit kept at the rounding position.
+ * @param guard First discarded bit.
+ * @param sticky OR of the discarded bits below guard.
+ * @param discarded Top Rounding::RAND_W discarded bits (stochastic rounding only).
+ * @return true to increment the kept mantissa.
+ */
+template<typename Rounding>
+inline bool bf16_round_up(bool lsb, bool guard, bool sticky, uint64_t discarded = 0) {
+    if constexpr (Rounding::MODE == RoundMode::NearestEven) {
+        return guard && (lsb || sticky);
+    } else if constexpr (Rounding::MODE == RoundMode::HalfAway) {
+        return guard;
+    } else if constexpr (Rounding::MODE == RoundMode::Stochastic) {
+        const uint64_t rand_bits = Rounding::Source::next() & ((uint64_t(1) << Rounding::RAND_W) - 1);
+        return ((discarded + rand_bits) >> Rounding::RAND_W) != 0;
+    } else {
+        return false;
+    }
+}
 
-    coeff_t a_fixed;
-    a_fixed.set_slc(0, packed.slc<bf16_cfg::COEFF_W>(0));
-    coeff_t b_fixed;
-    b_fixed.set_slc(0, packed.slc<bf16_cfg::COEFF_W>(bf16_cfg::COEFF_W));
+/**
+ * @brief Width policy of the exp datapath.
+ * * Carries the same constants as bf16_cfg, derived the same way from the three free
+ * parameters: LUT address width, coefficient fraction bits and log2(e) fraction bits.
+ * Models templated on a policy can instantiate several datapaths in one binary;
+ * bf16_exp_cfg is the committed configuration.
+ *
+ * @tparam LUT_ADDR_W_ log2 of the number of LUT segments.
+ * @tparam COEFF_F_    Fraction bits of the unsigned 1.F coefficients.
+ * @tparam LOG2E_F_    Fraction bits of the unsigned 1.F log2(e) constant.
+ */
+template<int LUT_ADDR_W_, int COEFF_F_, int LOG2E_F_>
+struct bf16_exp_cfg_t {
+    static constexpr int TARGET_MANT_W = bf16_cfg::TARGET_MANT_W;
+    static constexpr int TARGET_EXP_BIAS = bf16_cfg::TARGET_EXP_BIAS;
+    static constexpr int TARGET_MIN_EXP = bf16_cfg::TARGET_MIN_EXP;
+    static constexpr int INPUT_MIN_EXP = bf16_cfg::INPUT_MIN_EXP;
+    static constexpr int INPUT_MAX_EXP = bf16_cfg::INPUT_MAX_EXP;
+
+    static constexpr int MANT_SRC_I = bf16_cfg::MANT_SRC_I;
+    static constexpr int MANT_SRC_F = bf16_cfg::MANT_SRC_F;
+    static constexpr int MANT_SRC_W = bf16_cfg::MANT_SRC_W;
+
+    static constexpr int LOG2E_I = 1;
+    static constexpr int LOG2E_F = LOG2E_F_;
+    static constexpr int LOG2E_W = LOG2E_I + LOG2E_F;
+
+    static constexpr int MANT_MULT_I = MANT_SRC_I + LOG2E_I;
+    static constexpr int MANT_MULT_F = MANT_SRC_F + LOG2E_F;
+    static constexpr int MANT_MULT_W = MANT_MULT_I + MANT_MULT_F;
+
+    static constexpr int IN_I = 1;
+    static constexpr int IN_F = MANT_MULT_F + (-INPUT_MIN_EXP);
+    static constexpr int IN_W = IN_I + IN_F;
+
+    static constexpr int LUT_ADDR_W = LUT_ADDR_W_;
+    static constexpr int LUT_SIZE = 1 << LUT_ADDR_W;
+    static constexpr int LUT_MAX_IDX = LUT_SIZE - 1;
+
+    static constexpr int COEFF_I = 1;
+    static constexpr int COEFF_F = COEFF_F_;
+    static constexpr int COEFF_W = COEFF_I + COEFF_F;
+
+    static constexpr int MULT_I = IN_I + COEFF_I;
+    static constexpr int MULT_F = IN_F + COEFF_F;
+    static constexpr int MULT_W = MULT_I + MULT_F;
+
+    /** @brief Truncated a * x multiplier: low product columns dropped (0 = full product) and
+     * the constant correction added at the lowest kept column (see bf16_exp_trunc_mult_t). */
+    static constexpr int MULT_TRUNC_W = 0;
+    static constexpr uint64_t MULT_CORR = 0;
+
+    static constexpr int CALC_SIGN_BIT = bf16_cfg::CALC_SIGN_BIT;
+    static constexpr int MAX_OP_I = (MULT_I + CALC_SIGN_BIT > COEFF_I) ? MULT_I + CALC_SIGN_BIT : COEFF_I;
+    static constexpr int MAX_OP_F = (MULT_F > COEFF_F) ? MULT_F : COEFF_F;
+    static constexpr int CALC_ADD_GUARD = bf16_cfg::CALC_ADD_GUARD;
+    static constexpr int CALC_I = MAX_OP_I + CALC_ADD_GUARD;
+    static constexpr int CALC_F = MAX_OP_F;
+    static constexpr int CALC_W = CALC_I + CALC_F;
+
+    static constexpr int POLY_OUT_I = 1;
+    static constexpr int POLY_OUT_F = CALC_F;
+    static constexpr int POLY_OUT_W = POLY_OUT_I + POLY_OUT_F;
+
+    static constexpr int BASE_SHIFT = POLY_OUT_F - TARGET_MANT_W;
+
+    static constexpr int EXT_MANT_W = bf16_cfg::EXT_MANT_W;
+    static constexpr int CARRY_BIT_IDX = bf16_cfg::CARRY_BIT_IDX;
+    static constexpr int HIDDEN_BIT_IDX = bf16_cfg::HIDDEN_BIT_IDX;
+
+    static constexpr int IN_CONV_INT_W = INPUT_MAX_EXP + MANT_MULT_I;
+    static constexpr int IN_CONV_FRAC_W = TARGET_MANT_W;
+    static constexpr int IN_CONV_W = IN_CONV_INT_W + IN_CONV_FRAC_W;
+
+    /** @brief log2(e) truncated to LOG2E_F fraction bits (the ac_fixed default quantization). */
+    static constexpr uint64_t LOG2E_BITS =
+        static_cast<uint64_t>(1.442695040888963407359924681001892137L * static_cast<long double>(uint64_t(1) << LOG2E_F));
+
+    /** @brief mant_src * log2(e) as a general multiplier (0 digits) or a shift-and-add over the
+     * signed digits POS - NEG of the constant (see bf16_exp_csd_log2e_t). */
+    static constexpr int LOG2E_CSD_DIGITS = 0;
+    static constexpr uint64_t LOG2E_CSD_POS = LOG2E_BITS;
+    static constexpr uint64_t LOG2E_CSD_NEG = 0;
+
+    /** @brief Rounding policy of the BF16 back end (see bf16_exp_rounding_t). */
+    typedef bf16_round_rne Rounding;
+
+    static_assert(LUT_ADDR_W >= 0 && LUT_ADDR_W <= IN_F, "LUT address must come from the input fraction");
+    static_assert(LOG2E_F >= 0 && LOG2E_F <= 48, "log2(e) must fit the 64-bit constant with headroom");
+};
 
-    // Perform multiplication: a * x
-    ac_fixed<bf16_cfg::MULT_W, bf16_cfg::MULT_I, false> ax_u = a_fixed * mant_val;
+/** @brief The committed datapath configuration (same widths as bf16_cfg). */
+typedef bf16_exp_cfg_t<bf16_cfg::LUT_ADDR_W, bf16_cfg::COEFF_F, bf16_cfg::LOG2E_F> bf16_exp_cfg;
 
-    // Negate and cast to signed type: -ax
-    calc_t ax_s = - (calc_t)ax_u;
+static_assert(bf16_exp_cfg::LUT_SIZE == bf16_cfg::LUT_SIZE && bf16_exp_cfg::IN_W == bf16_cfg::IN_W &&
+              bf16_exp_cfg::CALC_W == bf16_cfg::CALC_W && bf16_exp_cfg::POLY_OUT_W == bf16_cfg::POLY_OUT_W &&
+              bf16_exp_cfg::BASE_SHIFT == bf16_cfg::BASE_SHIFT && bf16_exp_cfg::IN_CONV_W == bf16_cfg::IN_CONV_W,
+              "bf16_exp_cfg must describe the same datapath as bf16_cfg");
 
-    // Add offset: res = b + (-ax)
-    calc_t res = ax_s + (calc_t)b_fixed;
+/**
+ * @brief Range reduction and BF16 target fields of the exp datapath, as a base for the
+ * width policies of the other approximation engines (quadratic, multipartite). These
+ * fields depend only on the log2(e) width; each engine adds its own table and output
+ * widths (LUT_ADDR_W, CALC_*, POLY_OUT_*, BASE_SHIFT).
+ *
+ * @tparam LOG2E_F_ Fraction bits of the unsigned 1.F log2(e) constant.
+ */
+template<int LOG2E_F_>
+struct bf16_exp_reduction_t {
+    typedef bf16_exp_cfg_t<0, 0, LOG2E_F_> Linear;
+
+    static constexpr int TARGET_MANT_W = Linear::TARGET_MANT_W;
+    static constexpr int TARGET_EXP_BIAS = Linear::TARGET_EXP_BIAS;
+    static constexpr int TARGET_MIN_EXP = Linear::TARGET_MIN_EXP;
+    static constexpr int INPUT_MIN_EXP = Linear::INPUT_MIN_EXP;
+    static constexpr int INPUT_MAX_EXP = Linear::INPUT_MAX_EXP;
+
+    static constexpr int MANT_SRC_I = Linear::MANT_SRC_I;
+    static constexpr int MANT_SRC_F = Linear::MANT_SRC_F;
+    static constexpr int MANT_SRC_W = Linear::MANT_SRC_W;
+
+    static constexpr int LOG2E_I = Linear::LOG2E_I;
+    static constexpr int LOG2E_F = Linear::LOG2E_F;
+    static constexpr int LOG2E_W = Linear::LOG2E_W;
+    static constexpr uint64_t LOG2E_BITS = Linear::LOG2E_BITS;
+    static constexpr int LOG2E_CSD_DIGITS = Linear::LOG2E_CSD_DIGITS;
+    static constexpr uint64_t LOG2E_CSD_POS = Linear::LOG2E_CSD_POS;
+    static constexpr uint64_t LOG2E_CSD_NEG = Linear::LOG2E_CSD_NEG;
+    typedef typename Linear::Rounding Rounding;
+
+    static constexpr int MANT_MULT_I = Linear::MANT_MULT_I;
+    static constexpr int MANT_MULT_F = Linear::MANT_MULT_F;
+    static constexpr int MANT_MULT_W = Linear::MANT_MULT_W;
+
+    static constexpr int IN_I = Linear::IN_I;
+    static constexpr int IN_F = Linear::IN_F;
+    static constexpr int IN_W = Linear::IN_W;
+
+    static constexpr int IN_CONV_INT_W = Linear::IN_CONV_INT_W;
+    static constexpr int IN_CONV_FRAC_W = Linear::IN_CONV_FRAC_W;
+    static constexpr int IN_CONV_W = Linear::IN_CONV_W;
+
+    static constexpr int EXT_MANT_W = Linear::EXT_MANT_W;
+    static constexpr int CARRY_BIT_IDX = Linear::CARRY_BIT_IDX;
+    static constexpr int HIDDEN_BIT_IDX = Linear::HIDDEN_BIT_IDX;
+};
 
-    // Treat result as raw bits for normalization logic
-    ac_int<bf16_cfg::CALC_W, false> res_raw = res.slc<bf16_cfg::CALC_W>(0);
+/**
+ * @brief A complete exp datapath: a width policy plus the coefficient ROM fitted for it.
+ * * ROM holds Widths::LUT_SIZE words of (b << COEFF_W) | a (the coeffs_u64 layout of the
+ * packed headers); log2(e) is the policy's LOG2E_BITS. The cores take a datapath as a
+ * template parameter, so several of them can be instantiated side by side.
+ */
+template<typename Widths, const uint64_t* ROM_>
+struct bf16_exp_datapath_t : Widths {
+    static constexpr int PACKED_W = 2 * Widths::COEFF_W;
+    static constexpr const uint64_t* ROM = ROM_;
+};
+
+/** @brief Committed datapath: 128 x 1.20 coefficients, 1.22 log2(e) (bf16_exp2_packed_coeffs.hpp). */
+typedef bf16_exp_datapath_t<bf16_exp_cfg, bf16_exp2_packed::coeffs_u64> bf16_exp_high_accuracy;
+
+/**
+ * @brief Low-area datapath: 32 x 1.14 coefficients, 1.18 log2(e) (bf16_exp2_low_area_packed_coeffs.hpp).
+ * * 960 ROM bits instead of 5376, a 15x35 instead of 21x39 a*x multiplier and a 8x19 log2(e)
+ * multiplier; worst case 0.5010 ULP for 2^x and 0.5034 ULP for e^x (see dse_bf16_exp).
+ */
+typedef bf16_exp_datapath_t<bf16_exp_cfg_t<bf16_cfg::floor_log2(bf16_exp2_low_area_packed::LUT_SIZE),
+                                           bf16_exp2_low_area_packed::COEFF_F, bf16_exp2_low_area_packed::LOG2E_F>,
+                            bf16_exp2_low_area_packed::coeffs_u64> bf16_exp_low_area;
+
+static_assert(bf16_exp_high_accuracy::PACKED_W == bf16_exp2_packed::PACKED_W &&
+              bf16_exp_low_area::PACKED_W == bf16_exp2_low_area_packed::PACKED_W &&
+              bf16_exp_low_area::LUT_SIZE == bf16_exp2_low_area_packed::LUT_SIZE,
+              "datapath widths must match their coefficient headers");
+
+/**
+ * @brief Constant correction of a truncated multiplier, in units of its lowest kept column.
+ * * Expected value of the dropped partial-product bits for independent, uniformly distributed
+ * operand bits (each bit is set with probability 1/2, so each partial product with 1/4),
+ * rounded to the nearest multiple of 2^trunc_w.
+ *
+ * @param a_w Width of the first operand (rows of partial products).
+ * @param x_w Width of the second operand.
+ * @param trunc_w Number of dropped product columns.
+ */
+constexpr uint64_t bf16_trunc_mult_corr(int a_w, int x_w, int trunc_w) {
+    unsigned __int128 dropped = 0;    // Sum over the dropped columns of (partial products) * 2^column
+    for (int c = 0; c < trunc_w; ++c) {
+        int rows = 0;
+        for (int j = 0; j < a_w; ++j) rows += (c - j >= 0 && c - j < x_w) ? 1 : 0;
+        dropped += static_cast<unsigned __int128>(rows) << c;
+    }
+    return static_cast<uint64_t>((dropped + (static_cast<unsigned __int128>(1) << (trunc_w + 1))) >> (trunc_w + 2));
+}
+
+/**
+ * @brief A linear datapath whose a * x multiplier is truncated.
+ * * Partial-product bits a_j * x_i in the MULT_W - MULT_KEEP_W_ lowest columns (i + j below
+ * MULT_TRUNC_W) are never generated; MULT_CORR_ * 2^MULT_TRUNC_W is added instead to
+ * compensate their expected value. The product keeps MULT_KEEP_W_ columns, so both the
+ * partial-product array and the b - a*x adder below it shrink. ROM and every other width
+ * are those of Datapath.
+ *
+ * @tparam Datapath     Linear datapath (bf16_exp_datapath_t) or width policy.
+ * @tparam MULT_KEEP_W_ Product columns kept, at most Datapath::MULT_W (= full product).
+ * @tparam MULT_CORR_   Correction in units of the lowest kept column (expected dropped value by default).
+ */
+template<typename Datapath, int MULT_KEEP_W_,
+         uint64_t MULT_CORR_ = bf16_trunc_mult_corr(Datapath::COEFF_W, Datapath::IN_W, Datapath::MULT_W - MULT_KEEP_W_)>
+struct bf16_exp_trunc_mult_t : Datapath {
+    static constexpr int MULT_KEEP_W = MULT_KEEP_W_;
+    static constexpr int MULT_TRUNC_W = Datapath::MULT_W - MULT_KEEP_W_;
+    static constexpr uint64_t MULT_CORR = MULT_CORR_;
+
+    static_assert(MULT_KEEP_W_ >= 1 && MULT_KEEP_W_ <= Datapath::MULT_W, "kept columns must be part of the product");
+    static_assert(MULT_CORR_ < (uint64_t(1) << MULT_KEEP_W_), "the correction must fit the kept columns");
+};
+
+/**
+ * @brief Canonical signed-digit (non-adjacent form) recoding of a constant, kept to its
+ * max_digits most significant non-zero digits (all of them for max_digits <= 0).
+ * * Digit i is +1 where bit i of pos is set and -1 where bit i of neg is set; no two
+ * non-zero digits are adjacent, so the recoding has the fewest non-zero digits of any
+ * signed-digit form and the value pos - neg approximates c from the top digits down.
+ */
+struct bf16_csd_t {
+    uint64_t pos;
+    uint64_t neg;
+    int digits;    // Non-zero digits kept
+
+    /** @brief Value of the kept digits. */
+    constexpr uint64_t value() const { return pos - neg; }
+};
+
+constexpr bf16_csd_t bf16_csd_encode(uint64_t c, int max_digits = 0) {
+    // Non-adjacent form, LSB first: a run of ones 0111 becomes 100(-1)
+    uint64_t pos = 0, neg = 0;
+    int total = 0;
+    for (int i = 0; c != 0; ++i, c >>= 1) {
+        if (c & 1) {
+            if ((c & 3) == 3) {
+                neg |= uint64_t(1) << i;
+                c += 1;
+            } else {
+                pos |= uint64_t(1) << i;
+                c -= 1;
+            }
+            total++;
+        }
+    }
+
+    // Keep the most significant max_digits
+    bf16_csd_t csd = {pos, neg, total};
+    if (max_digits > 0 && max_digits < total) {
+        csd = {0, 0, 0};
+        for (int i = 63; i >= 0 && csd.digits < max_digits; --i) {
+            if ((pos >> i) & 1) csd.pos |= uint64_t(1) << i;
+            if ((neg >> i) & 1) csd.neg |= uint64_t(1) << i;
+            if (((pos | neg) >> i) & 1) csd.digits++;
+        }
+    }
+    return csd;
+}
+
+/**
+ * @brief A datapath whose log2(e) multiplier (Base::E range reduction) is a shift-and-add
+ * of mant_src over the LOG2E_CSD_DIGITS_ most significant canonical signed digits of
+ * LOG2E_CONST_: LOG2E_CSD_DIGITS_ - 1 adders/subtractors instead of a MANT_SRC_W x LOG2E_W
+ * multiplier. With every digit of LOG2E_BITS kept the product is exactly the general
+ * multiplier's; otherwise it is mant_src times LOG2E_CSD_POS - LOG2E_CSD_NEG (a truncated
+ * recoding, or a nearby constant with fewer digits found by dse_bf16_csd_log2e).
+ *
+ * @tparam Datapath          Any exp datapath or width policy (linear, quadratic, multipartite).
+ * @tparam LOG2E_CSD_DIGITS_ Non-zero digits kept (>= 1).
+ * @tparam LOG2E_CONST_      Constant to recode, in LOG2E_F fraction bits (LOG2E_BITS by default).
+ */
+template<typename Datapath, int LOG2E_CSD_DIGITS_, uint64_t LOG2E_CONST_ = Datapath::LOG2E_BITS>
+struct bf16_exp_csd_log2e_t : Datapath {
+    static constexpr bf16_csd_t CSD = bf16_csd_encode(LOG2E_CONST_, LOG2E_CSD_DIGITS_);
+
+    static constexpr int LOG2E_CSD_DIGITS = CSD.digits;
+    static constexpr uint64_t LOG2E_CSD_POS = CSD.pos;
+    static constexpr uint64_t LOG2E_CSD_NEG = CSD.neg;
+
+    static_assert(LOG2E_CSD_DIGITS_ >= 1, "a shift-and-add needs at least one digit");
+    static_assert((CSD.pos | CSD.neg) >> (Datapath::LOG2E_W + 1) == 0, "CSD digits extend at most one bit above the constant");
+};
+
+/**
+ * @brief A datapath with another rounding policy in its BF16 back end (bf16_round_rne,
+ * bf16_round_rtz, bf16_round_half_away or bf16_round_stochastic<Lfsr>).
+ *
+ * @tparam Datapath  Any exp datapath or width policy (linear, quadratic, multipartite).
+ * @tparam Rounding_ Rounding policy.
+ */
+template<typename Datapath, typename Rounding_>
+struct bf16_exp_rounding_t : Datapath {
+    typedef Rounding_ Rounding;
+};
+
+/** @brief Exponential base, selected at compile time by the templated datapaths. */
+enum class Base {
+    Two, // 2^x
+    E,   // e^x (range reduction multiplies by log2(e))
+};
+
+/** @brief Input fixed-point mantissa of a datapath. */
+template<typename Cfg>
+using mant_of_t = ac_fixed<Cfg::IN_W, Cfg::IN_I, false>;
+
+/** @brief Input fixed-point mantissa of the committed datapath. */
+typedef mant_of_t<bf16_exp_high_accuracy> mant_t;
+
+/** @brief Structure holding normalized polynomial result. */
+template<typename Cfg = bf16_exp_high_accuracy>
+struct PolyResultT {
+    ac_fixed<Cfg::POLY_OUT_W, Cfg::POLY_OUT_I, false> mantissa;
+    int32_t exponent;
+};
 
+typedef PolyResultT<> PolyResult;
+
+/**
+ * @brief Normalization stage shared by the approximation engines: finds the MSB of the
+ * CALC_W-bit result (CALC_F fraction bits) and left-aligns it into POLY_OUT_W bits.
+ *
+ * @tparam Cfg Datapath (CALC_W, POLY_OUT_W and POLY_OUT_F).
+ * @param res_raw Raw bits of the (non-negative) polynomial result.
+ * @return Normalized PolyResult containing mantissa and exponent.
+ */
+template<typename Cfg>
+inline PolyResultT<Cfg> bf16_exp_normalize(const ac_int<Cfg::CALC_W, false>& res_raw) {
     // 1. Priority Encoder (Find MSB)
     // Standard HLS pattern that synthesizes into fast combinational logic.
     int msb_idx = -1;
-    for (int i = bf16_cfg::CALC_W - 1; i >= 0; --i) {
+    for (int i = Cfg::CALC_W - 1; i >= 0; --i) {
         if (res_raw[i]) {
             msb_idx = i;
             break;
         }
     }
 
-    PolyResult result;
+    PolyResultT<Cfg> result;
     // Calculate exponent relative to format
-    result.exponent = msb_idx - bf16_cfg::POLY_OUT_F;
+    result.exponent = msb_idx - Cfg::POLY_OUT_F;
 
     // 2. Normalization (Barrel Shifter + Slice)
     // Aligns MSB to the left (position CALC_W - 1) to maximize precision.
-    int shift = (bf16_cfg::CALC_W - 1) - msb_idx;
+    int shift = (Cfg::CALC_W - 1) - msb_idx;
 
     // Barrel Shifting
-    ac_int<bf16_cfg::CALC_W, false> normalized = res_raw << shift;
+    ac_int<Cfg::CALC_W, false> normalized = res_raw << shift;
 
     // Slicing: Extract POLY_OUT_W most significant bits
-    result.mantissa.set_slc(0, normalized.slc<bf16_cfg::POLY_OUT_W>(bf16_cfg::CALC_W - bf16_cfg::POLY_OUT_W));
+    result.mantissa.set_slc(0, normalized.template slc<Cfg::POLY_OUT_W>(Cfg::CALC_W - Cfg::POLY_OUT_W));
 
     return result;
 }
 
 /**
- * @brief Core hardware-accurate approximation of exp(x) (base e) or exp2(x) (base 2).
- * * Handles input decomposition, range reduction to [0, 1], polynomial evaluation,
- * and standard BF16 rounding (Round to Nearest Even).
- * * @param input_parts Decomposed BF16 input structure.
- * @param base2 If true, calculates 2^x. If false, calculates e^x.
- * @return Decomposed BF16 result structure.
+ * @brief The a * x multiplier of the linear engine.
+ * * Full product when Cfg::MULT_TRUNC_W is 0. Otherwise a truncated multiplier: each row
+ * a_j * x only generates the partial-product bits of the kept columns (x with its
+ * MULT_TRUNC_W - j low bits cleared), and the correction constant is added at the lowest
+ * kept column. The row loop unrolls into the reduced partial-product array.
+ *
+ * @tparam Cfg Linear width policy (COEFF_W, IN_W, MULT_W, MULT_TRUNC_W and MULT_CORR).
+ * @param a_fixed Slope coefficient.
+ * @param mant_val Input value in fixed-point format.
+ * @return Product in the MULT_W-bit format (low MULT_TRUNC_W bits zero when truncated).
  */
-inline FPRaw bf16_exp2_core_approx(const FPRaw& input_parts, bool base2 = true) {
-    FPRaw result = {};
-    mant_t mant_val = 0;
+template<typename Cfg>
+inline ac_fixed<Cfg::MULT_W, Cfg::MULT_I, false> bf16_exp_mult_ax(const ac_fixed<Cfg::COEFF_W, Cfg::COEFF_I, false>& a_fixed,
+                                                                  const mant_of_t<Cfg>& mant_val) {
+    ac_fixed<Cfg::MULT_W, Cfg::MULT_I, false> ax_u;
+    if constexpr (Cfg::MULT_TRUNC_W == 0) {
+        ax_u = a_fixed * mant_val;
+    } else {
+        ac_int<Cfg::COEFF_W, false> a_bits = a_fixed.template slc<Cfg::COEFF_W>(0);
+        ac_int<Cfg::IN_W, false> x_bits = mant_val.template slc<Cfg::IN_W>(0);
+
+        ac_int<Cfg::MULT_W, false> ax_bits = Cfg::MULT_CORR;
+        ax_bits <<= Cfg::MULT_TRUNC_W;
+        for (int j = 0; j < Cfg::COEFF_W; ++j) {
+            const int drop = Cfg::MULT_TRUNC_W - j;    // x bits whose column is dropped in row j
+            if (!a_bits[j] || drop >= Cfg::IN_W) continue;
+            ac_int<Cfg::IN_W, false> row = x_bits;
+            if (drop > 0) {
+                row >>= drop;
+                row <<= drop;
+            }
+            ac_int<Cfg::MULT_W, false> shifted = row;
+            ax_bits = ax_bits + (shifted << j);
+        }
+        ax_u.set_slc(0, ax_bits);
+    }
+    return ax_u;
+}
+
+/**
+ * @brief Evaluates one line of the linear engine, b - a * x, and normalizes the result.
+ * * Shared by the uniform LUT (bf16_exp2_poly) and the non-uniform segmentation, which
+ * differ only in how the coefficient word is addressed.
+ *
+ * @tparam Cfg Linear width policy (COEFF_W, MULT_*, CALC_*).
+ * @param packed Coefficient word (b << COEFF_W) | a.
+ * @param mant_val Input value in fixed-point format.
+ * @return Normalized PolyResult containing mantissa and exponent.
+ */
+template<typename Cfg>
+inline PolyResultT<Cfg> bf16_exp2_line(const ac_int<2 * Cfg::COEFF_W, false>& packed, mant_of_t<Cfg> mant_val) {
+    typedef ac_fixed<Cfg::COEFF_W, Cfg::COEFF_I, false> coeff_t;
+    typedef ac_fixed<Cfg::CALC_W, Cfg::CALC_I, true> calc_t;
+
+    coeff_t a_fixed;
+    a_fixed.set_slc(0, packed.template slc<Cfg::COEFF_W>(0));
+    coeff_t b_fixed;
+    b_fixed.set_slc(0, packed.template slc<Cfg::COEFF_W>(Cfg::COEFF_W));
+
+    // Perform multiplication: a * x
+    ac_fixed<Cfg::MULT_W, Cfg::MULT_I, false> ax_u = bf16_exp_mult_ax<Cfg>(a_fixed, mant_val);
+
+    // Negate and cast to signed type: -ax
+    calc_t ax_s = - (calc_t)ax_u;
+
+    // Add offset: res = b + (-ax)
+    calc_t res = ax_s + (calc_t)b_fixed;
+
+    // Treat result as raw bits for normalization logic
+    ac_int<Cfg::CALC_W, false> res_raw = res.template slc<Cfg::CALC_W>(0);
+
+    return bf16_exp_normalize<Cfg>(res_raw);
+}
+
+/**
+ * @brief Calculates 2^(-x) using piecewise linear approximation for x in [0, 1].
+ * * Formula: result = a * (-x) + b
+ * Uses a Look-Up Table (LUT) for coefficients 'a' and 'b' based on the leading
+ * bits of the input fractional part.
+ * * @tparam Cfg Datapath (widths and coefficient ROM), bf16_exp_high_accuracy by default.
+ * @param mant_val Input value in fixed-point format.
+ * @return Normalized PolyResult containing mantissa and exponent.
+ */
+template<typename Cfg = bf16_exp_high_accuracy>
+inline PolyResultT<Cfg> bf16_exp2_poly(mant_of_t<Cfg> mant_val) {
+    // Extract LUT index from the MSBs of the fractional part
+    uint8_t lut_index = mant_val.template slc<Cfg::LUT_ADDR_W>(Cfg::IN_F - Cfg::LUT_ADDR_W);
+
+    // Fetch coefficients based on the inverted index for the 2^-x mapping
+    int idx = Cfg::LUT_MAX_IDX - lut_index;
+    ac_int<Cfg::PACKED_W, false> packed = Cfg::ROM[idx];
+
+    return bf16_exp2_line<Cfg>(packed, mant_val);
+}
+
+/**
+ * @brief Range reduction of the exp datapath.
+ * * Splits x (times log2(e) for Base::E) into the fraction fed to the polynomial and the
+ * negated integer part that becomes the result exponent. Shared by every approximation
+ * engine of the reduced argument.
+ *
+ * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Datapath (reduction widths and log2(e)).
+ * @param input_parts Decomposed BF16 input structure.
+ * @param mant_val Output: fraction of the reduced argument (IN_F fractional bits).
+ * @return exponent_bias (minus the integer part).
+ */
+template<Base B, typename Cfg>
+inline int32_t bf16_exp_reduce(const FPRaw& input_parts, mant_of_t<Cfg>& mant_val) {
     int32_t temp_exponent = input_parts.exponent;
-    int32_t exponent_bias = 0;
 
     // Convert input to fixed-point format
     // Unified format
-    typedef ac_fixed<bf16_cfg::IN_CONV_INT_W + bf16_cfg::IN_F, bf16_cfg::IN_CONV_INT_W, false> unified_t;
+    typedef ac_fixed<Cfg::IN_CONV_INT_W + Cfg::IN_F, Cfg::IN_CONV_INT_W, false> unified_t;
     unified_t val = 0;
 
     // 1. Prepare Mantissa
-    ac_fixed<bf16_cfg::MANT_SRC_W, bf16_cfg::MANT_SRC_I, false> mant_src;
-    mant_src[bf16_cfg::MANT_SRC_W - 1] = 1; // Hidden bit
-    mant_src.set_slc(0, (ac_int<bf16_cfg::TARGET_MANT_W, false>)input_parts.mantissa);
-
-    // 2. Multiply by log2(e)
-    // log2(e) ~= 1.442695
-    ac_fixed<bf16_cfg::LOG2E_W, bf16_cfg::LOG2E_I, false> log2e_const;
-    log2e_const.set_slc(0, bf16_exp2_packed::log2e_int_val);
+    ac_fixed<Cfg::MANT_SRC_W, Cfg::MANT_SRC_I, false> mant_src;
+    mant_src[Cfg::MANT_SRC_W - 1] = 1; // Hidden bit
+    mant_src.set_slc(0, (ac_int<Cfg::TARGET_MANT_W, false>)input_parts.mantissa);
 
-    // Result is in fixed-point format
-    ac_fixed<bf16_cfg::MANT_MULT_W, bf16_cfg::MANT_MULT_I, false> mant_mult = mant_src * log2e_const;
-
-    // 3. Move to Unified Format
+    // 2./3. Move to Unified Format
     // We need integer bits because the maximum negative exponent is defined in config,
     // so the shift will be calculated. The multiplication result has integer bits defined in config.
-    val = base2 ? (unified_t)mant_src : (unified_t)mant_mult;
+    if constexpr (B == Base::E) {
+        // Multiply by log2(e)
+        // log2(e) ~= 1.442695
+        ac_fixed<Cfg::LOG2E_W, Cfg::LOG2E_I, false> log2e_const;
+        log2e_const.set_slc(0, ac_int<Cfg::LOG2E_W, false>(Cfg::LOG2E_BITS));
+
+        // Result is in fixed-point format
+        ac_fixed<Cfg::MANT_MULT_W, Cfg::MANT_MULT_I, false> mant_mult;
+        if constexpr (Cfg::LOG2E_CSD_DIGITS == 0) {
+            mant_mult = mant_src * log2e_const;
+        } else {
+            // Shift-and-add over the signed digits of the constant (one adder per extra digit)
+            ac_int<Cfg::MANT_SRC_W, false> src_bits = mant_src.template slc<Cfg::MANT_SRC_W>(0);
+            ac_int<Cfg::MANT_MULT_W, false> acc = 0;
+            for (int i = 0; i <= Cfg::LOG2E_W; ++i) {
+                ac_int<Cfg::MANT_MULT_W, false> term = src_bits;
+                term <<= i;
+                if ((Cfg::LOG2E_CSD_POS >> i) & 1) acc = acc + term;
+                if ((Cfg::LOG2E_CSD_NEG >> i) & 1) acc = acc - term;
+            }
+            mant_mult.set_slc(0, acc);
+        }
+        val = (unified_t)mant_mult;
+    } else {
+        val = (unified_t)mant_src;
+    }
 
     // Shift based on exponent
     if (temp_exponent >= 0) {
@@ -220,72 +722,99 @@ inline FPRaw bf16_exp2_core_approx(const FPRaw& input_parts, bool base2 = true)
 
     // Extract fractional part for polynomial approximation
     mant_val = 0;
-    mant_val.set_slc(0, val.slc<bf16_cfg::IN_F>(0));
+    mant_val.set_slc(0, val.template slc<Cfg::IN_F>(0));
 
     // Integer part determines the final exponent shift
-    exponent_bias = -(int)val.to_int();
-
-    // Call polynomial approximation
-    PolyResult poly_res = bf16_exp2_poly(mant_val);
-
-    int32_t final_exponent = poly_res.exponent + exponent_bias;
-    ac_int<bf16_cfg::POLY_OUT_W, false> full_mant = poly_res.mantissa.slc<bf16_cfg::POLY_OUT_W>(0);
+    return -(int)val.to_int();
+}
 
+/**
+ * @brief Rounding back end of the exp datapath: rounds a normalized POLY_OUT_W-bit mantissa
+ * (value in [1, 2), POLY_OUT_F fraction bits) with exponent final_exponent to BF16,
+ * including gradual underflow, in the direction of Cfg::Rounding (RNE by default).
+ * Shared by every approximation engine.
+ *
+ * @tparam Cfg Datapath (POLY_OUT_W, BASE_SHIFT, the BF16 target fields and Rounding).
+ * @param m_raw Normalized mantissa bits.
+ * @param final_exponent Unbiased exponent of the result.
+ * @return Decomposed BF16 result structure.
+ */
+template<typename Cfg>
+inline FPRaw bf16_exp_round(const ac_int<Cfg::POLY_OUT_W, false>& m_raw, int32_t final_exponent) {
     // 1. Alignment Logic for Rounding
     // Check if the result falls into subnormal range for BF16
-    bool is_sub = (final_exponent < bf16_cfg::TARGET_MIN_EXP);
+    bool is_sub = (final_exponent < Cfg::TARGET_MIN_EXP);
 
     // shift_val: number of bits discarded to the right during rounding
-    int shift_val = bf16_cfg::BASE_SHIFT + (is_sub ? (bf16_cfg::TARGET_MIN_EXP - final_exponent) : 0);
-
-    // 2. Rounding Bit Extraction (RNE Logic)
-    ac_int<bf16_cfg::POLY_OUT_W, false> m_raw = full_mant;
+    int shift_val = Cfg::BASE_SHIFT + (is_sub ? (Cfg::TARGET_MIN_EXP - final_exponent) : 0);
 
-    bool lsb_bit = (shift_val < bf16_cfg::POLY_OUT_W) ? (bool)m_raw[shift_val] : false;
-    bool guard_bit = (shift_val > 0 && shift_val <= bf16_cfg::POLY_OUT_W) ? (bool)m_raw[shift_val - 1] : false;
+    // 2. Rounding Bit Extraction (lsb / guard / sticky)
+    bool lsb_bit = (shift_val < Cfg::POLY_OUT_W) ? (bool)m_raw[shift_val] : false;
+    bool guard_bit = (shift_val > 0 && shift_val <= Cfg::POLY_OUT_W) ? (bool)m_raw[shift_val - 1] : false;
 
     bool sticky_bit = false;
     if (shift_val > 1) {
-        if (shift_val > bf16_cfg::POLY_OUT_W) {
+        if (shift_val > Cfg::POLY_OUT_W) {
             sticky_bit = (m_raw != 0);
         } else {
-            ac_int<bf16_cfg::POLY_OUT_W, false> mask = (ac_int<bf16_cfg::POLY_OUT_W, false>(1) << (shift_val - 1)) - 1;
+            ac_int<Cfg::POLY_OUT_W, false> mask = (ac_int<Cfg::POLY_OUT_W, false>(1) << (shift_val - 1)) - 1;
             sticky_bit = (m_raw & mask) != 0;
         }
     }
 
-    // Determine if we should round up based on Round-to-Nearest-Even (RNE)
-    bool round_up = guard_bit && (lsb_bit || sticky_bit);
+    // Rounding decision inputs of the Cfg::Rounding policy (RNE, RTZ, half away or stochastic)
+    typedef typename Cfg::Rounding Rounding;
+    ac_int<64, false> discarded = 0;
+    if constexpr (Rounding::MODE == RoundMode::Stochastic) {
+        // Top RAND_W discarded bits, the fraction compared against the random bits
+        constexpr int RAND_W = Rounding::RAND_W;
+        ac_int<Cfg::POLY_OUT_W, false> below = m_raw;
+        if (shift_val < Cfg::POLY_OUT_W) {
+            ac_int<Cfg::POLY_OUT_W, false> mask = (ac_int<Cfg::POLY_OUT_W, false>(1) << shift_val) - 1;
+            below = below & mask;
+        }
+        if (shift_val >= RAND_W) {
+            if (shift_val - RAND_W < Cfg::POLY_OUT_W) discarded = (ac_int<RAND_W, false>)(below >> (shift_val - RAND_W));
+        } else {
+            ac_int<Cfg::POLY_OUT_W + RAND_W, false> widened = below;
+            discarded = (ac_int<RAND_W, false>)(widened << (RAND_W - shift_val));
+        }
+    }
 
     // 3. Shift and Round
-    ac_int<bf16_cfg::EXT_MANT_W, false> result_m_ext = 0;
-    if (shift_val < bf16_cfg::POLY_OUT_W) {
-        result_m_ext = (ac_int<bf16_cfg::EXT_MANT_W, false>)(m_raw >> shift_val);
+    ac_int<Cfg::EXT_MANT_W, false> result_m_ext = 0;
+    if (shift_val < Cfg::POLY_OUT_W) {
+        result_m_ext = (ac_int<Cfg::EXT_MANT_W, false>)(m_raw >> shift_val);
     }
-    if (round_up) result_m_ext++;
-
-    // 4. Post-rounding Normalization
-    // Adjust exponent if rounding caused an overflow (carry-out bit)
-    int32_t adjusted_exp = is_sub ? bf16_cfg::TARGET_MIN_EXP : final_exponent;
-    if (result_m_ext[bf16_cfg::CARRY_BIT_IDX]) {
-        adjusted_exp++;
-        result_m_ext >>= 1;
+    int32_t adjusted_exp = is_sub ? Cfg::TARGET_MIN_EXP : final_exponent;
+    if constexpr (Rounding::MODE != RoundMode::TowardZero) {
+        // RTZ has no incrementer, so it never evaluates the decision (nor steps the LFSR)
+        bool round_up = bf16_round_up<Rounding>(lsb_bit, guard_bit, sticky_bit, discarded.to_uint64());
+        if (round_up) result_m_ext++;
+
+        // 4. Post-rounding Normalization
+        // Adjust exponent if rounding caused an overflow (carry-out bit); truncation never carries
+        if (result_m_ext[Cfg::CARRY_BIT_IDX]) {
+            adjusted_exp++;
+            result_m_ext >>= 1;
+        }
     }
 
     // 5. Final BF16 Structure Formation
+    FPRaw result = {};
     result.sign = 0;
     if (result_m_ext == 0) {
         result.status.is_zero = true;
         result.exponent = 0;
-    } else if (is_sub && !result_m_ext[bf16_cfg::HIDDEN_BIT_IDX]) {
+    } else if (is_sub && !result_m_ext[Cfg::HIDDEN_BIT_IDX]) {
         // Result is a denormal number
-        result.mantissa = result_m_ext.slc<bf16_cfg::TARGET_MANT_W>(0);
+        result.mantissa = result_m_ext.template slc<Cfg::TARGET_MANT_W>(0);
         result.hidden_bit = 0;
-        result.exponent = bf16_cfg::TARGET_MIN_EXP - 1;
+        result.exponent = Cfg::TARGET_MIN_EXP - 1;
         result.status.is_denormal = true;
     } else {
         // Result is a normal number
-        result.mantissa = result_m_ext.slc<bf16_cfg::TARGET_MANT_W>(0);
+        result.mantissa = result_m_ext.template slc<Cfg::TARGET_MANT_W>(0);
         result.hidden_bit = 1;
         result.exponent = adjusted_exp;
         result.status.is_denormal = false;
@@ -294,4 +823,37 @@ inline FPRaw bf16_exp2_core_approx(const FPRaw& input_parts, bool base2 = true)
     return result;
 }
 
+/**
+ * @brief Core hardware-accurate approximation of exp(x) (base e) or exp2(x) (base 2).
+ * * Handles input decomposition, range reduction to [0, 1], polynomial evaluation,
+ * and BF16 rounding with the Cfg::Rounding policy (RNE for the committed datapaths).
+ * The base is a template parameter: Base::Two has no log2(e) multiplier and no
+ * source-select mux, so each instantiation is a separate, leaner datapath.
+ * * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Datapath (widths, coefficient ROM and log2(e)), bf16_exp_high_accuracy by default.
+ * @param input_parts Decomposed BF16 input structure.
+ * @return Decomposed BF16 result structure.
+ */
+template<Base B, typename Cfg = bf16_exp_high_accuracy>
+inline FPRaw bf16_exp_core_approx(const FPRaw& input_parts) {
+    mant_of_t<Cfg> mant_val = 0;
+    int32_t exponent_bias = bf16_exp_reduce<B, Cfg>(input_parts, mant_val);
+
+    // Call polynomial approximation
+    PolyResultT<Cfg> poly_res = bf16_exp2_poly<Cfg>(mant_val);
+
+    int32_t final_exponent = poly_res.exponent + exponent_bias;
+    return bf16_exp_round<Cfg>(poly_res.mantissa.template slc<Cfg::POLY_OUT_W>(0), final_exponent);
+}
+
+/**
+ * @brief Runtime-base wrapper around bf16_exp_core_approx (kept for compatibility).
+ * * @param input_parts Decomposed BF16 input structure.
+ * @param base2 If true, calculates 2^x. If false, calculates e^x.
+ * @return Decomposed BF16 result structure.
+ */
+inline FPRaw bf16_exp2_core_approx(const FPRaw& input_parts, bool base2 = true) {
+    return base2 ? bf16_exp_core_approx<Base::Two>(input_parts) : bf16_exp_core_approx<Base::E>(input_parts);
+}
+
 #endif // BF16_EXP2_CORE_HPP
\ No newline at end of file
@@ -0,0 +1,355 @@
+#ifndef BF16_EXP2_CORE_NATIVE_HPP
+#define BF16_EXP2_CORE_NATIVE_HPP
+
+#include "bf16_exp2_core.hpp"
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @namespace bf16_native
+ * @brief Native-integer helpers for the fast simulation model of the exp core.
+ * * The fast model mirrors bf16_exp2_poly / bf16_exp2_core_approx bit for bit, but uses
+ * uint64_t (or unsigned __int128 when CALC_W does not fit) instead of ac_fixed/ac_int,
+ * and __builtin_clzll instead of the bit-serial priority encoder loop.
+ * All positions and widths come from a datapath (bf16_exp_datapath_t, the committed
+ * bf16_exp_high_accuracy by default) or a bare width policy (bf16_exp_cfg_t) plus an
+ * explicit ROM, so several configurations can be simulated in one binary.
+ */
+namespace bf16_native {
+    /** @brief Carrier for CALC_W / POLY_OUT_W wide values of a configuration. */
+    template<typename Cfg>
+    using calc_uint = typename std::conditional<(Cfg::CALC_W > 64), unsigned __int128, uint64_t>::type;
+
+    /** @brief Carrier for the committed configuration. */
+    typedef calc_uint<bf16_exp_cfg> calc_uint_t;
+
+    /** @brief Carrier for the unified (range reduced) input value. */
+    typedef uint64_t unified_uint_t;
+
+    /** @brief Width of the unified input format. */
+    template<typename Cfg>
+    constexpr int unified_w() {
+        return Cfg::IN_CONV_INT_W + Cfg::IN_F;
+    }
+
+    constexpr int UNIFIED_W = unified_w<bf16_exp_cfg>();
+
+    /** @brief Compile-time limits of the native carriers. */
+    template<typename Cfg>
+    struct check_cfg {
+        static_assert(unified_w<Cfg>() <= 64, "Native model expects the unified input format to fit in 64 bits");
+        static_assert(Cfg::MANT_MULT_W <= 64, "Native model expects mant_src * log2(e) to fit in 64 bits");
+        static_assert(Cfg::CALC_W <= 128, "Native model supports CALC_W up to 128 bits");
+        static_assert(Cfg::COEFF_W <= 32, "Native model packs two coefficients in one 64-bit ROM word");
+        static constexpr bool value = true;
+    };
+
+    /**
+     * @brief ROM used when none is passed: the datapath's own, or the committed one for
+     * bf16_exp_cfg. Other bare width policies must pass their ROM explicitly.
+     */
+    template<typename Cfg, typename = void>
+    struct default_rom {
+        static_assert(std::is_same<Cfg, bf16_exp_cfg>::value, "a width policy without a ROM needs an explicit rom argument");
+        static constexpr const uint64_t* value = bf16_exp2_packed::coeffs_u64;
+    };
+
+    template<typename Cfg>
+    struct default_rom<Cfg, std::void_t<decltype(Cfg::ROM)>> {
+        static constexpr const uint64_t* value = Cfg::ROM;
+    };
+
+    /** @brief Returns a mask of W ones in the carrier type T (W may equal the width of T). */
+    template<typename T>
+    constexpr T ones(int w) {
+        return (w >= static_cast<int>(8 * sizeof(T))) ? ~T(0) : ((T(1) << w) - 1);
+    }
+
+    /** @brief Priority encoder: index of the most significant set bit, -1 for zero. */
+    inline int msb_index(uint64_t v) {
+        return v ? 63 - __builtin_clzll(v) : -1;
+    }
+
+    inline int msb_index(unsigned __int128 v) {
+        uint64_t hi = static_cast<uint64_t>(v >> 64);
+        return hi ? 127 - __builtin_clzll(hi) : msb_index(static_cast<uint64_t>(v));
+    }
+}
+
+/** @brief Native counterpart of PolyResult (mantissa holds POLY_OUT_W raw bits). */
+template<typename Cfg = bf16_exp_high_accuracy>
+struct PolyResultNativeT {
+    bf16_native::calc_uint<Cfg> mantissa;
+    int32_t exponent;
+};
+
+typedef PolyResultNativeT<> PolyResultNative;
+
+/**
+ * @brief Native-integer model of bf16_exp_normalize.
+ * * @tparam Cfg Datapath or width policy (CALC_W, POLY_OUT_W and POLY_OUT_F).
+ * @param res Raw CALC_W-bit polynomial result.
+ * @return Normalized result, bit-identical to bf16_exp_normalize.
+ */
+template<typename Cfg>
+inline PolyResultNativeT<Cfg> bf16_exp_normalize_native(bf16_native::calc_uint<Cfg> res) {
+    typedef bf16_native::calc_uint<Cfg> calc_uint_t;
+    using bf16_native::ones;
+
+    // 1. Priority Encoder (Find MSB)
+    int msb_idx = bf16_native::msb_index(res);
+
+    PolyResultNativeT<Cfg> result;
+    result.exponent = msb_idx - Cfg::POLY_OUT_F;
+
+    // 2. Normalization: align MSB to position CALC_W - 1, keep POLY_OUT_W MSBs
+    calc_uint_t normalized = 0;
+    if (msb_idx >= 0) {
+        normalized = (res << ((Cfg::CALC_W - 1) - msb_idx)) & ones<calc_uint_t>(Cfg::CALC_W);
+    }
+    result.mantissa = normalized >> (Cfg::CALC_W - Cfg::POLY_OUT_W);
+
+    return result;
+}
+
+/**
+ * @brief Native-integer model of bf16_exp_mult_ax (full or truncated a * x).
+ * * @tparam Cfg Linear datapath or width policy.
+ * @param a Slope coefficient bits (COEFF_W).
+ * @param x Input fraction bits (IN_W).
+ * @return MULT_W-bit product, bit-identical to bf16_exp_mult_ax.
+ */
+template<typename Cfg>
+inline bf16_native::calc_uint<Cfg> bf16_exp_mult_ax_native(uint64_t a, uint64_t x) {
+    typedef bf16_native::calc_uint<Cfg> calc_uint_t;
+    using bf16_native::ones;
+
+    if constexpr (Cfg::MULT_TRUNC_W == 0) {
+        return static_cast<calc_uint_t>(a) * x;
+    } else {
+        calc_uint_t ax = static_cast<calc_uint_t>(Cfg::MULT_CORR) << Cfg::MULT_TRUNC_W;
+        for (int j = 0; j < Cfg::COEFF_W; ++j) {
+            const int drop = Cfg::MULT_TRUNC_W - j;
+            if (!((a >> j) & 1) || drop >= Cfg::IN_W) continue;
+            ax += static_cast<calc_uint_t>(drop > 0 ? (x & ~ones<uint64_t>(drop)) : x) << j;
+        }
+        return ax & ones<calc_uint_t>(Cfg::MULT_W);
+    }
+}
+
+/**
+ * @brief Native-integer model of the b - a*x subtraction of bf16_exp2_line.
+ * * @tparam Cfg Linear datapath or width policy.
+ * @param b Intercept coefficient bits (COEFF_W).
+ * @param ax Product from bf16_exp_mult_ax_native (MULT_F fractional bits).
+ * @return Raw CALC_W-bit result at CALC_F (wraps like calc_t).
+ */
+template<typename Cfg>
+inline bf16_native::calc_uint<Cfg> bf16_exp_line_sub_native(uint64_t b, bf16_native::calc_uint<Cfg> ax) {
+    typedef bf16_native::calc_uint<Cfg> calc_uint_t;
+    using bf16_native::ones;
+
+    return ((static_cast<calc_uint_t>(b) << (Cfg::CALC_F - Cfg::COEFF_F)) -
+            (ax << (Cfg::CALC_F - Cfg::MULT_F))) & ones<calc_uint_t>(Cfg::CALC_W);
+}
+
+/**
+ * @brief Native-integer model of bf16_exp2_line.
+ * * @tparam Cfg Linear datapath or width policy.
+ * @param packed Coefficient word (b << COEFF_W) | a.
+ * @param mant_val Input fraction as raw bits of mant_t (IN_F fractional bits).
+ * @return Normalized result, bit-identical to bf16_exp2_line.
+ */
+template<typename Cfg>
+inline PolyResultNativeT<Cfg> bf16_exp2_line_native(uint64_t packed, uint64_t mant_val) {
+    typedef bf16_native::calc_uint<Cfg> calc_uint_t;
+    using bf16_native::ones;
+
+    uint64_t a = packed & ones<uint64_t>(Cfg::COEFF_W);
+    uint64_t b = (packed >> Cfg::COEFF_W) & ones<uint64_t>(Cfg::COEFF_W);
+
+    // a * x at MULT_F, then b - a*x at CALC_F (wraps at CALC_W like calc_t)
+    calc_uint_t ax = bf16_exp_mult_ax_native<Cfg>(a, mant_val & ones<uint64_t>(Cfg::IN_W));
+    calc_uint_t res = bf16_exp_line_sub_native<Cfg>(b, ax);
+
+    return bf16_exp_normalize_native<Cfg>(res);
+}
+
+/**
+ * @brief Native-integer model of bf16_exp2_poly.
+ * * @tparam Cfg Datapath or width policy (bf16_exp_high_accuracy by default).
+ * @param mant_val Input fraction as raw bits of mant_t (IN_F fractional bits).
+ * @param rom Packed coefficient ROM (Cfg::LUT_SIZE words of (b << COEFF_W) | a, laid out
+ *            like coeffs_u64). Coefficient fitters pass candidate ROMs here; by default
+ *            the ROM of the datapath (see bf16_native::default_rom).
+ * @return Normalized result, bit-identical to bf16_exp2_poly.
+ */
+template<typename Cfg = bf16_exp_high_accuracy>
+inline PolyResultNativeT<Cfg> bf16_exp2_poly_native(uint64_t mant_val, const uint64_t* rom = bf16_native::default_rom<Cfg>::value) {
+    static_assert(bf16_native::check_cfg<Cfg>::value, "unsupported configuration");
+
+    // Extract LUT index from the MSBs of the fractional part
+    int lut_index = static_cast<int>((mant_val >> (Cfg::IN_F - Cfg::LUT_ADDR_W)) & Cfg::LUT_MAX_IDX);
+
+    // Fetch coefficients based on the inverted index for the 2^-x mapping
+    return bf16_exp2_line_native<Cfg>(rom[Cfg::LUT_MAX_IDX - lut_index], mant_val);
+}
+
+/**
+ * @brief Native-integer model of the range reduction in bf16_exp_core_approx.
+ * * Splits x (times log2(e) for Base::E) into the fraction fed to the polynomial and the
+ * negated integer part that becomes the result exponent.
+ *
+ * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Datapath or width policy.
+ * @param input_parts Decomposed BF16 input structure.
+ * @param mant_val Output: fraction as raw bits of mant_t (IN_F fractional bits).
+ * @return exponent_bias (minus the integer part).
+ */
+template<Base B, typename Cfg = bf16_exp_high_accuracy>
+inline int32_t bf16_exp_reduce_native(const FPRaw& input_parts, uint64_t& mant_val) {
+    using bf16_native::unified_uint_t;
+    using bf16_native::ones;
+
+    int32_t temp_exponent = input_parts.exponent;
+
+    // 1. Prepare Mantissa (hidden bit + TARGET_MANT_W bits)
+    uint64_t mant_src = (uint64_t(1) << Cfg::MANT_SRC_F) |
+                        (input_parts.mantissa & ones<uint64_t>(Cfg::TARGET_MANT_W));
+
+    // 2./3. Optionally multiply by log2(e), then move to the unified format
+    unified_uint_t val;
+    if constexpr (B == Base::E) {
+        // General multiplier or shift-and-add: both are mant_src * (POS - NEG)
+        uint64_t mant_mult = (mant_src * (Cfg::LOG2E_CSD_POS - Cfg::LOG2E_CSD_NEG)) & ones<uint64_t>(Cfg::MANT_MULT_W);
+        val = mant_mult << (Cfg::IN_F - Cfg::MANT_MULT_F);
+    } else {
+        val = mant_src << (Cfg::IN_F - Cfg::MANT_SRC_F);
+    }
+
+    // Shift based on exponent (wraps at the unified width like unified_t)
+    if (temp_exponent >= 0) {
+        val = (temp_exponent < bf16_native::unified_w<Cfg>()) ? ((val << temp_exponent) & ones<unified_uint_t>(bf16_native::unified_w<Cfg>())) : 0;
+    } else {
+        val = (-temp_exponent < bf16_native::unified_w<Cfg>()) ? (val >> (-temp_exponent)) : 0;
+    }
+
+    // Fractional part for the polynomial, integer part for the exponent
+    mant_val = val & ones<unified_uint_t>(Cfg::IN_F);
+    return -static_cast<int32_t>(val >> Cfg::IN_F);
+}
+
+/**
+ * @brief Native-integer model of bf16_exp_round (rounding policy Cfg::Rounding).
+ * * @tparam Cfg Datapath or width policy (POLY_OUT_W, BASE_SHIFT, the BF16 target fields and Rounding).
+ * @tparam T Carrier of the POLY_OUT_W-bit mantissa (uint64_t or unsigned __int128).
+ * @param m_raw Normalized mantissa bits.
+ * @param final_exponent Unbiased exponent of the result.
+ * @return Decomposed BF16 result structure, bit-identical to bf16_exp_round.
+ */
+template<typename Cfg, typename T>
+inline FPRaw bf16_exp_round_native(T m_raw, int32_t final_exponent) {
+    using bf16_native::ones;
+
+    // 1. Alignment Logic for Rounding
+    bool is_sub = (final_exponent < Cfg::TARGET_MIN_EXP);
+    int shift_val = Cfg::BASE_SHIFT + (is_sub ? (Cfg::TARGET_MIN_EXP - final_exponent) : 0);
+
+    // 2. Rounding Bit Extraction (lsb / guard / sticky)
+    bool lsb_bit = (shift_val < Cfg::POLY_OUT_W) ? ((m_raw >> shift_val) & 1) : false;
+    bool guard_bit = (shift_val > 0 && shift_val <= Cfg::POLY_OUT_W) ? ((m_raw >> (shift_val - 1)) & 1) : false;
+
+    bool sticky_bit = false;
+    if (shift_val > 1) {
+        if (shift_val > Cfg::POLY_OUT_W) {
+            sticky_bit = (m_raw != 0);
+        } else {
+            sticky_bit = (m_raw & ones<T>(shift_val - 1)) != 0;
+        }
+    }
+
+    typedef typename Cfg::Rounding Rounding;
+    uint64_t discarded = 0;
+    if constexpr (Rounding::MODE == RoundMode::Stochastic) {
+        constexpr int RAND_W = Rounding::RAND_W;
+        const T below = (shift_val < Cfg::POLY_OUT_W) ? (m_raw & ones<T>(shift_val)) : m_raw;
+        if (shift_val >= RAND_W) {
+            if (shift_val - RAND_W < Cfg::POLY_OUT_W) discarded = static_cast<uint64_t>(below >> (shift_val - RAND_W)) & ones<uint64_t>(RAND_W);
+        } else {
+            discarded = static_cast<uint64_t>(below << (RAND_W - shift_val)) & ones<uint64_t>(RAND_W);
+        }
+    }
+
+    // 3. Shift and Round (EXT_MANT_W wide, wraps like ac_int)
+    uint32_t result_m_ext = 0;
+    if (shift_val < Cfg::POLY_OUT_W) {
+        result_m_ext = static_cast<uint32_t>(m_raw >> shift_val) & ones<uint32_t>(Cfg::EXT_MANT_W);
+    }
+    int32_t adjusted_exp = is_sub ? Cfg::TARGET_MIN_EXP : final_exponent;
+    if constexpr (Rounding::MODE != RoundMode::TowardZero) {
+        bool round_up = bf16_round_up<Rounding>(lsb_bit, guard_bit, sticky_bit, discarded);
+        if (round_up) result_m_ext = (result_m_ext + 1) & ones<uint32_t>(Cfg::EXT_MANT_W);
+
+        // 4. Post-rounding Normalization
+        if ((result_m_ext >> Cfg::CARRY_BIT_IDX) & 1) {
+            adjusted_exp++;
+            result_m_ext >>= 1;
+        }
+    }
+
+    // 5. Final BF16 Structure Formation
+    FPRaw result = {};
+    result.sign = 0;
+    if (result_m_ext == 0) {
+        result.status.is_zero = true;
+        result.exponent = 0;
+    } else if (is_sub && !((result_m_ext >> Cfg::HIDDEN_BIT_IDX) & 1)) {
+        result.mantissa = result_m_ext & ones<uint32_t>(Cfg::TARGET_MANT_W);
+        result.hidden_bit = 0;
+        result.exponent = Cfg::TARGET_MIN_EXP - 1;
+        result.status.is_denormal = true;
+    } else {
+        result.mantissa = result_m_ext & ones<uint32_t>(Cfg::TARGET_MANT_W);
+        result.hidden_bit = 1;
+        result.exponent = adjusted_exp;
+        result.status.is_denormal = false;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Native-integer model of bf16_exp_core_approx.
+ * * Same range reduction, polynomial and rounding back end as the HLS version, bit for bit,
+ * but several times faster in plain C++ simulation. Verified exhaustively by
+ * tests/test_bf16_exp2_native.cpp.
+ *
+ * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Datapath or width policy (bf16_exp_high_accuracy by default).
+ * @param input_parts Decomposed BF16 input structure.
+ * @param rom Packed coefficient ROM of Cfg (see bf16_exp2_poly_native).
+ * @return Decomposed BF16 result structure.
+ */
+template<Base B, typename Cfg = bf16_exp_high_accuracy>
+inline FPRaw bf16_exp_core_approx_native(const FPRaw& input_parts, const uint64_t* rom = bf16_native::default_rom<Cfg>::value) {
+    uint64_t mant_val;
+    int32_t exponent_bias = bf16_exp_reduce_native<B, Cfg>(input_parts, mant_val);
+
+    PolyResultNativeT<Cfg> poly_res = bf16_exp2_poly_native<Cfg>(mant_val, rom);
+
+    int32_t final_exponent = poly_res.exponent + exponent_bias;
+    return bf16_exp_round_native<Cfg>(poly_res.mantissa, final_exponent);
+}
+
+/**
+ * @brief Runtime-base wrapper around bf16_exp_core_approx_native.
+ * * @param input_parts Decomposed BF16 input structure.
+ * @param base2 If true, calculates 2^x. If false, calculates e^x.
+ * @return Decomposed BF16 result structure.
+ */
+inline FPRaw bf16_exp2_core_approx_native(const FPRaw& input_parts, bool base2 = true) {
+    return base2 ? bf16_exp_core_approx_native<Base::Two>(input_parts)
+                 : bf16_exp_core_approx_native<Base::E>(input_parts);
+}
+
+#endif // BF16_EXP2_CORE_NATIVE_HPP
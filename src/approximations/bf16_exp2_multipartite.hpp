@@ -0,0 +1,54 @@
+#ifndef BF16_EXP2_MULTIPARTITE_HPP
+#define BF16_EXP2_MULTIPARTITE_HPP
+
+#include "bf16_exp2.hpp"
+#include "bf16_exp2_multipartite_core.hpp"
+#include "bf16_exp2_multipartite_core_native.hpp"
+#include "../../modeling/coeff_gen/bf16_exp2_multipartite_tables.hpp"
+#include <cstdint>
+
+#ifdef BF16_EXP2_NATIVE_MODEL
+#define BF16_EXP2_MULTIPARTITE_CORE_IMPL bf16_exp_multipartite_core_approx_native
+#else
+#define BF16_EXP2_MULTIPARTITE_CORE_IMPL bf16_exp_multipartite_core_approx
+#endif
+
+/**
+ * @brief Multipartite datapath: 2^-f = TIV - TO1 - TO2 (bf16_exp2_multipartite_tables.hpp).
+ * * No a*x multiplier: three table reads and a three-input subtraction replace the
+ * 21x39 multiply-add of bf16_exp_high_accuracy, for the same correctly rounded results
+ * on every core input (see gen_bf16_multipartite). ROM: 8064 bits (128 + 512 + 128
+ * entries) instead of 5376.
+ */
+typedef bf16_exp_multipartite_datapath_t<bf16_exp_multipartite_cfg_t<bf16_exp2_multipartite::TIV_W,
+                                                                      bf16_exp2_multipartite::TO1_PRE_W,
+                                                                      bf16_exp2_multipartite::TO1_W,
+                                                                      bf16_exp2_multipartite::TO2_PRE_W,
+                                                                      bf16_exp2_multipartite::TO2_W,
+                                                                      bf16_exp2_multipartite::OUT_F,
+                                                                      bf16_exp2_multipartite::LOG2E_F>,
+                                         bf16_exp2_multipartite::tiv, bf16_exp2_multipartite::to1,
+                                         bf16_exp2_multipartite::to2> bf16_exp_multipartite;
+
+static_assert(bf16_exp_multipartite::ROM_BITS == static_cast<uint64_t>(bf16_exp2_multipartite::ROM_BITS) &&
+              sizeof(bf16_exp2_multipartite::tiv) / sizeof(uint32_t) == bf16_exp_multipartite::TIV_SIZE &&
+              sizeof(bf16_exp2_multipartite::to1) / sizeof(uint32_t) == bf16_exp_multipartite::TO1_SIZE &&
+              sizeof(bf16_exp2_multipartite::to2) / sizeof(uint32_t) == bf16_exp_multipartite::TO2_SIZE,
+              "multipartite datapath widths must match its table header");
+
+/**
+ * @brief Approximation of exp2(x) (or e^x) for BF16 with the multipartite engine.
+ * * Same special cases as bf16_exp_approx; the core is BF16_EXP2_MULTIPARTITE_CORE_IMPL
+ * (ac_fixed by default, native with BF16_EXP2_NATIVE_MODEL).
+ *
+ * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Multipartite datapath (bf16_exp_multipartite by default).
+ * @param raw_input Raw 16-bit BF16 payload
+ * @return Raw 16-bit BF16 result
+ */
+template<Base B, typename Cfg = bf16_exp_multipartite>
+inline uint16_t bf16_exp_multipartite_approx(uint16_t raw_input) {
+    return bf16_exp_approx_with(raw_input, [](const FPRaw& parts) { return BF16_EXP2_MULTIPARTITE_CORE_IMPL<B, Cfg>(parts); });
+}
+
+#endif // BF16_EXP2_MULTIPARTITE_HPP
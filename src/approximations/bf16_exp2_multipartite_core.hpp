@@ -0,0 +1,173 @@
+#ifndef BF16_EXP2_MULTIPARTITE_CORE_HPP
+#define BF16_EXP2_MULTIPARTITE_CORE_HPP
+
+#include "bf16_exp2_core.hpp"
+
+/**
+ * @brief Width policy of the multipartite (multiplier-free) exp engine.
+ * * 2^-f is read from tables addressed by bit fields of the reduced fraction f and summed,
+ * so the datapath has no a*x multiplier. From the MSB down, f is cut into
+ *
+ *     [ TIV field (TIV_W) | TO1 field (TO1_W) | TO2 field (TO2_W) | unused ]
+ *
+ * and the result is TIV(tiv) - TO1(p1, y1) - TO2(p2, y2), where p1 / p2 are the top
+ * TO1_PRE_W / TO2_PRE_W bits of f. TIV holds 2^-f at the start of its interval; each
+ * offset table holds the (positive) first-order drop over its field, slope * y, with the
+ * slope taken over the prefix interval only. With TO2_W = 0 this is the bipartite method.
+ *
+ * All tables share the OUT_F fraction grid; their integer widths follow from the field
+ * weights (the slope of 2^-f is below ln 2 < 1):
+ *   TIV in (0.5, 1]                  -> 1.OUT_F
+ *   TO1 < 2^-TIV_W                    -> OUT_F - TIV_W bits
+ *   TO2 < 2^-(TIV_W + TO1_W)          -> OUT_F - TIV_W - TO1_W bits
+ * The reduction fields come from bf16_exp_reduction_t; the fraction bits below the used
+ * fields are dropped (they only exist for e^x, where f carries the log2(e) product).
+ *
+ * @tparam TIV_W_     Address bits of the table of initial values.
+ * @tparam TO1_PRE_W_ Prefix bits of f that select the slope of TO1 (<= TIV_W_).
+ * @tparam TO1_W_     Field bits of TO1.
+ * @tparam TO2_PRE_W_ Prefix bits of f that select the slope of TO2 (<= TIV_W_).
+ * @tparam TO2_W_     Field bits of TO2 (0 = bipartite, no TO2).
+ * @tparam OUT_F_     Fraction bits of the table entries and of the sum.
+ * @tparam LOG2E_F_   Fraction bits of the 1.F log2(e) constant of the range reduction.
+ */
+template<int TIV_W_, int TO1_PRE_W_, int TO1_W_, int TO2_PRE_W_, int TO2_W_, int OUT_F_, int LOG2E_F_ = bf16_cfg::LOG2E_F>
+struct bf16_exp_multipartite_cfg_t : bf16_exp_reduction_t<LOG2E_F_> {
+    typedef bf16_exp_reduction_t<LOG2E_F_> Reduction;
+
+    /** @brief Table of initial values. */
+    static constexpr int TIV_W = TIV_W_;
+    static constexpr int TIV_SIZE = 1 << TIV_W;
+    static constexpr int TIV_LSB = Reduction::IN_F - TIV_W;
+
+    /** @brief TIV address as the segment LUT (for the shared core-input enumeration). */
+    static constexpr int LUT_ADDR_W = TIV_W;
+    static constexpr int LUT_SIZE = TIV_SIZE;
+    static constexpr int LUT_MAX_IDX = LUT_SIZE - 1;
+
+    /** @brief First table of offsets: address [ p1 | y1 ]. */
+    static constexpr int TO1_PRE_W = TO1_PRE_W_;
+    static constexpr int TO1_W = TO1_W_;
+    static constexpr int TO1_LSB = TIV_LSB - TO1_W;
+    static constexpr int TO1_ADDR_W = TO1_PRE_W + TO1_W;
+    static constexpr int TO1_SIZE = 1 << TO1_ADDR_W;
+
+    /** @brief Second table of offsets: address [ p2 | y2 ] (absent when TO2_W == 0). */
+    static constexpr int TO2_PRE_W = TO2_PRE_W_;
+    static constexpr int TO2_W = TO2_W_;
+    static constexpr int TO2_LSB = TO1_LSB - TO2_W;
+    static constexpr int TO2_ADDR_W = TO2_PRE_W + TO2_W;
+    static constexpr int TO2_SIZE = (TO2_W > 0) ? (1 << TO2_ADDR_W) : 0;
+
+    /** @brief Entry formats on the common OUT_F grid. */
+    static constexpr int OUT_F = OUT_F_;
+    static constexpr int TIV_DW = 1 + OUT_F;
+    static constexpr int TO1_DW = OUT_F - TIV_W;
+    static constexpr int TO2_DW = (TO2_W > 0) ? OUT_F - TIV_W - TO1_W : 0;
+
+    /** @brief Table bits in total. */
+    static constexpr uint64_t ROM_BITS = static_cast<uint64_t>(TIV_SIZE) * TIV_DW +
+                                         static_cast<uint64_t>(TO1_SIZE) * TO1_DW +
+                                         static_cast<uint64_t>(TO2_SIZE) * TO2_DW;
+
+    /** @brief TIV - TO1 - TO2: sign bit and one integer bit (the value lies in (0, 2)). */
+    static constexpr int CALC_I = 2;
+    static constexpr int CALC_F = OUT_F;
+    static constexpr int CALC_W = CALC_I + CALC_F;
+
+    /** @brief Polynomial output format. */
+    static constexpr int POLY_OUT_I = 1;
+    static constexpr int POLY_OUT_F = CALC_F;
+    static constexpr int POLY_OUT_W = POLY_OUT_I + POLY_OUT_F;
+
+    static constexpr int BASE_SHIFT = POLY_OUT_F - Reduction::TARGET_MANT_W;
+
+    static_assert(TIV_W >= 1 && TO1_W >= 1 && TO2_W >= 0 && TO2_LSB >= 0, "fields must fit in the reduced fraction");
+    static_assert(TO1_PRE_W >= 1 && TO1_PRE_W <= TIV_W, "TO1 prefix must be part of the TIV field");
+    static_assert(TO2_W == 0 || (TO2_PRE_W >= 1 && TO2_PRE_W <= TIV_W), "TO2 prefix must be part of the TIV field");
+    static_assert(TO1_DW >= 1 && (TO2_W == 0 || TO2_DW >= 1), "OUT_F too short for the offset tables");
+    static_assert(TIV_DW <= 32 && CALC_W <= 64, "table entries must fit in 32 bits");
+};
+
+/**
+ * @brief Tables of a multipartite datapath (TIV_SIZE, TO1_SIZE and TO2_SIZE entries,
+ * unsigned, right-aligned). to2 is null for a bipartite configuration.
+ */
+struct bf16_exp_multipartite_tables {
+    const uint32_t* tiv;
+    const uint32_t* to1;
+    const uint32_t* to2;
+};
+
+/**
+ * @brief A complete multipartite datapath: a multipartite width policy plus its tables.
+ */
+template<typename Widths, const uint32_t* TIV_, const uint32_t* TO1_, const uint32_t* TO2_ = nullptr>
+struct bf16_exp_multipartite_datapath_t : Widths {
+    static constexpr const uint32_t* TIV = TIV_;
+    static constexpr const uint32_t* TO1 = TO1_;
+    static constexpr const uint32_t* TO2 = TO2_;
+
+    static constexpr bf16_exp_multipartite_tables tables() { return {TIV_, TO1_, TO2_}; }
+};
+
+/**
+ * @brief Calculates 2^(-x) for x in [0, 1) with the multipartite tables.
+ * * Same interface as bf16_exp2_poly: table lookups and a three-input subtraction take
+ * the place of the LUT + multiply-add, followed by the shared normalization stage.
+ *
+ * @tparam Cfg Multipartite datapath (bf16_exp_multipartite_cfg_t plus its tables).
+ * @param mant_val Input value in fixed-point format.
+ * @return Normalized PolyResult containing mantissa and exponent.
+ */
+template<typename Cfg>
+inline PolyResultT<Cfg> bf16_exp2_multipartite_poly(mant_of_t<Cfg> mant_val) {
+    typedef ac_fixed<Cfg::CALC_W, Cfg::CALC_I, true> calc_t;
+
+    // Table addresses: bit fields of the reduced fraction
+    ac_int<Cfg::TIV_W, false> tiv_addr = mant_val.template slc<Cfg::TIV_W>(Cfg::TIV_LSB);
+    ac_int<Cfg::TO1_ADDR_W, false> to1_addr = 0;
+    to1_addr.set_slc(Cfg::TO1_W, mant_val.template slc<Cfg::TO1_PRE_W>(Cfg::IN_F - Cfg::TO1_PRE_W));
+    to1_addr.set_slc(0, mant_val.template slc<Cfg::TO1_W>(Cfg::TO1_LSB));
+
+    ac_fixed<Cfg::TIV_DW, 1, false> tiv;
+    tiv.set_slc(0, ac_int<Cfg::TIV_DW, false>(Cfg::TIV[tiv_addr.to_int()]));
+    ac_fixed<Cfg::TO1_DW, Cfg::TO1_DW - Cfg::OUT_F, false> to1;
+    to1.set_slc(0, ac_int<Cfg::TO1_DW, false>(Cfg::TO1[to1_addr.to_int()]));
+
+    // res = TIV - TO1 (- TO2)
+    calc_t res = (calc_t)tiv - (calc_t)to1;
+    if constexpr (Cfg::TO2_W > 0) {
+        ac_int<Cfg::TO2_ADDR_W, false> to2_addr = 0;
+        to2_addr.set_slc(Cfg::TO2_W, mant_val.template slc<Cfg::TO2_PRE_W>(Cfg::IN_F - Cfg::TO2_PRE_W));
+        to2_addr.set_slc(0, mant_val.template slc<Cfg::TO2_W>(Cfg::TO2_LSB));
+
+        ac_fixed<Cfg::TO2_DW, Cfg::TO2_DW - Cfg::OUT_F, false> to2;
+        to2.set_slc(0, ac_int<Cfg::TO2_DW, false>(Cfg::TO2[to2_addr.to_int()]));
+        res = res - (calc_t)to2;
+    }
+
+    ac_int<Cfg::CALC_W, false> res_raw = res.template slc<Cfg::CALC_W>(0);
+
+    return bf16_exp_normalize<Cfg>(res_raw);
+}
+
+/**
+ * @brief bf16_exp_core_approx with the multipartite engine in place of bf16_exp2_poly.
+ * * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Multipartite datapath (widths, tables and log2(e)).
+ * @param input_parts Decomposed BF16 input structure.
+ * @return Decomposed BF16 result structure.
+ */
+template<Base B, typename Cfg>
+inline FPRaw bf16_exp_multipartite_core_approx(const FPRaw& input_parts) {
+    mant_of_t<Cfg> mant_val = 0;
+    int32_t exponent_bias = bf16_exp_reduce<B, Cfg>(input_parts, mant_val);
+
+    PolyResultT<Cfg> poly_res = bf16_exp2_multipartite_poly<Cfg>(mant_val);
+
+    int32_t final_exponent = poly_res.exponent + exponent_bias;
+    return bf16_exp_round<Cfg>(poly_res.mantissa.template slc<Cfg::POLY_OUT_W>(0), final_exponent);
+}
+
+#endif // BF16_EXP2_MULTIPARTITE_CORE_HPP
@@ -0,0 +1,55 @@
+#ifndef BF16_EXP2_MULTIPARTITE_CORE_NATIVE_HPP
+#define BF16_EXP2_MULTIPARTITE_CORE_NATIVE_HPP
+
+#include "bf16_exp2_multipartite_core.hpp"
+#include "bf16_exp2_core_native.hpp"
+#include <cstdint>
+
+/**
+ * @brief Native-integer model of bf16_exp2_multipartite_poly.
+ * * @tparam Cfg Multipartite width policy or datapath.
+ * @param mant_val Input fraction as raw bits of mant_of_t<Cfg> (IN_F fractional bits).
+ * @param tables TIV / TO1 / TO2 of Cfg (candidate tables when called from the fitter).
+ * @return Normalized result, bit-identical to bf16_exp2_multipartite_poly.
+ */
+template<typename Cfg>
+inline PolyResultNativeT<Cfg> bf16_exp2_multipartite_poly_native(uint64_t mant_val, const bf16_exp_multipartite_tables& tables) {
+    using bf16_native::ones;
+
+    const uint64_t tiv_addr = (mant_val >> Cfg::TIV_LSB) & ones<uint64_t>(Cfg::TIV_W);
+    const uint64_t to1_addr = (((mant_val >> (Cfg::IN_F - Cfg::TO1_PRE_W)) & ones<uint64_t>(Cfg::TO1_PRE_W)) << Cfg::TO1_W) |
+                              ((mant_val >> Cfg::TO1_LSB) & ones<uint64_t>(Cfg::TO1_W));
+
+    uint64_t res = (static_cast<uint64_t>(tables.tiv[tiv_addr]) & ones<uint64_t>(Cfg::TIV_DW)) -
+                   (static_cast<uint64_t>(tables.to1[to1_addr]) & ones<uint64_t>(Cfg::TO1_DW));
+    if constexpr (Cfg::TO2_W > 0) {
+        const uint64_t to2_addr = (((mant_val >> (Cfg::IN_F - Cfg::TO2_PRE_W)) & ones<uint64_t>(Cfg::TO2_PRE_W)) << Cfg::TO2_W) |
+                                  ((mant_val >> Cfg::TO2_LSB) & ones<uint64_t>(Cfg::TO2_W));
+        res -= static_cast<uint64_t>(tables.to2[to2_addr]) & ones<uint64_t>(Cfg::TO2_DW);
+    }
+    res &= ones<uint64_t>(Cfg::CALC_W);   // Wraps at CALC_W like calc_t
+
+    return bf16_exp_normalize_native<Cfg>(res);
+}
+
+/**
+ * @brief Native-integer model of bf16_exp_multipartite_core_approx.
+ * * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Multipartite width policy or datapath.
+ * @param input_parts Decomposed BF16 input structure.
+ * @param tables Tables of Cfg; Cfg::tables() by default.
+ * @return Decomposed BF16 result structure.
+ */
+template<Base B, typename Cfg>
+inline FPRaw bf16_exp_multipartite_core_approx_native(const FPRaw& input_parts,
+                                                      const bf16_exp_multipartite_tables& tables = Cfg::tables()) {
+    uint64_t mant_val;
+    int32_t exponent_bias = bf16_exp_reduce_native<B, Cfg>(input_parts, mant_val);
+
+    PolyResultNativeT<Cfg> poly_res = bf16_exp2_multipartite_poly_native<Cfg>(mant_val, tables);
+
+    int32_t final_exponent = poly_res.exponent + exponent_bias;
+    return bf16_exp_round_native<Cfg>(poly_res.mantissa, final_exponent);
+}
+
+#endif // BF16_EXP2_MULTIPARTITE_CORE_NATIVE_HPP
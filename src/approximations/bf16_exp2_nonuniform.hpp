@@ -0,0 +1,48 @@
+#ifndef BF16_EXP2_NONUNIFORM_HPP
+#define BF16_EXP2_NONUNIFORM_HPP
+
+#include "bf16_exp2.hpp"
+#include "bf16_exp2_nonuniform_core.hpp"
+#include "bf16_exp2_nonuniform_core_native.hpp"
+#include "../../modeling/coeff_gen/bf16_exp2_nonuniform_coeffs.hpp"
+#include <cstdint>
+
+#ifdef BF16_EXP2_NATIVE_MODEL
+#define BF16_EXP2_NONUNIFORM_CORE_IMPL bf16_exp_nonuniform_core_approx_native
+#else
+#define BF16_EXP2_NONUNIFORM_CORE_IMPL bf16_exp_nonuniform_core_approx
+#endif
+
+/**
+ * @brief Non-uniform datapath: 16-region directory over the 128-entry grid of
+ * bf16_exp_high_accuracy (bf16_exp2_nonuniform_coeffs.hpp).
+ * * 26 coefficient words instead of 128 (1204 ROM bits with the directory, instead of
+ * 5376) for the same correctly rounded results on every core input (see
+ * gen_bf16_nonuniform); the a*x multiplier is unchanged.
+ */
+typedef bf16_exp_nonuniform_datapath_t<bf16_exp_nonuniform_cfg_t<bf16_exp_cfg_t<bf16_exp2_nonuniform::LUT_ADDR_W,
+                                                                                bf16_exp2_nonuniform::COEFF_F,
+                                                                                bf16_exp2_nonuniform::LOG2E_F>,
+                                                                 bf16_exp2_nonuniform::L1_W, bf16_exp2_nonuniform::SEG_COUNT>,
+                                       bf16_exp2_nonuniform::dir, bf16_exp2_nonuniform::coeffs_u64> bf16_exp_nonuniform;
+
+static_assert(bf16_exp_nonuniform::PACKED_W == bf16_exp2_nonuniform::PACKED_W &&
+              bf16_exp_nonuniform::L1_SIZE == bf16_exp2_nonuniform::L1_SIZE,
+              "non-uniform datapath widths must match its coefficient header");
+
+/**
+ * @brief Approximation of exp2(x) (or e^x) for BF16 with the non-uniform LUT.
+ * * Same special cases as bf16_exp_approx; the core is BF16_EXP2_NONUNIFORM_CORE_IMPL
+ * (ac_fixed by default, native with BF16_EXP2_NATIVE_MODEL).
+ *
+ * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Non-uniform datapath (bf16_exp_nonuniform by default).
+ * @param raw_input Raw 16-bit BF16 payload
+ * @return Raw 16-bit BF16 result
+ */
+template<Base B, typename Cfg = bf16_exp_nonuniform>
+inline uint16_t bf16_exp_nonuniform_approx(uint16_t raw_input) {
+    return bf16_exp_approx_with(raw_input, [](const FPRaw& parts) { return BF16_EXP2_NONUNIFORM_CORE_IMPL<B, Cfg>(parts); });
+}
+
+#endif // BF16_EXP2_NONUNIFORM_HPP
@@ -0,0 +1,101 @@
+#ifndef BF16_EXP2_NONUNIFORM_CORE_HPP
+#define BF16_EXP2_NONUNIFORM_CORE_HPP
+
+#include "bf16_exp2_core.hpp"
+
+/**
+ * @brief Width policy of the linear engine with a two-level (non-uniform) LUT.
+ * * The LUT_ADDR_W-bit address of the uniform engine (inverted, as in the linear ROM) is
+ * split into a first-level index (top L1_W bits) and SUB_W lower bits. Each first-level
+ * region r has its own depth d_r <= SUB_W: it is cut into 2^d_r equal segments, addressed
+ * by the top d_r of the SUB_W bits. A directory of L1_SIZE words holds
+ * (base_r << DEPTH_W) | d_r, and the coefficient word of a segment is
+ * ROM[base_r + (sub >> (SUB_W - d_r))]. Regions where the line fits well stay coarse,
+ * so the ROM holds SEG_COUNT words instead of LUT_SIZE.
+ *
+ * The coefficients and the b - a*x evaluation are those of the uniform policy Widths,
+ * so a segmentation is bit-identical to the uniform ROM with each word replicated over
+ * the addresses of its segment.
+ *
+ * @tparam Widths     Uniform linear width policy (bf16_exp_cfg_t); its LUT_ADDR_W is the finest grid.
+ * @tparam L1_W_      Address bits of the directory.
+ * @tparam SEG_COUNT_ Coefficient words (sum of 2^d_r over the regions).
+ */
+template<typename Widths, int L1_W_, int SEG_COUNT_>
+struct bf16_exp_nonuniform_cfg_t : Widths {
+    /** @brief Directory: one (base, depth) word per first-level region. */
+    static constexpr int L1_W = L1_W_;
+    static constexpr int L1_SIZE = 1 << L1_W;
+    static constexpr int SUB_W = Widths::LUT_ADDR_W - L1_W;
+    static constexpr int DEPTH_W = bf16_cfg::floor_log2(SUB_W) + 1;
+
+    /** @brief Coefficient ROM of SEG_COUNT words, (b << COEFF_W) | a. */
+    static constexpr int SEG_COUNT = SEG_COUNT_;
+    static constexpr int BASE_W = bf16_cfg::floor_log2(SEG_COUNT - 1) + 1;
+    static constexpr int DIR_W = BASE_W + DEPTH_W;
+    static constexpr int PACKED_W = 2 * Widths::COEFF_W;
+
+    static constexpr uint64_t ROM_BITS = static_cast<uint64_t>(SEG_COUNT) * PACKED_W +
+                                         static_cast<uint64_t>(L1_SIZE) * DIR_W;
+
+    static_assert(L1_W >= 1 && SUB_W >= 1, "the directory index must be a proper part of the LUT address");
+    static_assert(SEG_COUNT >= L1_SIZE && SEG_COUNT <= Widths::LUT_SIZE, "between one segment per region and the uniform LUT");
+};
+
+/**
+ * @brief A complete non-uniform datapath: the policy plus its directory and coefficient ROM.
+ */
+template<typename Widths, const uint32_t* DIR_, const uint64_t* ROM_>
+struct bf16_exp_nonuniform_datapath_t : Widths {
+    static constexpr const uint32_t* DIR = DIR_;
+    static constexpr const uint64_t* ROM = ROM_;
+};
+
+/**
+ * @brief Calculates 2^(-x) for x in [0, 1) with the non-uniform LUT.
+ * * Same as bf16_exp2_poly, with the coefficient address coming from the directory:
+ * one small ROM read, a variable right shift of the SUB_W bits and a BASE_W-bit adder.
+ *
+ * @tparam Cfg Non-uniform datapath (bf16_exp_nonuniform_cfg_t plus DIR and ROM).
+ * @param mant_val Input value in fixed-point format.
+ * @return Normalized PolyResult containing mantissa and exponent.
+ */
+template<typename Cfg>
+inline PolyResultT<Cfg> bf16_exp2_nonuniform_poly(mant_of_t<Cfg> mant_val) {
+    // Inverted LUT address, as in the uniform ROM
+    ac_int<Cfg::LUT_ADDR_W, false> lut_index = mant_val.template slc<Cfg::LUT_ADDR_W>(Cfg::IN_F - Cfg::LUT_ADDR_W);
+    ac_int<Cfg::LUT_ADDR_W, false> fine_idx = Cfg::LUT_MAX_IDX - lut_index.to_int();
+
+    // First level: base and depth of the region
+    ac_int<Cfg::DIR_W, false> dir = Cfg::DIR[fine_idx.template slc<Cfg::L1_W>(Cfg::SUB_W).to_int()];
+    ac_int<Cfg::DEPTH_W, false> depth = dir.template slc<Cfg::DEPTH_W>(0);
+    ac_int<Cfg::BASE_W, false> base = dir.template slc<Cfg::BASE_W>(Cfg::DEPTH_W);
+
+    // Second level: top `depth` bits of the remaining address
+    ac_int<Cfg::SUB_W, false> sub = fine_idx.template slc<Cfg::SUB_W>(0);
+    sub >>= (Cfg::SUB_W - depth.to_int());
+
+    ac_int<Cfg::PACKED_W, false> packed = Cfg::ROM[(base + sub).to_int()];
+
+    return bf16_exp2_line<Cfg>(packed, mant_val);
+}
+
+/**
+ * @brief bf16_exp_core_approx with the non-uniform LUT in place of the uniform one.
+ * * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Non-uniform datapath (widths, directory, coefficient ROM and log2(e)).
+ * @param input_parts Decomposed BF16 input structure.
+ * @return Decomposed BF16 result structure.
+ */
+template<Base B, typename Cfg>
+inline FPRaw bf16_exp_nonuniform_core_approx(const FPRaw& input_parts) {
+    mant_of_t<Cfg> mant_val = 0;
+    int32_t exponent_bias = bf16_exp_reduce<B, Cfg>(input_parts, mant_val);
+
+    PolyResultT<Cfg> poly_res = bf16_exp2_nonuniform_poly<Cfg>(mant_val);
+
+    int32_t final_exponent = poly_res.exponent + exponent_bias;
+    return bf16_exp_round<Cfg>(poly_res.mantissa.template slc<Cfg::POLY_OUT_W>(0), final_exponent);
+}
+
+#endif // BF16_EXP2_NONUNIFORM_CORE_HPP
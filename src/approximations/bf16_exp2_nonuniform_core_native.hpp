@@ -0,0 +1,62 @@
+#ifndef BF16_EXP2_NONUNIFORM_CORE_NATIVE_HPP
+#define BF16_EXP2_NONUNIFORM_CORE_NATIVE_HPP
+
+#include "bf16_exp2_nonuniform_core.hpp"
+#include "bf16_exp2_core_native.hpp"
+#include <cstdint>
+
+/**
+ * @brief Coefficient address of a non-uniform LUT for a reduced fraction.
+ * * @tparam Cfg Non-uniform width policy or datapath.
+ * @param mant_val Input fraction as raw bits of mant_of_t<Cfg> (IN_F fractional bits).
+ * @param dir Directory of Cfg, L1_SIZE words of (base << DEPTH_W) | depth.
+ * @return Index into the SEG_COUNT-word coefficient ROM.
+ */
+template<typename Cfg>
+inline int bf16_exp_nonuniform_addr(uint64_t mant_val, const uint32_t* dir) {
+    using bf16_native::ones;
+
+    const int lut_index = static_cast<int>((mant_val >> (Cfg::IN_F - Cfg::LUT_ADDR_W)) & Cfg::LUT_MAX_IDX);
+    const int fine_idx = Cfg::LUT_MAX_IDX - lut_index;
+
+    const uint32_t entry = dir[fine_idx >> Cfg::SUB_W];
+    const int depth = static_cast<int>(entry & ones<uint32_t>(Cfg::DEPTH_W));
+    const int base = static_cast<int>((entry >> Cfg::DEPTH_W) & ones<uint32_t>(Cfg::BASE_W));
+    return base + ((fine_idx & static_cast<int>(ones<uint32_t>(Cfg::SUB_W))) >> (Cfg::SUB_W - depth));
+}
+
+/**
+ * @brief Native-integer model of bf16_exp2_nonuniform_poly.
+ * * @tparam Cfg Non-uniform width policy or datapath.
+ * @param mant_val Input fraction as raw bits of mant_of_t<Cfg> (IN_F fractional bits).
+ * @param dir Directory of Cfg (candidate directories when called from the fitter).
+ * @param rom SEG_COUNT coefficient words of Cfg.
+ * @return Normalized result, bit-identical to bf16_exp2_nonuniform_poly.
+ */
+template<typename Cfg>
+inline PolyResultNativeT<Cfg> bf16_exp2_nonuniform_poly_native(uint64_t mant_val, const uint32_t* dir, const uint64_t* rom) {
+    return bf16_exp2_line_native<Cfg>(rom[bf16_exp_nonuniform_addr<Cfg>(mant_val, dir)], mant_val);
+}
+
+/**
+ * @brief Native-integer model of bf16_exp_nonuniform_core_approx.
+ * * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Non-uniform width policy or datapath.
+ * @param input_parts Decomposed BF16 input structure.
+ * @param dir Directory of Cfg; Cfg::DIR by default.
+ * @param rom Coefficient ROM of Cfg; Cfg::ROM by default.
+ * @return Decomposed BF16 result structure.
+ */
+template<Base B, typename Cfg>
+inline FPRaw bf16_exp_nonuniform_core_approx_native(const FPRaw& input_parts, const uint32_t* dir = Cfg::DIR,
+                                                    const uint64_t* rom = Cfg::ROM) {
+    uint64_t mant_val;
+    int32_t exponent_bias = bf16_exp_reduce_native<B, Cfg>(input_parts, mant_val);
+
+    PolyResultNativeT<Cfg> poly_res = bf16_exp2_nonuniform_poly_native<Cfg>(mant_val, dir, rom);
+
+    int32_t final_exponent = poly_res.exponent + exponent_bias;
+    return bf16_exp_round_native<Cfg>(poly_res.mantissa, final_exponent);
+}
+
+#endif // BF16_EXP2_NONUNIFORM_CORE_NATIVE_HPP
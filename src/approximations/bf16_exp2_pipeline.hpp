@@ -0,0 +1,369 @@
+#ifndef BF16_EXP2_PIPELINE_HPP
+#define BF16_EXP2_PIPELINE_HPP
+
+#include "bf16_exp2.hpp"
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+// =========================================================
+// Types
+// =========================================================
+
+/**
+ * @brief Operations of the linear exp datapath, in dataflow order.
+ * * A stage register may follow any operation but the last (see ExpPipeOptions::cuts);
+ * the result after Recompose is always registered.
+ */
+enum class ExpPipeOp {
+    Decompose,   // fp_decompose and special-case routing
+    Reduce,      // Range reduction (times log2(e) for e^x)
+    LutFetch,    // Coefficient ROM read
+    Multiply,    // a * x
+    Add,         // b - a*x
+    Normalize,   // Priority encoder and left shift
+    Round,       // Rounding back end (Cfg::Rounding)
+    Recompose,   // Special-case select and fp_recompose
+};
+
+constexpr int EXP_PIPE_OPS = 8;
+
+/** @brief Stage boundary masks: bit i places a register after operation i. */
+constexpr uint32_t EXP_PIPE_CUTS_NONE = 0x00;      // One stage (combinational datapath, registered output)
+constexpr uint32_t EXP_PIPE_CUTS_2 = 0x08;         // | decompose .. multiply | add .. recompose |
+constexpr uint32_t EXP_PIPE_CUTS_3 = 0x12;         // | decompose, reduce | fetch .. add | normalize .. recompose |
+constexpr uint32_t EXP_PIPE_CUTS_4 = 0x2A;         // | decompose, reduce | fetch, multiply | add, normalize | round, recompose |
+constexpr uint32_t EXP_PIPE_CUTS_ALL = 0x7F;       // One stage per operation
+
+inline const char* exp_pipe_op_name(ExpPipeOp op) {
+    switch (op) {
+        case ExpPipeOp::Decompose: return "decompose";
+        case ExpPipeOp::Reduce:    return "reduce";
+        case ExpPipeOp::LutFetch:  return "lut fetch";
+        case ExpPipeOp::Multiply:  return "multiply";
+        case ExpPipeOp::Add:       return "add";
+        case ExpPipeOp::Normalize: return "normalize";
+        case ExpPipeOp::Round:     return "round";
+        case ExpPipeOp::Recompose: return "recompose";
+    }
+    return "?";
+}
+
+/**
+ * @brief Stage partition and unit timing of a pipeline.
+ */
+struct ExpPipeOptions {
+    uint32_t cuts = EXP_PIPE_CUTS_ALL;   // Bit i: stage register after operation i (i < EXP_PIPE_OPS - 1)
+    std::array<int, EXP_PIPE_OPS> op_cycles = {1, 1, 1, 1, 1, 1, 1, 1};   // Cycles a unit is busy per result
+                                                                          // (> 1 models an iterative or shared unit)
+    uint64_t max_cycles = 0;             // Stream stops after this many cycles (0 = no limit)
+};
+
+/**
+ * @brief Contents of a stage register: the input and every intermediate value computed
+ * so far (the fields past the token's current stage are not yet valid).
+ */
+template<typename Cfg>
+struct ExpPipeToken {
+    uint16_t input;
+    FPRaw input_parts;
+    ExpPath path;
+    uint64_t mant_val;                      // Reduce: fraction (IN_F fractional bits)
+    int32_t exponent_bias;                  // Reduce: minus the integer part
+    uint64_t packed;                        // LutFetch: (b << COEFF_W) | a
+    bf16_native::calc_uint<Cfg> ax;         // Multiply: a * x at MULT_F
+    bf16_native::calc_uint<Cfg> res;        // Add: b - a*x at CALC_F
+    PolyResultNativeT<Cfg> poly;            // Normalize
+    FPRaw result_parts;                     // Round (or the special-case result)
+    uint16_t output;                        // Recompose
+    uint64_t accept_cycle;                  // Cycle the input was accepted
+    uint64_t ready_cycle;                   // First cycle the stage's result is in its register
+};
+
+/**
+ * @brief Handshake outcome of one clock cycle.
+ */
+struct ExpPipeCycle {
+    bool accepted = false;   // in_valid && in_ready: the input entered stage 0
+    bool emitted = false;    // out_valid && out_ready: output holds a result
+    uint16_t output = 0;
+};
+
+/**
+ * @brief Cycle statistics of a pipeline since its last reset.
+ */
+struct ExpPipeStats {
+    uint64_t cycles = 0;
+    uint64_t accepted = 0;
+    uint64_t emitted = 0;
+    uint64_t input_stalls = 0;      // Cycles with a valid input that stage 0 could not take
+    uint64_t output_stalls = 0;     // Cycles with a finished result the sink did not take
+    uint64_t first_accept = 0;
+    uint64_t last_accept = 0;
+    uint64_t min_latency = 0;       // Accept-to-emit cycles
+    uint64_t max_latency = 0;
+    uint64_t sum_latency = 0;
+    uint64_t occupied = 0;          // Sum over cycles of the valid stage registers
+    std::vector<uint64_t> stage_busy;   // Cycles each stage held a token
+
+    double mean_latency() const { return emitted ? static_cast<double>(sum_latency) / emitted : 0.0; }
+
+    /** @brief Mean cycles between accepted inputs (achieved initiation interval). */
+    double measured_ii() const {
+        return accepted > 1 ? static_cast<double>(last_accept - first_accept) / (accepted - 1) : 0.0;
+    }
+
+    /** @brief Results per cycle. */
+    double throughput() const { return cycles ? static_cast<double>(emitted) / cycles : 0.0; }
+
+    /** @brief Mean fraction of the stage registers holding a token. */
+    double occupancy() const {
+        return (cycles && !stage_busy.empty()) ? static_cast<double>(occupied) / (cycles * stage_busy.size()) : 0.0;
+    }
+};
+
+// =========================================================
+// Pipeline Model
+// =========================================================
+
+/**
+ * @brief Cycle-accurate model of a pipelined bf16_exp_approx unit with valid/ready streaming.
+ * * The operations of the native linear core (ExpPipeOp) are grouped into stages by
+ * ExpPipeOptions::cuts, each stage ending in a register. A stage keeps its token for
+ * the largest op_cycles of its operations, and passes it on when the next register is
+ * free or is being emptied in the same cycle (the ready chain runs from the output back
+ * to the input, so a stalled sink fills the pipeline and then blocks the input). Without
+ * stalls the latency is the sum of the stage times and one result leaves per
+ * initiation_interval() cycles.
+ *
+ * Each operation runs on the native model functions (bf16_exp_reduce_native,
+ * bf16_exp_mult_ax_native, ...), in input order, so the outputs are bit-identical to
+ * bf16_exp_approx<B, Cfg> for any partition and any handshake pattern (including the
+ * LFSR sequence of stochastic rounding).
+ *
+ * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Linear datapath (bf16_exp_high_accuracy by default).
+ */
+template<Base B, typename Cfg = bf16_exp_high_accuracy>
+class Bf16ExpPipeline {
+public:
+    typedef ExpPipeToken<Cfg> Token;
+
+    explicit Bf16ExpPipeline(const ExpPipeOptions& opts = ExpPipeOptions(),
+                             const uint64_t* rom = bf16_native::default_rom<Cfg>::value)
+        : opts_(opts), rom_(rom) {
+        static_assert(bf16_native::check_cfg<Cfg>::value, "unsupported configuration");
+        first_op_.push_back(0);
+        for (int op = 0; op < EXP_PIPE_OPS - 1; ++op) {
+            if ((opts_.cuts >> op) & 1) first_op_.push_back(op + 1);
+        }
+        first_op_.push_back(EXP_PIPE_OPS);
+        for (int s = 0; s < stages(); ++s) {
+            int c = 1;
+            for (int op = first_op_[s]; op < first_op_[s + 1]; ++op) c = std::max(c, opts_.op_cycles[op]);
+            stage_cycles_.push_back(c);
+        }
+        reset();
+    }
+
+    int stages() const { return static_cast<int>(first_op_.size()) - 1; }
+
+    /** @brief Stage holding operation op. */
+    int stage_of(ExpPipeOp op) const {
+        const int i = static_cast<int>(op);
+        int s = 0;
+        while (first_op_[s + 1] <= i) ++s;
+        return s;
+    }
+
+    /** @brief Operations [first_op(s), first_op(s + 1)) run in stage s. */
+    int first_op(int s) const { return first_op_[s]; }
+
+    /** @brief Cycles stage s keeps each token. */
+    int stage_cycles(int s) const { return stage_cycles_[s]; }
+
+    /** @brief Initiation interval without stalls (slowest stage). */
+    int initiation_interval() const { return *std::max_element(stage_cycles_.begin(), stage_cycles_.end()); }
+
+    /** @brief Accept-to-emit cycles without stalls. */
+    int latency() const {
+        int l = 0;
+        for (int c : stage_cycles_) l += c;
+        return l;
+    }
+
+    /** @brief Empties the stage registers and clears the statistics. */
+    void reset() {
+        slots_.assign(stages(), Token());
+        valid_.assign(stages(), false);
+        stats_ = ExpPipeStats();
+        stats_.stage_busy.assign(stages(), 0);
+    }
+
+    /** @brief Tokens in flight. */
+    int in_flight() const { return static_cast<int>(std::count(valid_.begin(), valid_.end(), true)); }
+
+    /** @brief Stage register s, nullptr when it holds no token. */
+    const Token* stage_register(int s) const { return valid_[s] ? &slots_[s] : nullptr; }
+
+    const ExpPipeStats& stats() const { return stats_; }
+
+    /**
+     * @brief Advances one clock cycle.
+     * * @param in_valid The source presents in_data this cycle.
+     * @param in_data Raw 16-bit BF16 input.
+     * @param out_ready The sink takes a result this cycle.
+     * @return Handshakes of the cycle and the emitted result.
+     */
+    ExpPipeCycle cycle(bool in_valid, uint16_t in_data, bool out_ready) {
+        const uint64_t now = stats_.cycles;
+        const int last = stages() - 1;
+        ExpPipeCycle io;
+
+        // 1. Output register
+        if (valid_[last] && now >= slots_[last].ready_cycle) {
+            if (out_ready) {
+                io.emitted = true;
+                io.output = slots_[last].output;
+                valid_[last] = false;
+
+                const uint64_t latency = now - slots_[last].accept_cycle;
+                stats_.min_latency = stats_.emitted ? std::min(stats_.min_latency, latency) : latency;
+                stats_.max_latency = std::max(stats_.max_latency, latency);
+                stats_.sum_latency += latency;
+                stats_.emitted++;
+            } else {
+                stats_.output_stalls++;
+            }
+        }
+
+        // 2. Stage registers, from the output back (ready chain)
+        for (int s = last - 1; s >= 0; --s) {
+            if (valid_[s] && !valid_[s + 1] && now >= slots_[s].ready_cycle) {
+                slots_[s + 1] = slots_[s];
+                valid_[s] = false;
+                enter(s + 1, now);
+            }
+        }
+
+        // 3. Input
+        if (in_valid) {
+            if (!valid_[0]) {
+                io.accepted = true;
+                Token& t = slots_[0];
+                t = Token();
+                t.input = in_data;
+                t.accept_cycle = now;
+                enter(0, now);
+
+                if (!stats_.accepted) stats_.first_accept = now;
+                stats_.last_accept = now;
+                stats_.accepted++;
+            } else {
+                stats_.input_stalls++;
+            }
+        }
+
+        for (int s = 0; s <= last; ++s) {
+            stats_.stage_busy[s] += valid_[s];
+            stats_.occupied += valid_[s];
+        }
+        stats_.cycles++;
+        return io;
+    }
+
+private:
+    /** @brief Moves a token into stage s: runs the stage's operations and starts its timer. */
+    void enter(int s, uint64_t now) {
+        Token& t = slots_[s];
+        for (int op = first_op_[s]; op < first_op_[s + 1]; ++op) evaluate(static_cast<ExpPipeOp>(op), t);
+        t.ready_cycle = now + stage_cycles_[s];
+        valid_[s] = true;
+    }
+
+    /** @brief One operation of the native linear core (special-case tokens bypass the core). */
+    void evaluate(ExpPipeOp op, Token& t) const {
+        using bf16_native::ones;
+
+        const bool core = t.path == ExpPath::Core;
+        switch (op) {
+            case ExpPipeOp::Decompose:
+                t.input_parts = fp_decompose(static_cast<uint32_t>(t.input), FPType::BF16);
+                t.path = bf16_exp_classify(t.input_parts);
+                break;
+            case ExpPipeOp::Reduce:
+                if (core) t.exponent_bias = bf16_exp_reduce_native<B, Cfg>(t.input_parts, t.mant_val);
+                break;
+            case ExpPipeOp::LutFetch:
+                if (core) {
+                    const int lut_index = static_cast<int>((t.mant_val >> (Cfg::IN_F - Cfg::LUT_ADDR_W)) & Cfg::LUT_MAX_IDX);
+                    t.packed = rom_[Cfg::LUT_MAX_IDX - lut_index];
+                }
+                break;
+            case ExpPipeOp::Multiply:
+                if (core) t.ax = bf16_exp_mult_ax_native<Cfg>(t.packed & ones<uint64_t>(Cfg::COEFF_W),
+                                                              t.mant_val & ones<uint64_t>(Cfg::IN_W));
+                break;
+            case ExpPipeOp::Add:
+                if (core) t.res = bf16_exp_line_sub_native<Cfg>((t.packed >> Cfg::COEFF_W) & ones<uint64_t>(Cfg::COEFF_W), t.ax);
+                break;
+            case ExpPipeOp::Normalize:
+                if (core) t.poly = bf16_exp_normalize_native<Cfg>(t.res);
+                break;
+            case ExpPipeOp::Round:
+                t.result_parts = core ? bf16_exp_round_native<Cfg>(t.poly.mantissa, t.poly.exponent + t.exponent_bias)
+                                      : bf16_exp_special_result(t.path);
+                break;
+            case ExpPipeOp::Recompose:
+                t.output = static_cast<uint16_t>(fp_recompose(t.result_parts, FPType::BF16));
+                break;
+        }
+    }
+
+    ExpPipeOptions opts_;
+    const uint64_t* rom_;
+    std::vector<int> first_op_;
+    std::vector<int> stage_cycles_;
+    std::vector<Token> slots_;
+    std::vector<bool> valid_;
+    ExpPipeStats stats_;
+};
+
+/**
+ * @brief Streams count inputs through a pipeline until every result has left it.
+ * * The source offers inputs[i] in order on the cycles where source_valid(cycle) is true;
+ * the sink takes a result on the cycles where sink_ready(cycle) is true. Results are
+ * written to outputs in order. Stops early after ExpPipeOptions::max_cycles.
+ *
+ * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Linear datapath.
+ * @return Cycle statistics of the stream.
+ */
+template<Base B, typename Cfg = bf16_exp_high_accuracy, typename SourceValid, typename SinkReady>
+inline ExpPipeStats bf16_exp_pipeline_stream(const uint16_t* inputs, size_t count, uint16_t* outputs,
+                                             const ExpPipeOptions& opts, SourceValid source_valid, SinkReady sink_ready) {
+    Bf16ExpPipeline<B, Cfg> pipe(opts);
+    size_t next_in = 0, next_out = 0;
+    while (next_out < count && (opts.max_cycles == 0 || pipe.stats().cycles < opts.max_cycles)) {
+        const uint64_t now = pipe.stats().cycles;
+        const bool in_valid = next_in < count && source_valid(now);
+        ExpPipeCycle io = pipe.cycle(in_valid, in_valid ? inputs[next_in] : 0, sink_ready(now));
+        if (io.accepted) next_in++;
+        if (io.emitted) outputs[next_out++] = io.output;
+    }
+    return pipe.stats();
+}
+
+/**
+ * @brief bf16_exp_pipeline_stream with an always-valid source and an always-ready sink.
+ */
+template<Base B, typename Cfg = bf16_exp_high_accuracy>
+inline ExpPipeStats bf16_exp_pipeline_stream(const uint16_t* inputs, size_t count, uint16_t* outputs,
+                                             const ExpPipeOptions& opts = ExpPipeOptions()) {
+    auto always = [](uint64_t) { return true; };
+    return bf16_exp_pipeline_stream<B, Cfg>(inputs, count, outputs, opts, always, always);
+}
+
+#endif // BF16_EXP2_PIPELINE_HPP
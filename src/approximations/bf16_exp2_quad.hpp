@@ -0,0 +1,48 @@
+#ifndef BF16_EXP2_QUAD_HPP
+#define BF16_EXP2_QUAD_HPP
+
+#include "bf16_exp2.hpp"
+#include "bf16_exp2_quad_core.hpp"
+#include "bf16_exp2_quad_core_native.hpp"
+#include "../../modeling/coeff_gen/bf16_exp2_quad_coeffs.hpp"
+#include <cstdint>
+
+#ifdef BF16_EXP2_NATIVE_MODEL
+#define BF16_EXP2_QUAD_CORE_IMPL bf16_exp_quad_core_approx_native
+#else
+#define BF16_EXP2_QUAD_CORE_IMPL bf16_exp_quad_core_approx
+#endif
+
+/**
+ * @brief Quadratic datapath: 16 segments of c0 - t*(c1 - c2*t) (bf16_exp2_quad_coeffs.hpp).
+ * * 512 ROM bits instead of 5376 for the same correctly rounded results on every core
+ * input (see gen_bf16_quad), at the cost of a second, small multiplier: 3x14 (c2*t)
+ * and 12x14 (u*t) instead of the 21x39 a*x multiplier of bf16_exp_high_accuracy.
+ */
+typedef bf16_exp_quad_datapath_t<bf16_exp_quad_cfg_t<bf16_cfg::floor_log2(bf16_exp2_quad_packed::LUT_SIZE),
+                                                     bf16_exp2_quad_packed::T_W, bf16_exp2_quad_packed::C0_F,
+                                                     bf16_exp2_quad_packed::C1_F, bf16_exp2_quad_packed::C2_F,
+                                                     bf16_exp2_quad_packed::LOG2E_F>,
+                                 bf16_exp2_quad_packed::coeffs_u64> bf16_exp_quad;
+
+static_assert(bf16_exp_quad::PACKED_W == bf16_exp2_quad_packed::PACKED_W &&
+              bf16_exp_quad::LUT_SIZE == bf16_exp2_quad_packed::LUT_SIZE &&
+              bf16_exp_quad::C1_W == bf16_exp2_quad_packed::C1_W && bf16_exp_quad::C2_W == bf16_exp2_quad_packed::C2_W,
+              "quadratic datapath widths must match its coefficient header");
+
+/**
+ * @brief Approximation of exp2(x) (or e^x) for BF16 with the quadratic engine.
+ * * Same special cases as bf16_exp_approx; the core is BF16_EXP2_QUAD_CORE_IMPL
+ * (ac_fixed by default, native with BF16_EXP2_NATIVE_MODEL).
+ *
+ * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Quadratic datapath (bf16_exp_quad by default).
+ * @param raw_input Raw 16-bit BF16 payload
+ * @return Raw 16-bit BF16 result
+ */
+template<Base B, typename Cfg = bf16_exp_quad>
+inline uint16_t bf16_exp_quad_approx(uint16_t raw_input) {
+    return bf16_exp_approx_with(raw_input, [](const FPRaw& parts) { return BF16_EXP2_QUAD_CORE_IMPL<B, Cfg>(parts); });
+}
+
+#endif // BF16_EXP2_QUAD_HPP
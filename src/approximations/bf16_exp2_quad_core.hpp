@@ -0,0 +1,156 @@
+#ifndef BF16_EXP2_QUAD_CORE_HPP
+#define BF16_EXP2_QUAD_CORE_HPP
+
+#include "bf16_exp2_core.hpp"
+
+/**
+ * @brief Width policy of the quadratic (second-order piecewise) exp engine.
+ * * The range reduction and the rounding back end are the ones of the linear datapath
+ * (bf16_exp_reduce / bf16_exp_round); only the polynomial differs. The reduced fraction
+ * f is split into a segment s (top LUT_ADDR_W bits) and a local argument t (the next
+ * T_W bits, t in [0, 1)), and 2^-f is evaluated in Horner form
+ *
+ *     p = c0 - t * (c1 - c2 * t)
+ *
+ * with c2 * t truncated to the C1 grid. All coefficients are unsigned; their integer
+ * widths follow from the segment width h = 2^-LUT_ADDR_W:
+ *   c0 ~ 2^-s*h          in (0.5, 1]       -> 1.C0_F
+ *   c1 ~ ln2 * h * c0    < 2^-LUT_ADDR_W   -> C1_F - LUT_ADDR_W bits
+ *   c2 ~ (ln2 * h)^2 / 2 < 2^-(2*LUT_ADDR_W + 1) -> C2_F - 2*LUT_ADDR_W - 1 bits
+ * The product u * t lands on P_F = C1_F + T_W fraction bits, which is the precision of
+ * the polynomial output. The reduction fields come from bf16_exp_reduction_t.
+ *
+ * @tparam LUT_ADDR_W_ log2 of the number of segments.
+ * @tparam T_W_        Bits of the local argument t fed to both multipliers.
+ * @tparam C0_F_       Fraction bits of c0.
+ * @tparam C1_F_       Fraction bits of c1 (and of the Horner inner sum).
+ * @tparam C2_F_       Fraction bits of c2.
+ * @tparam LOG2E_F_    Fraction bits of the 1.F log2(e) constant of the range reduction.
+ */
+template<int LUT_ADDR_W_, int T_W_, int C0_F_, int C1_F_, int C2_F_, int LOG2E_F_ = bf16_cfg::LOG2E_F>
+struct bf16_exp_quad_cfg_t : bf16_exp_reduction_t<LOG2E_F_> {
+    typedef bf16_exp_reduction_t<LOG2E_F_> Reduction;
+
+    /** @brief Segment LUT. */
+    static constexpr int LUT_ADDR_W = LUT_ADDR_W_;
+    static constexpr int LUT_SIZE = 1 << LUT_ADDR_W;
+    static constexpr int LUT_MAX_IDX = LUT_SIZE - 1;
+
+    /** @brief Local argument t: T_W bits below the segment bits, value in [0, 1). */
+    static constexpr int T_W = T_W_;
+    static constexpr int T_LSB = Reduction::IN_F - LUT_ADDR_W - T_W;   // Position of the t LSB in the reduced fraction
+
+    /** @brief Coefficient formats (unsigned, integer bits may be negative). */
+    static constexpr int C0_F = C0_F_;
+    static constexpr int C0_I = 1;
+    static constexpr int C0_W = C0_I + C0_F;
+    static constexpr int C1_F = C1_F_;
+    static constexpr int C1_W = C1_F - LUT_ADDR_W;
+    static constexpr int C1_I = C1_W - C1_F;
+    static constexpr int C2_F = C2_F_;
+    static constexpr int C2_W = C2_F - 2 * LUT_ADDR_W - 1;
+    static constexpr int C2_I = C2_W - C2_F;
+
+    /** @brief ROM word: [ c0 | c1 | c2 ]. */
+    static constexpr int PACKED_W = C0_W + C1_W + C2_W;
+    static constexpr int C1_LSB = C2_W;
+    static constexpr int C0_LSB = C1_W + C2_W;
+
+    /** @brief Horner products: c2 * t (truncated to C1_F) and u * t. */
+    static constexpr int C2T_W = C2_W + T_W;
+    static constexpr int C2T_F = C2_F + T_W;
+    static constexpr int UT_W = C1_W + T_W;
+    static constexpr int P_F = C1_F + T_W;
+
+    /** @brief c0 - u*t: sign bit and one integer bit (the value lies in (0, 2)). */
+    static constexpr int CALC_I = 2;
+    static constexpr int CALC_F = P_F;
+    static constexpr int CALC_W = CALC_I + CALC_F;
+
+    /** @brief Polynomial output format. */
+    static constexpr int POLY_OUT_I = 1;
+    static constexpr int POLY_OUT_F = CALC_F;
+    static constexpr int POLY_OUT_W = POLY_OUT_I + POLY_OUT_F;
+
+    static constexpr int BASE_SHIFT = POLY_OUT_F - Reduction::TARGET_MANT_W;
+
+    static_assert(T_W >= 1 && T_LSB >= 0, "t must come from the reduced fraction below the segment bits");
+    static_assert(C1_W >= 1 && C2_W >= 1, "coefficient fractions too short for the segment width");
+    static_assert(P_F >= C0_F, "c0 must align to the u*t grid");
+    static_assert(PACKED_W <= 64, "ROM word must fit in 64 bits");
+    static_assert(C2T_W <= 64 && UT_W <= 64 && CALC_W <= 64, "Horner products must fit in 64 bits");
+};
+
+/**
+ * @brief A complete quadratic datapath: a quadratic width policy plus its ROM
+ * (Widths::LUT_SIZE words of (c0 << C0_LSB) | (c1 << C1_LSB) | c2).
+ */
+template<typename Widths, const uint64_t* ROM_>
+struct bf16_exp_quad_datapath_t : Widths {
+    static constexpr const uint64_t* ROM = ROM_;
+};
+
+/**
+ * @brief Calculates 2^(-x) for x in [0, 1) with the piecewise quadratic engine.
+ * * Same interface as bf16_exp2_poly: the segment comes from the MSBs of the fraction
+ * (inverted index, as in the linear ROM) and the result goes through the shared
+ * normalization stage (bf16_exp_normalize).
+ *
+ * @tparam Cfg Quadratic datapath (bf16_exp_quad_cfg_t plus a ROM of PACKED_W words).
+ * @param mant_val Input value in fixed-point format.
+ * @return Normalized PolyResult containing mantissa and exponent.
+ */
+template<typename Cfg>
+inline PolyResultT<Cfg> bf16_exp2_quad_poly(mant_of_t<Cfg> mant_val) {
+    // Segment and local argument
+    uint8_t lut_index = mant_val.template slc<Cfg::LUT_ADDR_W>(Cfg::IN_F - Cfg::LUT_ADDR_W);
+    ac_fixed<Cfg::T_W, 0, false> t;
+    t.set_slc(0, mant_val.template slc<Cfg::T_W>(Cfg::T_LSB));
+
+    int idx = Cfg::LUT_MAX_IDX - lut_index;
+    ac_int<Cfg::PACKED_W, false> packed = Cfg::ROM[idx];
+
+    typedef ac_fixed<Cfg::C0_W, Cfg::C0_I, false> c0_t;
+    typedef ac_fixed<Cfg::C1_W, Cfg::C1_I, false> c1_t;
+    typedef ac_fixed<Cfg::C2_W, Cfg::C2_I, false> c2_t;
+    typedef ac_fixed<Cfg::CALC_W, Cfg::CALC_I, true> calc_t;
+
+    c0_t c0;
+    c0.set_slc(0, packed.template slc<Cfg::C0_W>(Cfg::C0_LSB));
+    c1_t c1;
+    c1.set_slc(0, packed.template slc<Cfg::C1_W>(Cfg::C1_LSB));
+    c2_t c2;
+    c2.set_slc(0, packed.template slc<Cfg::C2_W>(0));
+
+    // Horner step 1: u = c1 - c2 * t, with c2 * t truncated to the c1 grid
+    ac_fixed<Cfg::C2T_W, Cfg::C2_I, false> c2t = c2 * t;
+    c1_t u = c1 - (c1_t)c2t;
+
+    // Horner step 2: res = c0 - u * t
+    ac_fixed<Cfg::UT_W, Cfg::C1_I, false> ut = u * t;
+    calc_t res = (calc_t)c0 - (calc_t)ut;
+
+    ac_int<Cfg::CALC_W, false> res_raw = res.template slc<Cfg::CALC_W>(0);
+
+    return bf16_exp_normalize<Cfg>(res_raw);
+}
+
+/**
+ * @brief bf16_exp_core_approx with the quadratic engine in place of bf16_exp2_poly.
+ * * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Quadratic datapath (widths, coefficient ROM and log2(e)).
+ * @param input_parts Decomposed BF16 input structure.
+ * @return Decomposed BF16 result structure.
+ */
+template<Base B, typename Cfg>
+inline FPRaw bf16_exp_quad_core_approx(const FPRaw& input_parts) {
+    mant_of_t<Cfg> mant_val = 0;
+    int32_t exponent_bias = bf16_exp_reduce<B, Cfg>(input_parts, mant_val);
+
+    PolyResultT<Cfg> poly_res = bf16_exp2_quad_poly<Cfg>(mant_val);
+
+    int32_t final_exponent = poly_res.exponent + exponent_bias;
+    return bf16_exp_round<Cfg>(poly_res.mantissa.template slc<Cfg::POLY_OUT_W>(0), final_exponent);
+}
+
+#endif // BF16_EXP2_QUAD_CORE_HPP
@@ -0,0 +1,59 @@
+#ifndef BF16_EXP2_QUAD_CORE_NATIVE_HPP
+#define BF16_EXP2_QUAD_CORE_NATIVE_HPP
+
+#include "bf16_exp2_quad_core.hpp"
+#include "bf16_exp2_core_native.hpp"
+#include <cstdint>
+
+/**
+ * @brief Native-integer model of bf16_exp2_quad_poly.
+ * * All Horner products fit in uint64_t (checked by bf16_exp_quad_cfg_t).
+ *
+ * @tparam Cfg Quadratic width policy or datapath.
+ * @param mant_val Input fraction as raw bits of mant_of_t<Cfg> (IN_F fractional bits).
+ * @param rom Packed ROM, Cfg::LUT_SIZE words of (c0 << C0_LSB) | (c1 << C1_LSB) | c2.
+ * @return Normalized result, bit-identical to bf16_exp2_quad_poly.
+ */
+template<typename Cfg>
+inline PolyResultNativeT<Cfg> bf16_exp2_quad_poly_native(uint64_t mant_val, const uint64_t* rom) {
+    using bf16_native::ones;
+
+    int lut_index = static_cast<int>((mant_val >> (Cfg::IN_F - Cfg::LUT_ADDR_W)) & Cfg::LUT_MAX_IDX);
+    uint64_t t = (mant_val >> Cfg::T_LSB) & ones<uint64_t>(Cfg::T_W);
+
+    uint64_t packed = rom[Cfg::LUT_MAX_IDX - lut_index];
+    uint64_t c0 = (packed >> Cfg::C0_LSB) & ones<uint64_t>(Cfg::C0_W);
+    uint64_t c1 = (packed >> Cfg::C1_LSB) & ones<uint64_t>(Cfg::C1_W);
+    uint64_t c2 = packed & ones<uint64_t>(Cfg::C2_W);
+
+    // Horner step 1: u = c1 - trunc(c2 * t) at C1_F, wrapping at C1_W like c1_t
+    uint64_t c2t = c2 * t;
+    uint64_t c2t_c1 = (Cfg::C2T_F >= Cfg::C1_F) ? (c2t >> (Cfg::C2T_F - Cfg::C1_F)) : (c2t << (Cfg::C1_F - Cfg::C2T_F));
+    uint64_t u = (c1 - c2t_c1) & ones<uint64_t>(Cfg::C1_W);
+
+    // Horner step 2: c0 - u * t at P_F (wraps at CALC_W like calc_t)
+    uint64_t res = ((c0 << (Cfg::P_F - Cfg::C0_F)) - u * t) & ones<uint64_t>(Cfg::CALC_W);
+
+    return bf16_exp_normalize_native<Cfg>(res);
+}
+
+/**
+ * @brief Native-integer model of bf16_exp_quad_core_approx.
+ * * @tparam B Base::Two calculates 2^x, Base::E calculates e^x.
+ * @tparam Cfg Quadratic width policy or datapath.
+ * @param input_parts Decomposed BF16 input structure.
+ * @param rom Packed ROM of Cfg (see bf16_exp2_quad_poly_native); Cfg::ROM by default.
+ * @return Decomposed BF16 result structure.
+ */
+template<Base B, typename Cfg>
+inline FPRaw bf16_exp_quad_core_approx_native(const FPRaw& input_parts, const uint64_t* rom = Cfg::ROM) {
+    uint64_t mant_val;
+    int32_t exponent_bias = bf16_exp_reduce_native<B, Cfg>(input_parts, mant_val);
+
+    PolyResultNativeT<Cfg> poly_res = bf16_exp2_quad_poly_native<Cfg>(mant_val, rom);
+
+    int32_t final_exponent = poly_res.exponent + exponent_bias;
+    return bf16_exp_round_native<Cfg>(poly_res.mantissa, final_exponent);
+}
+
+#endif // BF16_EXP2_QUAD_CORE_NATIVE_HPP
@@ -0,0 +1,138 @@
+#ifndef BF16_EXP2_TABLE_HPP
+#define BF16_EXP2_TABLE_HPP
+
+#include "bf16_exp2.hpp"
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * @namespace bf16_exp2_table
+ * @brief Table-backed engine for bf16_exp2_approx.
+ * * The BF16 input domain has only 65,536 bit patterns, so the complete output of the
+ * bit-accurate model fits in one 128 KiB table per base. Each table is built once from
+ * bf16_exp2_approx on first use; afterwards every evaluation is a single load.
+ *
+ * Define BF16_EXP2_TABLE_SELF_CHECK to verify each table right after it is built against
+ * the model evaluated with the other core implementation (native integer when the table
+ * comes from the ac_fixed core, ac_fixed under BF16_EXP2_NATIVE_MODEL); throws
+ * std::runtime_error on mismatch.
+ */
+#ifdef BF16_EXP2_NATIVE_MODEL
+#define BF16_EXP2_TABLE_REF_CORE bf16_exp_core_approx
+#else
+#define BF16_EXP2_TABLE_REF_CORE bf16_exp_core_approx_native
+#endif
+
+namespace bf16_exp2_table {
+    /** @brief Number of entries per table (all 16-bit patterns). */
+    constexpr size_t TABLE_SIZE = size_t(1) << 16;
+
+    typedef std::array<uint16_t, TABLE_SIZE> table_t;
+
+    /** @brief Model output for one input, routed through the core the table was not built with. */
+    template<Base B>
+    inline uint16_t reference(uint16_t raw_input) {
+        return bf16_exp_approx_with(raw_input, [](const FPRaw& parts) { return BF16_EXP2_TABLE_REF_CORE<B>(parts); });
+    }
+
+    /**
+     * @brief Compares a table exhaustively against the other core implementation.
+     * @param table Table to verify.
+     * @param base2 Base the table was built for.
+     * @param first_mismatch Optional output: first input whose entry differs.
+     * @return Number of mismatching entries (0 means the table is exact).
+     */
+    inline uint32_t verify(const table_t& table, bool base2, uint32_t* first_mismatch = nullptr) {
+        uint32_t mismatches = 0;
+        for (uint32_t i = 0; i < TABLE_SIZE; ++i) {
+            uint16_t in = static_cast<uint16_t>(i);
+            if (table[i] != (base2 ? reference<Base::Two>(in) : reference<Base::E>(in))) {
+                if (mismatches == 0 && first_mismatch) *first_mismatch = i;
+                mismatches++;
+            }
+        }
+        return mismatches;
+    }
+
+    /**
+     * @brief Compares a range of a table against expected outputs (e.g. GoldenFile::results()).
+     * @param table Table to verify.
+     * @param expected Expected output of inputs first .. first + count - 1.
+     * @param first First input pattern covered by expected.
+     * @param count Number of entries in expected (first + count must not exceed TABLE_SIZE).
+     * @param first_mismatch Optional output: first input whose entry differs.
+     * @return Number of mismatching entries.
+     */
+    inline uint32_t verify(const table_t& table, const uint16_t* expected, uint32_t first, uint32_t count,
+                           uint32_t* first_mismatch = nullptr) {
+        uint32_t mismatches = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (table[first + i] != expected[i]) {
+                if (mismatches == 0 && first_mismatch) *first_mismatch = first + i;
+                mismatches++;
+            }
+        }
+        return mismatches;
+    }
+
+    /** @brief Evaluates the bit-accurate model for every input pattern. */
+    inline table_t build(bool base2) {
+        table_t table;
+        for (uint32_t i = 0; i < TABLE_SIZE; ++i) {
+            table[i] = bf16_exp2_approx(static_cast<uint16_t>(i), base2);
+        }
+#ifdef BF16_EXP2_TABLE_SELF_CHECK
+        if (verify(table, base2) != 0) {
+            throw std::runtime_error("bf16_exp2_table: table does not match the reference core");
+        }
+#endif
+        return table;
+    }
+
+    /**
+     * @brief Returns the table for the requested base, building it on first use.
+     * * Function-local statics give thread-safe one-time initialization, and the two
+     * bases are kept in separate functions so only the tables actually used get built.
+     */
+    inline const table_t& exp2_table() {
+        static const table_t table = build(true);
+        return table;
+    }
+
+    inline const table_t& expe_table() {
+        static const table_t table = build(false);
+        return table;
+    }
+
+    inline const table_t& get(bool base2) {
+        return base2 ? exp2_table() : expe_table();
+    }
+}
+
+/**
+ * @brief Table-backed equivalent of bf16_exp2_approx.
+ * * Bit-identical to the model for every input. Hot loops should hoist
+ * bf16_exp2_table::get(base2) out of the loop and index it directly.
+ *
+ * @param raw_input Raw 16-bit BF16 payload
+ * @param base2 If true, calculates 2^x. If false, calculates e^x.
+ * @return Raw 16-bit BF16 result
+ */
+inline uint16_t bf16_exp2_table_approx(uint16_t raw_input, bool base2 = true) {
+    return bf16_exp2_table::get(base2)[raw_input];
+}
+
+/**
+ * @brief Self-check mode: cross-checks the lookup tables against the other core.
+ * * Forces both tables to be built and compares all 65,536 entries of each against the
+ * model evaluated with the core the tables were not built with (see verify).
+ * @return Total number of mismatching entries across both bases.
+ */
+inline uint32_t bf16_exp2_table_self_check() {
+    return bf16_exp2_table::verify(bf16_exp2_table::exp2_table(), true) +
+           bf16_exp2_table::verify(bf16_exp2_table::expe_table(), false);
+}
+
+#endif // BF16_EXP2_TABLE_HPP
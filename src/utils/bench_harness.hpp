@@ -0,0 +1,236 @@
+#ifndef BENCH_HARNESS_HPP
+#define BENCH_HARNESS_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h> // __rdtsc
+#endif
+
+// =========================================================
+// Types
+// =========================================================
+
+/**
+ * @brief Timing options for a single benchmark case.
+ */
+struct BenchOptions {
+    int trials = 5;              // Timed trials, the fastest one is reported
+    double min_trial_ms = 20.0;  // Each trial repeats the input set until it runs at least this long
+};
+
+/**
+ * @brief Result of one (function, distribution) benchmark case.
+ */
+struct BenchResult {
+    std::string name;
+    std::string distribution;
+    double ns_per_op = 0.0;
+    double ops_per_s = 0.0;
+    double cycles_per_op = 0.0;  // TSC cycles (0 if no cycle counter is available)
+    uint64_t ops = 0;            // Operations in the reported trial
+};
+
+// =========================================================
+// Timing
+// =========================================================
+
+namespace bench_detail {
+    /** @brief Keeps results alive so the timed loops cannot be optimized away. */
+    inline volatile uint64_t g_sink = 0;
+
+    /** @brief Time-stamp counter, 0 on targets without one. */
+    inline uint64_t cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    template<typename R>
+    inline uint64_t fold(R r) { return static_cast<uint64_t>(r); }
+
+    inline uint64_t fold(double r) {
+        uint64_t bits;
+        static_assert(sizeof(bits) == sizeof(r), "double must be 64 bits");
+        __builtin_memcpy(&bits, &r, sizeof(bits));
+        return bits;
+    }
+}
+
+/**
+ * @brief Times fn over every element of inputs.
+ * * One untimed warm-up pass, then opts.trials trials; each trial repeats the input set
+ * until opts.min_trial_ms has elapsed and the fastest trial is reported. Return values
+ * of fn are folded into a sink so the calls are not dead code.
+ *
+ * @param fn Callable R(const T&) returning an integer, bool or double.
+ */
+template<typename T, typename Fn>
+BenchResult bench_run(const std::string& name, const std::string& distribution,
+                      const std::vector<T>& inputs, Fn fn, const BenchOptions& opts = BenchOptions()) {
+    BenchResult result;
+    result.name = name;
+    result.distribution = distribution;
+    if (inputs.empty()) return result;
+
+    uint64_t acc = 0;
+    for (const auto& in : inputs) acc += bench_detail::fold(fn(in));
+
+    for (int t = 0; t < opts.trials; ++t) {
+        uint64_t ops = 0;
+        double ns = 0.0;
+        uint64_t c0 = bench_detail::cycles();
+        auto t0 = std::chrono::steady_clock::now();
+        do {
+            for (const auto& in : inputs) acc += bench_detail::fold(fn(in));
+            ops += inputs.size();
+            ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+        } while (ns < opts.min_trial_ms * 1e6);
+        uint64_t c1 = bench_detail::cycles();
+
+        double ns_per_op = ns / ops;
+        if (t == 0 || ns_per_op < result.ns_per_op) {
+            result.ns_per_op = ns_per_op;
+            result.ops_per_s = 1e9 / ns_per_op;
+            result.cycles_per_op = double(c1 - c0) / ops;
+            result.ops = ops;
+        }
+    }
+
+    bench_detail::g_sink = acc;
+    return result;
+}
+
+// =========================================================
+// Reporting
+// =========================================================
+
+/** @brief Prints the column header for bench_print(). */
+inline void bench_print_header() {
+    std::cout << std::left << std::setw(30) << "Function" << std::setw(12) << "Inputs" << std::right
+              << std::setw(12) << "ns/op" << std::setw(14) << "Mops/s" << std::setw(12) << "cycles/op" << "\n";
+}
+
+/** @brief Prints one result row. */
+inline void bench_print(const BenchResult& r) {
+    std::cout << std::left << std::setw(30) << r.name << std::setw(12) << r.distribution << std::right
+              << std::fixed << std::setprecision(2) << std::setw(12) << r.ns_per_op
+              << std::setw(14) << (r.ops_per_s / 1e6) << std::setw(12) << r.cycles_per_op << "\n";
+}
+
+/**
+ * @brief Writes results as JSON, one result object per line.
+ * @return false if the file could not be written.
+ */
+inline bool bench_write_json(const std::string& path, const std::vector<BenchResult>& results) {
+    std::ofstream out(path);
+    if (!out.is_open()) return false;
+
+    out << "{\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"distribution\": \"" << r.distribution << "\""
+            << std::fixed << std::setprecision(4)
+            << ", \"ns_per_op\": " << r.ns_per_op
+            << ", \"ops_per_s\": " << std::setprecision(1) << r.ops_per_s
+            << ", \"cycles_per_op\": " << std::setprecision(4) << r.cycles_per_op
+            << ", \"ops\": " << r.ops << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+namespace bench_detail {
+    /** @brief Extracts "key": "value" from one JSON object line. */
+    inline bool json_string(const std::string& line, const std::string& key, std::string& value) {
+        size_t k = line.find("\"" + key + "\"");
+        if (k == std::string::npos) return false;
+        size_t q0 = line.find('"', line.find(':', k) + 1);
+        size_t q1 = (q0 == std::string::npos) ? q0 : line.find('"', q0 + 1);
+        if (q1 == std::string::npos) return false;
+        value = line.substr(q0 + 1, q1 - q0 - 1);
+        return true;
+    }
+
+    /** @brief Extracts "key": number from one JSON object line. */
+    inline bool json_number(const std::string& line, const std::string& key, double& value) {
+        size_t k = line.find("\"" + key + "\"");
+        if (k == std::string::npos) return false;
+        value = std::strtod(line.c_str() + line.find(':', k) + 1, nullptr);
+        return true;
+    }
+}
+
+/**
+ * @brief Reads results written by bench_write_json().
+ * * Only this one-object-per-line layout is supported, not arbitrary JSON.
+ * @return false if the file could not be opened.
+ */
+inline bool bench_read_json(const std::string& path, std::vector<BenchResult>& results) {
+    std::ifstream in(path);
+    if (!in.is_open()) return false;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        BenchResult r;
+        double ops = 0.0;
+        if (!bench_detail::json_string(line, "name", r.name) ||
+            !bench_detail::json_string(line, "distribution", r.distribution) ||
+            !bench_detail::json_number(line, "ns_per_op", r.ns_per_op)) continue;
+        bench_detail::json_number(line, "ops_per_s", r.ops_per_s);
+        bench_detail::json_number(line, "cycles_per_op", r.cycles_per_op);
+        bench_detail::json_number(line, "ops", ops);
+        r.ops = static_cast<uint64_t>(ops);
+        results.push_back(r);
+    }
+    return true;
+}
+
+/**
+ * @brief Compares results against a baseline by ns/op.
+ * * A case regresses when it is slower than its baseline by more than threshold
+ * (0.10 = 10%). Cases missing from the baseline are reported but never fail.
+ * @return Number of regressed cases.
+ */
+inline int bench_compare(const std::vector<BenchResult>& current, const std::vector<BenchResult>& baseline,
+                         double threshold) {
+    int regressions = 0;
+    std::cout << std::left << std::setw(30) << "Function" << std::setw(12) << "Inputs" << std::right
+              << std::setw(12) << "base ns/op" << std::setw(12) << "ns/op" << std::setw(10) << "delta" << "\n";
+
+    for (const BenchResult& r : current) {
+        const BenchResult* base = nullptr;
+        for (const BenchResult& b : baseline) {
+            if (b.name == r.name && b.distribution == r.distribution) {
+                base = &b;
+                break;
+            }
+        }
+
+        std::cout << std::left << std::setw(30) << r.name << std::setw(12) << r.distribution << std::right
+                  << std::fixed << std::setprecision(2);
+        if (!base || base->ns_per_op <= 0.0) {
+            std::cout << std::setw(12) << "-" << std::setw(12) << r.ns_per_op << std::setw(10) << "new" << "\n";
+            continue;
+        }
+
+        double delta = (r.ns_per_op - base->ns_per_op) / base->ns_per_op;
+        bool regressed = delta > threshold;
+        if (regressed) regressions++;
+        std::cout << std::setw(12) << base->ns_per_op << std::setw(12) << r.ns_per_op
+                  << std::setw(9) << std::showpos << (100.0 * delta) << std::noshowpos << "%"
+                  << (regressed ? "  [REGRESSION]" : "") << "\n";
+    }
+    return regressions;
+}
+
+#endif // BENCH_HARNESS_HPP
@@ -0,0 +1,186 @@
+#ifndef FP_CONVERT_HPP
+#define FP_CONVERT_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+#include "fp_utils.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define FP_CONVERT_X86 1
+#endif
+
+// =========================================================
+// Scalar BF16 <-> FP32 / FP64 Conversion
+// =========================================================
+//
+// BF16 is the upper half of an FP32, so widening is a 16-bit shift and is exact for
+// every pattern: subnormals stay subnormal and NaN sign/payload bits are kept.
+// Narrowing rounds to nearest even on the dropped 16 bits; NaN becomes the canonical
+// quiet NaN 0x7FC0.
+
+/** @brief Canonical BF16 quiet NaN produced by the narrowing path. */
+constexpr uint16_t BF16_CANONICAL_QNAN = 0x7FC0;
+
+/**
+ * @brief Widens raw BF16 bits to float (exact).
+ */
+inline float bf16_to_float(uint16_t raw) {
+    uint32_t bits = static_cast<uint32_t>(raw) << 16;
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+/**
+ * @brief Widens raw BF16 bits to double (exact; NaNs are quieted by the float->double step).
+ */
+inline double bf16_to_double(uint16_t raw) {
+    return static_cast<double>(bf16_to_float(raw));
+}
+
+/**
+ * @brief Narrows a float to BF16 with Round to Nearest Even.
+ */
+inline uint16_t float_to_bf16_rne(float f) {
+    if (std::isnan(f)) return BF16_CANONICAL_QNAN;
+
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+
+    // Add 0x7FFF plus the LSB of the kept half, so exact ties round to the even result
+    uint32_t lsb = (bits >> 16) & 1;
+    bits += 0x7FFF + lsb;
+    return static_cast<uint16_t>(bits >> 16);
+}
+
+/**
+ * @brief Narrows a double to BF16 through float (double -> FP32 -> BF16, both RNE).
+ */
+inline uint16_t double_to_bf16_rne(double val) {
+    return float_to_bf16_rne(static_cast<float>(val));
+}
+
+// =========================================================
+// Batch Kernels
+// =========================================================
+
+namespace fp_convert_detail {
+    inline void bf16_to_float_scalar(const uint16_t* in, float* out, size_t n) {
+        for (size_t i = 0; i < n; ++i) out[i] = bf16_to_float(in[i]);
+    }
+
+    inline void bf16_to_double_scalar(const uint16_t* in, double* out, size_t n) {
+        for (size_t i = 0; i < n; ++i) out[i] = bf16_to_double(in[i]);
+    }
+
+    inline void float_to_bf16_scalar(const float* in, uint16_t* out, size_t n) {
+        for (size_t i = 0; i < n; ++i) out[i] = float_to_bf16_rne(in[i]);
+    }
+
+#ifdef FP_CONVERT_X86
+    /** @brief 8 BF16 -> 8 FP32: zero-extend to 32 bits and shift into the upper half. */
+    __attribute__((target("avx2")))
+    inline void bf16_to_float_avx2(const uint16_t* in, float* out, size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            __m256i w = _mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16);
+            _mm256_storeu_ps(out + i, _mm256_castsi256_ps(w));
+        }
+        bf16_to_float_scalar(in + i, out + i, n - i);
+    }
+
+    /** @brief 8 BF16 -> 8 FP64 through FP32, two cvtps2pd halves (same instruction as the scalar cast). */
+    __attribute__((target("avx2")))
+    inline void bf16_to_double_avx2(const uint16_t* in, double* out, size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            __m256 f = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16));
+            _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm256_castps256_ps128(f)));
+            _mm256_storeu_pd(out + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(f, 1)));
+        }
+        bf16_to_double_scalar(in + i, out + i, n - i);
+    }
+
+    /** @brief 8 FP32 -> 8 BF16 with RNE, NaN lanes replaced by the canonical quiet NaN. */
+    __attribute__((target("avx2")))
+    inline void float_to_bf16_avx2(const float* in, uint16_t* out, size_t n) {
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i bias = _mm256_set1_epi32(0x7FFF);
+        const __m256i qnan = _mm256_set1_epi32(BF16_CANONICAL_QNAN);
+
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256 f = _mm256_loadu_ps(in + i);
+            __m256i bits = _mm256_castps_si256(f);
+            __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), one);
+            __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(bits, _mm256_add_epi32(bias, lsb)), 16);
+            __m256i is_nan = _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_UNORD_Q));
+            rounded = _mm256_blendv_epi8(rounded, qnan, is_nan);
+
+            // Pack 8 x u32 (all <= 0xFFFF) to 8 x u16; packus works per 128-bit lane, so fix the order
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(rounded, rounded), 0xD8);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_castsi256_si128(packed));
+        }
+        float_to_bf16_scalar(in + i, out + i, n - i);
+    }
+
+    inline bool has_avx2() {
+        static const bool avx2 = []() {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+        }();
+        return avx2;
+    }
+#endif
+}
+
+/**
+ * @brief Widens n raw BF16 values to float (AVX2 when available, scalar otherwise).
+ */
+inline void bf16_to_float_batch(const uint16_t* in, float* out, size_t n) {
+#ifdef FP_CONVERT_X86
+    if (fp_convert_detail::has_avx2()) return fp_convert_detail::bf16_to_float_avx2(in, out, n);
+#endif
+    fp_convert_detail::bf16_to_float_scalar(in, out, n);
+}
+
+/**
+ * @brief Widens n raw BF16 values to double (AVX2 when available, scalar otherwise).
+ */
+inline void bf16_to_double_batch(const uint16_t* in, double* out, size_t n) {
+#ifdef FP_CONVERT_X86
+    if (fp_convert_detail::has_avx2()) return fp_convert_detail::bf16_to_double_avx2(in, out, n);
+#endif
+    fp_convert_detail::bf16_to_double_scalar(in, out, n);
+}
+
+/**
+ * @brief Narrows n floats to raw BF16 with RNE (AVX2 when available, scalar otherwise).
+ */
+inline void float_to_bf16_batch(const float* in, uint16_t* out, size_t n) {
+#ifdef FP_CONVERT_X86
+    if (fp_convert_detail::has_avx2()) return fp_convert_detail::float_to_bf16_avx2(in, out, n);
+#endif
+    fp_convert_detail::float_to_bf16_scalar(in, out, n);
+}
+
+/**
+ * @brief Batch counterpart of fp_to_double.
+ * * For BF16 this is the widening kernel: values are identical to fp_to_double, except
+ * that NaNs keep their sign/payload instead of becoming the canonical quiet NaN.
+ * Other formats fall back to fp_to_double per element.
+ */
+inline void fp_to_double_batch(const uint16_t* raw, double* out, size_t n, FPType type) {
+    if (type == FPType::BF16) {
+        bf16_to_double_batch(raw, out, n);
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) out[i] = fp_to_double(raw[i], type);
+}
+
+#endif // FP_CONVERT_HPP
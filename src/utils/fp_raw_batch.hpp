@@ -0,0 +1,318 @@
+#ifndef FP_RAW_BATCH_HPP
+#define FP_RAW_BATCH_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>   // std::aligned_alloc, std::free
+#include <new>       // std::bad_alloc
+#include <vector>
+#include "fp_utils.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FP_RAW_BATCH_X86 1
+#endif
+
+// =========================================================
+// Aligned Storage
+// =========================================================
+
+/**
+ * @brief Minimal allocator returning Align-byte aligned storage (cache line by default).
+ */
+template<typename T, size_t Align = 64>
+struct FPAlignedAllocator {
+    typedef T value_type;
+
+    FPAlignedAllocator() = default;
+    template<typename U>
+    FPAlignedAllocator(const FPAlignedAllocator<U, Align>&) {}
+
+    template<typename U>
+    struct rebind { typedef FPAlignedAllocator<U, Align> other; };
+
+    T* allocate(size_t n) {
+        size_t bytes = (n * sizeof(T) + Align - 1) / Align * Align;
+        void* p = std::aligned_alloc(Align, bytes ? bytes : Align);
+        if (!p) throw std::bad_alloc();
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t) { std::free(p); }
+
+    template<typename U>
+    bool operator==(const FPAlignedAllocator<U, Align>&) const { return true; }
+    template<typename U>
+    bool operator!=(const FPAlignedAllocator<U, Align>&) const { return false; }
+};
+
+/** @brief Cache-line aligned vector. */
+template<typename T>
+using fp_aligned_vector = std::vector<T, FPAlignedAllocator<T>>;
+
+// =========================================================
+// Structure-of-Arrays FPRaw Container
+// =========================================================
+
+/**
+ * @brief Packed per-element status bits of FPRawBatch.
+ */
+namespace fp_batch_status {
+    constexpr uint8_t ZERO = 1u << 0;
+    constexpr uint8_t DENORMAL = 1u << 1;
+    constexpr uint8_t INF = 1u << 2;
+    constexpr uint8_t NAN_ = 1u << 3;
+    constexpr uint8_t HIDDEN = 1u << 4;   // FPRaw::hidden_bit
+}
+
+/**
+ * @brief Structure-of-arrays counterpart of a std::vector<FPRaw>.
+ * * Per element: 1 sign bit, an int16_t unbiased exponent, a uint32_t mantissa and one
+ * byte of packed status (fp_batch_status), i.e. 7 bytes instead of sizeof(FPRaw) = 20.
+ * Each array is cache-line aligned so the batch loops below vectorize cleanly.
+ * Exponents are stored as int16_t, which covers every format up to FP32 (denormal
+ * exponent -149 ... 127) plus the saturating range used by fp_recompose.
+ */
+struct FPRawBatch {
+    fp_aligned_vector<uint64_t> sign;     // Bitset: bit (i % 64) of word i / 64
+    fp_aligned_vector<int16_t> exponent;  // Unbiased exponent
+    fp_aligned_vector<uint32_t> mantissa; // Explicit mantissa bits
+    fp_aligned_vector<uint8_t> status;    // fp_batch_status flags
+
+    FPRawBatch() = default;
+    explicit FPRawBatch(size_t n) { resize(n); }
+
+    size_t size() const { return exponent.size(); }
+
+    void resize(size_t n) {
+        sign.resize((n + 63) / 64);
+        exponent.resize(n);
+        mantissa.resize(n);
+        status.resize(n);
+    }
+
+    bool get_sign(size_t i) const { return (sign[i / 64] >> (i % 64)) & 1; }
+
+    void set_sign(size_t i, bool s) {
+        uint64_t bit = uint64_t(1) << (i % 64);
+        sign[i / 64] = s ? (sign[i / 64] | bit) : (sign[i / 64] & ~bit);
+    }
+
+    /** @brief Gathers element i into an FPRaw record. */
+    FPRaw get(size_t i) const {
+        FPRaw r = {};
+        uint8_t st = status[i];
+        r.sign = get_sign(i);
+        r.exponent = exponent[i];
+        r.mantissa = mantissa[i];
+        r.hidden_bit = (st & fp_batch_status::HIDDEN) != 0;
+        r.status.is_zero = (st & fp_batch_status::ZERO) != 0;
+        r.status.is_denormal = (st & fp_batch_status::DENORMAL) != 0;
+        r.status.is_inf = (st & fp_batch_status::INF) != 0;
+        r.status.is_nan = (st & fp_batch_status::NAN_) != 0;
+        return r;
+    }
+
+    /** @brief Scatters an FPRaw record into element i (exponent is narrowed to int16_t). */
+    void set(size_t i, const FPRaw& r) {
+        set_sign(i, r.sign);
+        exponent[i] = static_cast<int16_t>(r.exponent);
+        mantissa[i] = r.mantissa;
+        status[i] = static_cast<uint8_t>((r.status.is_zero ? fp_batch_status::ZERO : 0) |
+                                         (r.status.is_denormal ? fp_batch_status::DENORMAL : 0) |
+                                         (r.status.is_inf ? fp_batch_status::INF : 0) |
+                                         (r.status.is_nan ? fp_batch_status::NAN_ : 0) |
+                                         (r.hidden_bit ? fp_batch_status::HIDDEN : 0));
+    }
+};
+
+// =========================================================
+// Batch Decompose / Recompose
+// =========================================================
+
+namespace fp_batch_detail {
+    /** @brief Block size: one sign word. Full blocks have a constant trip count, which
+     * lets GCC vectorize the lane loops already at -O2. */
+    constexpr size_t BLOCK = 64;
+
+    /**
+     * @brief Decomposes lanes (<= BLOCK) payloads, returns their sign word.
+     * * Branch-free: every field is arithmetic on compare results.
+     */
+    template<FPType T, typename Bits>
+    __attribute__((always_inline)) inline uint64_t decompose_block(const Bits* __restrict raw, int16_t* __restrict exp_out,
+                                    uint32_t* __restrict mant_out, uint8_t* __restrict st_out, size_t lanes) {
+        using F = FPFormat<T>;
+        uint64_t sign_word = 0;
+
+        for (size_t j = 0; j < lanes; ++j) {
+            uint32_t payload = raw[j];
+            uint32_t magnitude = payload & F::MAGNITUDE_MASK;
+            uint32_t raw_exp = magnitude >> F::MANT_BITS;
+
+            uint32_t is_zero = (magnitude == 0);
+            uint32_t is_denormal = (magnitude - 1u) < F::MANT_MASK;
+            uint32_t is_inf = (magnitude == F::INF_BITS);
+            uint32_t is_nan = (magnitude > F::INF_BITS);
+            uint32_t is_normal = (raw_exp - 1u) < (F::EXP_MASK - 1u);
+
+            // Normal: raw - bias, denormal: 1 - bias, special: 0
+            int32_t e = static_cast<int32_t>(is_normal * raw_exp) - static_cast<int32_t>(is_normal | is_denormal) * F::BIAS +
+                        static_cast<int32_t>(is_denormal);
+            exp_out[j] = static_cast<int16_t>(e);
+            mant_out[j] = payload & F::MANT_MASK;
+            st_out[j] = static_cast<uint8_t>(is_zero * fp_batch_status::ZERO | is_denormal * fp_batch_status::DENORMAL |
+                                             is_inf * fp_batch_status::INF | is_nan * fp_batch_status::NAN_ |
+                                             is_normal * fp_batch_status::HIDDEN);
+        }
+
+        for (size_t j = 0; j < lanes; ++j) {
+            sign_word |= uint64_t((static_cast<uint32_t>(raw[j]) >> F::SIGN_SHIFT) & 1) << j;
+        }
+        return sign_word;
+    }
+
+    /**
+     * @brief Recomposes lanes (<= BLOCK) elements with the given sign word.
+     * * Special cases are applied as masks in fp_recompose priority order
+     * (zero, inf, NaN, denormal, normal with saturation).
+     */
+    template<FPType T, typename Bits>
+    __attribute__((always_inline)) inline void recompose_block(const int16_t* __restrict exp_in, const uint32_t* __restrict mant_in,
+                                const uint8_t* __restrict st_in, uint64_t sign_word, Bits* __restrict out,
+                                size_t lanes) {
+        using F = FPFormat<T>;
+
+        for (size_t j = 0; j < lanes; ++j) {
+            uint32_t st = st_in[j];
+            uint32_t m = mant_in[j];
+            int32_t temp_exp = exp_in[j] + F::BIAS;
+
+            // Normal path with saturation
+            bool underflow = temp_exp <= 0;
+            bool overflow = temp_exp >= static_cast<int32_t>(F::EXP_MASK);
+            uint32_t biased_exp = underflow ? 0 : (overflow ? F::EXP_MASK : static_cast<uint32_t>(temp_exp));
+            uint32_t mantissa = (underflow | overflow) ? 0 : m;
+
+            // Special cases, lowest priority first
+            bool den = st & fp_batch_status::DENORMAL;
+            bool nan = st & fp_batch_status::NAN_;
+            bool inf = st & fp_batch_status::INF;
+            bool zero = st & fp_batch_status::ZERO;
+            biased_exp = den ? 0 : biased_exp;
+            mantissa = den ? m : mantissa;
+            biased_exp = (nan | inf) ? F::EXP_MASK : biased_exp;
+            mantissa = nan ? (m ? m : F::QNAN_BIT) : mantissa;
+            mantissa = (inf | zero) ? 0 : mantissa;
+            biased_exp = zero ? 0 : biased_exp;
+
+            uint32_t sign = static_cast<uint32_t>(sign_word >> j) & 1;
+            uint32_t payload = (sign << F::SIGN_SHIFT) | ((biased_exp & F::EXP_MASK) << F::MANT_BITS) |
+                               (mantissa & F::MANT_MASK);
+            out[j] = static_cast<Bits>(payload & F::PAYLOAD_MASK);
+        }
+    }
+    /** @brief Block loop over [0, n), one sign word per block. */
+    template<FPType T, typename Bits>
+    __attribute__((always_inline)) inline void decompose_range(const Bits* raw, size_t n, FPRawBatch& out) {
+        size_t full = n / BLOCK * BLOCK;
+        for (size_t i = 0; i < full; i += BLOCK) {
+            out.sign[i / BLOCK] = decompose_block<T>(raw + i, out.exponent.data() + i, out.mantissa.data() + i,
+                                                     out.status.data() + i, BLOCK);
+        }
+        if (full < n) {
+            out.sign[full / BLOCK] = decompose_block<T>(raw + full, out.exponent.data() + full,
+                                                        out.mantissa.data() + full, out.status.data() + full,
+                                                        n - full);
+        }
+    }
+
+    template<FPType T, typename Bits>
+    __attribute__((always_inline)) inline void recompose_range(const FPRawBatch& in, Bits* out) {
+        const size_t n = in.size();
+        size_t full = n / BLOCK * BLOCK;
+        for (size_t i = 0; i < full; i += BLOCK) {
+            recompose_block<T>(in.exponent.data() + i, in.mantissa.data() + i, in.status.data() + i,
+                               in.sign[i / BLOCK], out + i, BLOCK);
+        }
+        if (full < n) {
+            recompose_block<T>(in.exponent.data() + full, in.mantissa.data() + full, in.status.data() + full,
+                               in.sign[full / BLOCK], out + full, n - full);
+        }
+    }
+
+#ifdef FP_RAW_BATCH_X86
+    /**
+     * @brief AVX2 builds of the block loops.
+     * * Same source; baseline SSE2 lacks the unsigned compares, 32-bit multiplies and
+     * variable shifts these loops need, so the AVX2 build is several times faster.
+     */
+    template<FPType T, typename Bits>
+    __attribute__((target("avx2"))) void decompose_range_avx2(const Bits* raw, size_t n, FPRawBatch& out) {
+        decompose_range<T>(raw, n, out);
+    }
+
+    template<FPType T, typename Bits>
+    __attribute__((target("avx2"))) void recompose_range_avx2(const FPRawBatch& in, Bits* out) {
+        recompose_range<T>(in, out);
+    }
+
+    inline bool has_avx2() {
+        static const bool avx2 = []() {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+        }();
+        return avx2;
+    }
+#endif
+}
+
+/**
+ * @brief Decomposes n payloads of format T into out (resized to n).
+ * * Element-wise identical to fp_decompose<T>. Works in blocks of 64 elements, one
+ * sign word per block; each field goes to its own array. Uses the AVX2 build of the
+ * loops when the CPU supports it.
+ *
+ * @tparam Bits uint16_t or uint32_t raw payload type.
+ */
+template<FPType T, typename Bits>
+inline void fp_decompose_batch(const Bits* raw, size_t n, FPRawBatch& out) {
+    out.resize(n);
+#ifdef FP_RAW_BATCH_X86
+    if (fp_batch_detail::has_avx2()) {
+        fp_batch_detail::decompose_range_avx2<T>(raw, n, out);
+        return;
+    }
+#endif
+    fp_batch_detail::decompose_range<T>(raw, n, out);
+}
+
+/**
+ * @brief Recomposes every element of in into raw payloads of format T (out must hold in.size()).
+ * * Element-wise identical to fp_recompose<T>, including the special-case priority
+ * and the underflow/overflow saturation.
+ */
+template<FPType T, typename Bits>
+inline void fp_recompose_batch(const FPRawBatch& in, Bits* out) {
+#ifdef FP_RAW_BATCH_X86
+    if (fp_batch_detail::has_avx2()) {
+        fp_batch_detail::recompose_range_avx2<T>(in, out);
+        return;
+    }
+#endif
+    fp_batch_detail::recompose_range<T>(in, out);
+}
+
+/**
+ * @brief Runtime-format wrappers.
+ */
+template<typename Bits>
+inline void fp_decompose_batch(const Bits* raw, size_t n, FPRawBatch& out, FPType type) {
+    fp_dispatch(type, [&](auto fmt) { fp_decompose_batch<decltype(fmt)::value>(raw, n, out); });
+}
+
+template<typename Bits>
+inline void fp_recompose_batch(const FPRawBatch& in, Bits* out, FPType type) {
+    fp_dispatch(type, [&](auto fmt) { fp_recompose_batch<decltype(fmt)::value>(in, out); });
+}
+
+#endif // FP_RAW_BATCH_HPP
@@ -0,0 +1,97 @@
+#ifndef FP_REFERENCE_HPP
+#define FP_REFERENCE_HPP
+
+#include <cstdint>
+#include <cmath>
+#include "fp_utils.hpp"
+
+// =========================================================
+// Correctly Rounded Reference Values
+// =========================================================
+//
+// A reference table stores, per input, the correctly rounded (RNE) result and the
+// rounding residual (exact value - result) as a float in units of the result's ULP.
+// result + residual recovers the exact value to about 2^-24 of an ULP, which is all the
+// ULP analysis needs, while the table stays at 6 bytes per input. Keeping the residual
+// in ULPs avoids float underflow for results deep in the subnormal range.
+
+/**
+ * @brief Correctly rounded result of one reference evaluation.
+ */
+struct FPReferenceEntry {
+    uint32_t result;   // RNE result in format T (saturates to Inf, underflows through subnormals)
+    float residual;    // (exact - result) in ULPs of result, 0 for Inf / NaN / exact results
+    bool hard;         // The extended value was too close to a rounding boundary to trust
+};
+
+/**
+ * @brief log2 of one ULP of a finite format-T value (the denormal ULP for zeros and subnormals).
+ */
+template<FPType T>
+inline int32_t fp_ulp_exponent(uint32_t raw_bits) {
+    using F = FPFormat<T>;
+    const int32_t exp_field = static_cast<int32_t>((raw_bits & F::MAGNITUDE_MASK) >> F::MANT_BITS);
+    return std::max<int32_t>(exp_field, 1) - F::BIAS - static_cast<int32_t>(F::MANT_BITS);
+}
+
+/**
+ * @brief Rounds an extended precision value to format T (Round to Nearest Even).
+ * * v is assumed accurate to a few units of long double precision. hard is set when v
+ * lies within REL_MARGIN (relative) of a midpoint between two format-T values, where
+ * that error could flip the rounding; such entries need a more precise evaluation.
+ * Pass exact = true when v is known to be exact (e.g. 2^n), so true ties are not flagged.
+ */
+template<FPType T>
+inline FPReferenceEntry fp_round_reference(long double v, bool exact = false) {
+    using F = FPFormat<T>;
+    constexpr long double REL_MARGIN = 0x1p-58L;
+
+    FPReferenceEntry entry = {0, 0.0f, false};
+    if (std::isnan(v)) {
+        entry.result = F::INF_BITS | F::QNAN_BIT;
+        return entry;
+    }
+
+    const uint32_t sign = std::signbit(v) ? (1u << F::SIGN_SHIFT) : 0u;
+    const long double a = std::fabs(v);
+    if (std::isinf(a) || a == 0.0L) {
+        entry.result = sign | (std::isinf(a) ? F::INF_BITS : 0u);
+        return entry;
+    }
+
+    // Scale so one ULP of the target binade (the denormal binade below 2^(1 - BIAS)) is 1.0
+    const int32_t unit_exp = std::max<int32_t>(std::ilogb(a), 1 - F::BIAS) - static_cast<int32_t>(F::MANT_BITS);
+    const long double q = std::ldexp(a, -unit_exp);
+    const long double q_rounded = std::nearbyint(q);   // Default rounding mode: ties to even
+    entry.hard = !exact && std::fabs(std::fabs(q - std::floor(q)) - 0.5L) <= q * REL_MARGIN;
+
+    // Binade base plus the rounded significand; a carry out of the significand moves to
+    // the next binade and past the largest binade to Inf
+    const int64_t base = static_cast<int64_t>(unit_exp + static_cast<int32_t>(F::MANT_BITS) + F::BIAS - 1) << F::MANT_BITS;
+    const int64_t magnitude = base + static_cast<int64_t>(q_rounded);
+    if (magnitude >= static_cast<int64_t>(F::INF_BITS)) {
+        entry.result = sign | F::INF_BITS;
+        return entry;
+    }
+
+    entry.result = sign | static_cast<uint32_t>(magnitude);
+    const float residual = static_cast<float>(std::ldexp(q - q_rounded, unit_exp - fp_ulp_exponent<T>(entry.result)));
+    entry.residual = sign ? -residual : residual;
+    return entry;
+}
+
+/**
+ * @brief Reference value of a table entry: result + residual ULPs (the result itself for Inf / NaN).
+ */
+template<FPType T>
+inline double fp_reference_value(uint32_t result, float residual) {
+    using F = FPFormat<T>;
+    if ((result & F::MAGNITUDE_MASK) >= F::INF_BITS) return fp_to_double<T>(result);
+    return fp_to_double<T>(result) + std::ldexp(static_cast<double>(residual), fp_ulp_exponent<T>(result));
+}
+
+inline double fp_reference_value(uint32_t result, float residual, FPType type) {
+    return fp_dispatch(type, [&](auto fmt) { return fp_reference_value<decltype(fmt)::value>(result, residual); });
+}
+
+#endif // FP_REFERENCE_HPP
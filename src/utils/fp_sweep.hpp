@@ -0,0 +1,180 @@
+#ifndef FP_SWEEP_HPP
+#define FP_SWEEP_HPP
+
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm> // std::min, std::max
+
+// =========================================================
+// Types
+// =========================================================
+
+/**
+ * @brief Options for an exhaustive bit-pattern sweep.
+ */
+struct SweepOptions {
+    unsigned num_threads = 0;    // 0 = std::thread::hardware_concurrency()
+    uint64_t max_failures = 0;   // Stop after this many failures (0 = no limit)
+    uint64_t chunk_size = 4096;  // Minimum number of patterns per work item
+};
+
+/**
+ * @brief One recorded mismatch (input pattern with expected and actual outputs).
+ */
+struct SweepMismatch {
+    uint64_t input;
+    uint64_t expected;
+    uint64_t actual;
+};
+
+/**
+ * @brief Default statistics type for sweeps that only collect mismatches.
+ * Custom statistics types must be default-constructible and provide merge().
+ */
+struct SweepNoStats {
+    void merge(const SweepNoStats&) {}
+};
+
+/**
+ * @brief Per-shard state handed to the sweep callable.
+ * * Each work item (a contiguous chunk of the range) gets its own shard, so the
+ * callable never needs synchronization.
+ */
+template<typename Stats = SweepNoStats>
+struct SweepShard {
+    Stats stats;
+    std::vector<SweepMismatch> mismatches;
+    uint64_t failures = 0;
+
+    /** @brief Records a failing pattern. */
+    void fail(uint64_t input, uint64_t expected, uint64_t actual) {
+        mismatches.push_back({input, expected, actual});
+        failures++;
+    }
+};
+
+/**
+ * @brief Merged result of a sweep.
+ * * mismatches are in increasing input order and, with max_failures set, are exactly
+ * the first max_failures failing patterns of the range, independent of thread count.
+ * stats, checked and failures are merged in chunk order up to the chunk holding the
+ * max_failures-th failure; chunks past it that other threads had already taken are
+ * discarded, so all fields are deterministic for a given range and chunk size.
+ */
+template<typename Stats = SweepNoStats>
+struct SweepResult {
+    Stats stats;
+    std::vector<SweepMismatch> mismatches;
+    uint64_t checked = 0;      // Patterns evaluated up to the end of the stopping chunk
+    uint64_t failures = 0;     // Failures found (may exceed max_failures within the stopping chunk)
+    bool stopped_early = false;
+};
+
+// =========================================================
+// Sweep Engine
+// =========================================================
+
+namespace fp_sweep_detail {
+    /** @brief Upper bound on work items, keeps per-chunk state small for 2^32 domains. */
+    constexpr uint64_t MAX_CHUNKS = 1u << 14;
+
+    inline unsigned resolve_threads(unsigned requested) {
+        unsigned n = requested ? requested : std::thread::hardware_concurrency();
+        return n ? n : 1;
+    }
+}
+
+/**
+ * @brief Runs fn over every bit pattern in [begin, end) on a pool of worker threads.
+ *
+ * The range is cut into fixed chunks that depend only on the range and chunk_size.
+ * Workers pull chunks in increasing order, which keeps the early stop deterministic:
+ * once max_failures failures have been seen no new chunks are handed out, and every
+ * chunk that could hold one of the first max_failures failures has already been taken.
+ *
+ * @param begin First pattern (inclusive).
+ * @param end   Last pattern (exclusive); up to 2^64 - 1, so 2^32 domains are fine.
+ * @param fn    Callable void(uint64_t bits, SweepShard<Stats>& shard).
+ * @param opts  Threading, chunking and early-stop options.
+ * @return Merged mismatches and statistics.
+ */
+template<typename Stats = SweepNoStats, typename Fn>
+SweepResult<Stats> fp_sweep(uint64_t begin, uint64_t end, Fn fn, const SweepOptions& opts = SweepOptions()) {
+    SweepResult<Stats> result;
+    if (end <= begin) return result;
+
+    const uint64_t range = end - begin;
+    const uint64_t min_chunk = std::max<uint64_t>(opts.chunk_size, 1);
+    const uint64_t chunk = std::max(min_chunk, (range + fp_sweep_detail::MAX_CHUNKS - 1) / fp_sweep_detail::MAX_CHUNKS);
+    const uint64_t num_chunks = (range + chunk - 1) / chunk;
+    const unsigned num_threads = static_cast<unsigned>(
+        std::min<uint64_t>(fp_sweep_detail::resolve_threads(opts.num_threads), num_chunks));
+
+    std::vector<SweepShard<Stats>> shards(num_chunks);
+    std::vector<uint64_t> checked(num_chunks, 0);
+    std::atomic<uint64_t> next_chunk(0);
+    std::atomic<uint64_t> total_failures(0);
+
+    auto worker = [&]() {
+        for (;;) {
+            if (opts.max_failures && total_failures.load(std::memory_order_relaxed) >= opts.max_failures) break;
+            uint64_t c = next_chunk.fetch_add(1, std::memory_order_relaxed);
+            if (c >= num_chunks) break;
+
+            SweepShard<Stats>& shard = shards[c];
+            uint64_t lo = begin + c * chunk;
+            uint64_t hi = (c == num_chunks - 1) ? end : lo + chunk;
+            uint64_t bits = lo;
+            for (; bits < hi; ++bits) {
+                fn(bits, shard);
+                // Later failures in this chunk cannot be among the first max_failures
+                if (opts.max_failures && shard.failures >= opts.max_failures) {
+                    ++bits;
+                    break;
+                }
+            }
+            checked[c] = bits - lo;
+            if (shard.failures) total_failures.fetch_add(shard.failures, std::memory_order_relaxed);
+        }
+    };
+
+    if (num_threads <= 1) {
+        worker();
+    } else {
+        std::vector<std::thread> pool;
+        pool.reserve(num_threads);
+        for (unsigned t = 0; t < num_threads; ++t) pool.emplace_back(worker);
+        for (auto& th : pool) th.join();
+    }
+
+    // Deterministic reduction in chunk order; chunks after the max_failures-th failure
+    // depend on scheduling and are dropped
+    for (uint64_t c = 0; c < num_chunks; ++c) {
+        if (opts.max_failures && result.failures >= opts.max_failures) break;
+        result.stats.merge(shards[c].stats);
+        result.checked += checked[c];
+        result.failures += shards[c].failures;
+        for (const auto& m : shards[c].mismatches) {
+            if (opts.max_failures && result.mismatches.size() >= opts.max_failures) break;
+            result.mismatches.push_back(m);
+        }
+    }
+    result.stopped_early = (result.checked < range);
+
+    return result;
+}
+
+/**
+ * @brief Convenience wrapper: parallel map of fn over [begin, end) without failure tracking.
+ * @param fn Callable void(uint64_t bits).
+ */
+template<typename Fn>
+void fp_sweep_for_each(uint64_t begin, uint64_t end, Fn fn, const SweepOptions& opts = SweepOptions()) {
+    SweepOptions map_opts = opts;
+    map_opts.max_failures = 0;
+    fp_sweep(begin, end, [&fn](uint64_t bits, SweepShard<SweepNoStats>&) { fn(bits); }, map_opts);
+}
+
+#endif // FP_SWEEP_HPP
@@ -2,10 +2,13 @@
 #define FP_UTILS_HPP
 
 #include <cstdint>
+#include <cstddef>   // size_t
+#include <cstring>   // std::memcpy
 #include <stdexcept>
 #include <cmath>     // std::abs, std::ilogb, std::scalbn, std::isnan, std::isinf
 #include <limits>    // std::numeric_limits
 #include <algorithm> // std::max
+#include <type_traits> // std::integral_constant
 
 // =========================================================
 // Types and Constants
@@ -75,90 +78,109 @@ struct FPRaw {
     FPStatus status;
 };
 
+/**
+ * @brief Compile-time geometry of a Floating Point format.
+ * * All masks and shifts are constants, so the templated logic functions below
+ * compile to straight-line code without a config lookup.
+ */
+template<FPType T>
+struct FPFormat {
+    static constexpr FPConfig cfg = get_fp_config(T);
+
+    static constexpr uint32_t TOTAL_BITS = cfg.total_bits;
+    static constexpr uint32_t EXP_BITS = cfg.exp_bits;
+    static constexpr uint32_t MANT_BITS = cfg.mant_bits;
+    static constexpr int32_t BIAS = cfg.bias;
+
+    static constexpr uint32_t EXP_MASK = cfg.exp_mask();
+    static constexpr uint32_t MANT_MASK = cfg.mant_mask();
+    static constexpr uint32_t PAYLOAD_MASK = (TOTAL_BITS == 32) ? 0xFFFFFFFFu : ((1u << TOTAL_BITS) - 1u);
+    static constexpr uint32_t SIGN_SHIFT = TOTAL_BITS - 1;
+    static constexpr uint32_t MAGNITUDE_MASK = PAYLOAD_MASK >> 1;       // Exponent and mantissa fields
+    static constexpr uint32_t INF_BITS = EXP_MASK << MANT_BITS;         // Magnitude of Inf
+    static constexpr uint32_t QNAN_BIT = 1u << (MANT_BITS - 1);
+};
+
+/**
+ * @brief Calls fn with std::integral_constant<FPType, type>, turning a runtime FPType
+ * into a template argument. To add a new format, add a case here and in get_fp_config.
+ */
+template<typename Fn>
+inline decltype(auto) fp_dispatch(FPType type, Fn&& fn) {
+    switch (type) {
+        case FPType::BF16:
+            return fn(std::integral_constant<FPType, FPType::BF16>());
+
+        // case FPType::FP32: return fn(std::integral_constant<FPType, FPType::FP32>());
+
+        default:
+            // Fallback, mirrors get_fp_config
+            return fn(std::integral_constant<FPType, FPType::BF16>());
+    }
+}
+
 // =========================================================
-// Logic Functions (Generic Implementation)
+// Logic Functions (Compile-Time Format)
 // =========================================================
 
 /**
- * @brief Classifies the raw bits based on the format configuration.
+ * @brief Classifies the raw bits of format T.
+ * * Each flag is a single compare on the sign-less magnitude, so the classification
+ * is branch-free.
  */
-inline FPStatus fp_classify(uint32_t raw_bits, FPType type) {
-    FPStatus status = {false, false, false, false};
-    
-    // Get configuration for the requested type
-    const FPConfig cfg = get_fp_config(type);
+template<FPType T>
+inline FPStatus fp_classify(uint32_t raw_bits) {
+    using F = FPFormat<T>;
 
-    // Filter valid bits for this format
-    uint32_t payload_mask = (cfg.total_bits == 32) ? 0xFFFFFFFF : ((1u << cfg.total_bits) - 1);
-    uint32_t masked_payload = raw_bits & payload_mask;
-
-    // Extract raw fields using generic config
-    uint32_t raw_mantissa = masked_payload & cfg.mant_mask();
-    uint32_t raw_exp = (masked_payload >> cfg.mant_bits) & cfg.exp_mask();
+    // Exponent and mantissa fields without the sign (bits above the format are ignored)
+    uint32_t magnitude = raw_bits & F::MAGNITUDE_MASK;
 
     // Check classification logic (IEEE-754 standard style)
-    if (raw_exp == 0) {
-        if (raw_mantissa == 0) {
-            status.is_zero = true;
-        } else {
-            status.is_denormal = true;
-        }
-    } else if (raw_exp == cfg.exp_mask()) { // Exponent is all 1s
-        if (raw_mantissa == 0) {
-            status.is_inf = true;
-        } else {
-            status.is_nan = true;
-        }
-    } 
-    // Else: Normal number
-
+    // Zero: all clear. Denormal: exponent 0, mantissa != 0. Inf: exponent all 1s, mantissa 0.
+    // NaN: anything above Inf.
+    FPStatus status;
+    status.is_zero = (magnitude == 0);
+    status.is_denormal = (magnitude - 1u) < F::MANT_MASK;
+    status.is_inf = (magnitude == F::INF_BITS);
+    status.is_nan = (magnitude > F::INF_BITS);
     return status;
 }
 
 /**
- * @brief Decomposes payload into structural components using generic config.
+ * @brief Decomposes a payload of format T into structural components.
  */
-inline FPRaw fp_decompose(uint32_t payload, FPType type) {
+template<FPType T>
+inline FPRaw fp_decompose(uint32_t payload) {
+    using F = FPFormat<T>;
     FPRaw result = {};
-    const FPConfig cfg = get_fp_config(type);
 
     // 0. Classify
-    result.status = fp_classify(payload, type);
+    result.status = fp_classify<T>(payload);
 
-    // 1. Extract Sign
-    // Sign bit is always at position (total_bits - 1)
-    result.sign = (payload >> (cfg.total_bits - 1)) & 0x1;
+    // 1. Extract Sign (always at position TOTAL_BITS - 1)
+    result.sign = (payload >> F::SIGN_SHIFT) & 0x1;
 
     // 2. Extract Raw Fields
-    uint32_t raw_mantissa = payload & cfg.mant_mask();
-    uint32_t raw_exp = (payload >> cfg.mant_bits) & cfg.exp_mask();
-
-    result.mantissa = raw_mantissa;
-
-    // 3. Logic for Unbiased Exponent and Hidden Bit
-    if (result.status.is_zero || result.status.is_inf || result.status.is_nan) {
-        result.exponent = 0; // Irrelevant for special cases
-        result.hidden_bit = 0;
-    } else if (result.status.is_denormal) {
-        // Denormal: Exponent is fixed to (1 - Bias)
-        result.exponent = 1 - cfg.bias;
-        result.hidden_bit = 0;
-    } else {
-        // Normal: Unbiased = Raw - Bias
-        result.exponent = static_cast<int32_t>(raw_exp) - cfg.bias;
-        result.hidden_bit = 1;
-    }
+    uint32_t raw_exp = (payload >> F::MANT_BITS) & F::EXP_MASK;
+    result.mantissa = payload & F::MANT_MASK;
+
+    // 3. Unbiased Exponent and Hidden Bit
+    // Normal: Raw - Bias, hidden 1. Denormal: 1 - Bias, hidden 0. Zero/Inf/NaN: 0, hidden 0.
+    bool is_normal = (raw_exp != 0) & (raw_exp != F::EXP_MASK);
+    result.hidden_bit = is_normal;
+    result.exponent = is_normal ? static_cast<int32_t>(raw_exp) - F::BIAS
+                                : (result.status.is_denormal ? 1 - F::BIAS : 0);
 
     return result;
 }
 
 /**
- * @brief Recomposes structure into raw bits using generic config.
+ * @brief Recomposes structure of format T into raw bits.
  */
-inline uint32_t fp_recompose(const FPRaw& components, FPType type) {
-    const FPConfig cfg = get_fp_config(type);
-    
-    uint32_t payload = 0;
+template<FPType T>
+inline uint32_t fp_recompose(const FPRaw& components) {
+    using F = FPFormat<T>;
+
     uint32_t biased_exp = 0;
     uint32_t mantissa = 0;
 
@@ -167,78 +189,58 @@ inline uint32_t fp_recompose(const FPRaw& components, FPType type) {
         biased_exp = 0;
         mantissa = 0;
     } else if (components.status.is_inf) {
-        biased_exp = cfg.exp_mask(); // All 1s
+        biased_exp = F::EXP_MASK; // All 1s
         mantissa = 0;
     } else if (components.status.is_nan) {
-        biased_exp = cfg.exp_mask(); // All 1s
+        biased_exp = F::EXP_MASK; // All 1s
         // Maintain payload if present, else set default QNaN bit (MSB of mantissa)
-        mantissa = (components.mantissa == 0) ? (1u << (cfg.mant_bits - 1)) : components.mantissa;
-        mantissa &= cfg.mant_mask();
+        mantissa = (components.mantissa == 0) ? F::QNAN_BIT : components.mantissa;
+    } else if (components.status.is_denormal) {
+        // B. Denormal
+        biased_exp = 0;
+        mantissa = components.mantissa;
     } else {
-        // B. Handle Normal/Denormal
-        if (components.status.is_denormal) {
+        // C. Normal, with simple saturation logic for modeling purposes
+        int32_t temp_exp = components.exponent + F::BIAS;
+        if (temp_exp <= 0) {
+            // Underflow to zero (simplified)
             biased_exp = 0;
-            mantissa = components.mantissa;
+            mantissa = 0;
+        } else if (temp_exp >= static_cast<int32_t>(F::EXP_MASK)) {
+            // Overflow to Infinity
+            biased_exp = F::EXP_MASK;
+            mantissa = 0;
         } else {
-            // Normal
-            int32_t temp_exp = components.exponent + cfg.bias;
-
-            // Simple saturation logic for modeling purposes
-            if (temp_exp <= 0) {
-                // Underflow to zero (simplified)
-                biased_exp = 0; 
-                mantissa = 0; 
-            } else if (temp_exp >= (int32_t)cfg.exp_mask()) {
-                // Overflow to Infinity
-                biased_exp = cfg.exp_mask();
-                mantissa = 0;
-            } else {
-                biased_exp = static_cast<uint32_t>(temp_exp);
-                mantissa = components.mantissa;
-            }
+            biased_exp = static_cast<uint32_t>(temp_exp);
+            mantissa = components.mantissa;
         }
     }
 
-    // 1. Pack Sign
-    if (components.sign) {
-        payload |= (1u << (cfg.total_bits - 1));
-    }
-
-    // 2. Pack Exponent
-    payload |= ((biased_exp & cfg.exp_mask()) << cfg.mant_bits);
-
-    // 3. Pack Mantissa
-    payload |= (mantissa & cfg.mant_mask());
+    // Pack Sign, Exponent and Mantissa
+    uint32_t payload = (static_cast<uint32_t>(components.sign) << F::SIGN_SHIFT) |
+                       ((biased_exp & F::EXP_MASK) << F::MANT_BITS) |
+                       (mantissa & F::MANT_MASK);
 
     // Final Mask to ensure cleanliness
-    uint32_t total_mask = (cfg.total_bits == 32) ? 0xFFFFFFFF : ((1u << cfg.total_bits) - 1);
-    return payload & total_mask;
+    return payload & F::PAYLOAD_MASK;
 }
 
-// =========================================================
-// Analysis and Conversion Utilities
-// =========================================================
-
 /**
- * @brief Converts a raw integer representation of a floating point value
- * (of a given FPType) into a standard C++ double.
- * * This is useful for analyzing the numeric value of custom formats (like BF16)
- * using standard double-precision arithmetic.
- * * @param raw_bits The raw bit payload of the number.
- * @param type     The floating point format configuration.
- * @return double  The numerical value represented by the raw bits.
+ * @brief Converts raw bits of format T into a standard C++ double.
  */
-inline double fp_to_double(uint32_t raw_bits, FPType type) {
+template<FPType T>
+inline double fp_to_double(uint32_t raw_bits) {
+    using F = FPFormat<T>;
+
     // 1. Decompose the raw bits into components (Sign, Exponent, Mantissa)
-    FPRaw parts = fp_decompose(raw_bits, type);
-    const FPConfig cfg = get_fp_config(type);
+    FPRaw parts = fp_decompose<T>(raw_bits);
 
     // 2. Handle Special Cases based on status
     if (parts.status.is_nan) {
         return std::numeric_limits<double>::quiet_NaN();
     }
     if (parts.status.is_inf) {
-        return parts.sign ? -std::numeric_limits<double>::infinity() 
+        return parts.sign ? -std::numeric_limits<double>::infinity()
                           : std::numeric_limits<double>::infinity();
     }
     if (parts.status.is_zero) {
@@ -248,21 +250,58 @@ inline double fp_to_double(uint32_t raw_bits, FPType type) {
 
     // 3. Reconstruct value for Normal and Denormal numbers
     // Formula: (-1)^S * 2^E * (HiddenBit + MantissaFraction)
-    
-    // Calculate mantissa fraction: mantissa / 2^(mant_bits)
-    double mant_fraction = static_cast<double>(parts.mantissa) / (1UL << cfg.mant_bits);
-    
-    // Add hidden bit (1 for normal, 0 for denormal)
-    double significand = static_cast<double>(parts.hidden_bit) + mant_fraction;
+    constexpr double MANT_SCALE = 1.0 / static_cast<double>(1ull << F::MANT_BITS);
+    double significand = static_cast<double>(parts.hidden_bit) + static_cast<double>(parts.mantissa) * MANT_SCALE;
 
-    // Apply exponent using scalbn (efficient multiplication by power of 2)
-    // parts.exponent is already unbiased by fp_decompose
+    // Apply exponent using scalbn (parts.exponent is already unbiased by fp_decompose)
     double abs_value = std::scalbn(significand, parts.exponent);
 
     // 4. Apply Sign
     return parts.sign ? -abs_value : abs_value;
 }
 
+// =========================================================
+// Logic Functions (Runtime Format)
+// =========================================================
+
+/**
+ * @brief Classifies the raw bits based on the format configuration.
+ */
+inline FPStatus fp_classify(uint32_t raw_bits, FPType type) {
+    return fp_dispatch(type, [&](auto fmt) { return fp_classify<decltype(fmt)::value>(raw_bits); });
+}
+
+/**
+ * @brief Decomposes payload into structural components using generic config.
+ */
+inline FPRaw fp_decompose(uint32_t payload, FPType type) {
+    return fp_dispatch(type, [&](auto fmt) { return fp_decompose<decltype(fmt)::value>(payload); });
+}
+
+/**
+ * @brief Recomposes structure into raw bits using generic config.
+ */
+inline uint32_t fp_recompose(const FPRaw& components, FPType type) {
+    return fp_dispatch(type, [&](auto fmt) { return fp_recompose<decltype(fmt)::value>(components); });
+}
+
+// =========================================================
+// Analysis and Conversion Utilities
+// =========================================================
+
+/**
+ * @brief Converts a raw integer representation of a floating point value
+ * (of a given FPType) into a standard C++ double.
+ * * This is useful for analyzing the numeric value of custom formats (like BF16)
+ * using standard double-precision arithmetic.
+ * * @param raw_bits The raw bit payload of the number.
+ * @param type     The floating point format configuration.
+ * @return double  The numerical value represented by the raw bits.
+ */
+inline double fp_to_double(uint32_t raw_bits, FPType type) {
+    return fp_dispatch(type, [&](auto fmt) { return fp_to_double<decltype(fmt)::value>(raw_bits); });
+}
+
 /**
  * @brief Calculates the error in Units in the Last Place (ULP).
  * * Measures the distance between the reference value and the test value
@@ -322,4 +361,178 @@ inline double calculate_ulp_error(double ref, double val, FPType type) {
     return diff / one_ulp;
 }
 
+// =========================================================
+// Integer-Domain ULP Distance
+// =========================================================
+//
+// When both values are representable in the target format, ULP distances follow from
+// the bit patterns: sign-magnitude payloads map to ordered integers, and the scaled
+// difference of two significands is exact in a uint64_t. calculate_ulp_error is only
+// needed when the reference carries more precision than the format.
+
+/** @brief ulp_distance_bits result when either operand is NaN. */
+constexpr uint64_t ULP_DISTANCE_NAN = std::numeric_limits<uint64_t>::max();
+
+namespace fp_ulp_detail {
+    /** @brief Sign-magnitude payload -> ordered integer (+0 and -0 both map to 0). */
+    template<FPType T>
+    inline int64_t ordered_key(uint32_t raw_bits) {
+        using F = FPFormat<T>;
+        int64_t magnitude = raw_bits & F::MAGNITUDE_MASK;
+        return ((raw_bits >> F::SIGN_SHIFT) & 1) ? -magnitude : magnitude;
+    }
+
+    /**
+     * @brief Largest exponent gap for which |ref - val| of two format-T values is exact in
+     * double (the integer difference needs MANT_BITS + 2 + gap bits).
+     */
+    template<FPType T>
+    constexpr int32_t max_exact_gap() {
+        return 53 - static_cast<int32_t>(FPFormat<T>::MANT_BITS) - 2;
+    }
+}
+
+/**
+ * @brief Distance in ULPs between two raw values of format T, counted as the number of
+ * representable values stepped over.
+ * * Crosses zero without counting -0 (so the smallest negative and positive subnormals are
+ * 2 apart), steps through subnormals uniformly and treats Inf as the value after the
+ * largest finite one.
+ * @return The distance, or ULP_DISTANCE_NAN if either value is NaN.
+ */
+template<FPType T>
+inline uint64_t ulp_distance_bits(uint32_t a_raw, uint32_t b_raw) {
+    using F = FPFormat<T>;
+    if ((a_raw & F::MAGNITUDE_MASK) > F::INF_BITS || (b_raw & F::MAGNITUDE_MASK) > F::INF_BITS) {
+        return ULP_DISTANCE_NAN;
+    }
+    int64_t d = fp_ulp_detail::ordered_key<T>(a_raw) - fp_ulp_detail::ordered_key<T>(b_raw);
+    return static_cast<uint64_t>(d < 0 ? -d : d);
+}
+
+/**
+ * @brief calculate_ulp_error for a reference that is itself a format-T value.
+ * * Returns exactly calculate_ulp_error(fp_to_double<T>(ref_raw), fp_to_double<T>(val_raw), T):
+ * the error is |ref - val| in units of ref's ULP, with the same denormal clamp. Finite
+ * pairs whose exponents are close enough for the double subtraction to be exact use
+ * integer arithmetic; Inf / NaN and far-apart pairs take the double path.
+ */
+template<FPType T>
+inline double ulp_error_bits(uint32_t ref_raw, uint32_t val_raw) {
+    using F = FPFormat<T>;
+    const uint32_t ref_mag = ref_raw & F::MAGNITUDE_MASK;
+    const uint32_t val_mag = val_raw & F::MAGNITUDE_MASK;
+
+    if (ref_mag < F::INF_BITS && val_mag < F::INF_BITS) {
+        // value = +-M * 2^(E - BIAS - MANT_BITS), with E = 1 for the denormal binade
+        const int32_t ref_e = std::max<int32_t>(ref_mag >> F::MANT_BITS, 1);
+        const int32_t val_e = std::max<int32_t>(val_mag >> F::MANT_BITS, 1);
+        const int32_t gap = ref_e - val_e;
+
+        if (gap <= fp_ulp_detail::max_exact_gap<T>() && -gap <= fp_ulp_detail::max_exact_gap<T>()) {
+            const uint32_t hidden = 1u << F::MANT_BITS;
+            int64_t ref_m = (ref_mag & F::MANT_MASK) | ((ref_mag >= hidden) ? hidden : 0);
+            int64_t val_m = (val_mag & F::MANT_MASK) | ((val_mag >= hidden) ? hidden : 0);
+            if ((ref_raw >> F::SIGN_SHIFT) & 1) ref_m = -ref_m;
+            if ((val_raw >> F::SIGN_SHIFT) & 1) val_m = -val_m;
+
+            // Align both to the finer of the two binades; the result is in units of ref's ULP
+            int64_t d = (gap >= 0) ? (ref_m * (int64_t(1) << gap)) - val_m : ref_m - val_m * (int64_t(1) << -gap);
+            double diff = static_cast<double>(d < 0 ? -d : d);
+            return (gap > 0) ? std::ldexp(diff, -gap) : diff;
+        }
+    }
+
+    return calculate_ulp_error(fp_to_double<T>(ref_raw), fp_to_double<T>(val_raw), T);
+}
+
+/**
+ * @brief Returns true (and the raw bits) if v is exactly representable in format T.
+ * * Inf / NaN report false, so callers fall back to the double path for them.
+ */
+template<FPType T>
+inline bool fp_from_double_exact(double v, uint32_t& raw_bits) {
+    using F = FPFormat<T>;
+    uint64_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+
+    const uint32_t sign = static_cast<uint32_t>(bits >> 63) << F::SIGN_SHIFT;
+    const int32_t d_exp = static_cast<int32_t>((bits >> 52) & 0x7FF);
+    const uint64_t d_mant = bits & ((uint64_t(1) << 52) - 1);
+    constexpr int32_t DROP = 52 - static_cast<int32_t>(F::MANT_BITS);
+
+    if (d_exp == 0) {
+        // Only zero: double denormals are far below any narrower format
+        raw_bits = sign;
+        return d_mant == 0;
+    }
+
+    const int32_t e = d_exp - 1023;
+    if (e > static_cast<int32_t>(F::EXP_MASK) - 1 - F::BIAS) return false;  // Inf / NaN or too large
+
+    if (e >= 1 - F::BIAS) {
+        // Normal in T: dropped mantissa bits must be zero
+        if (d_mant & ((uint64_t(1) << DROP) - 1)) return false;
+        raw_bits = sign | (static_cast<uint32_t>(e + F::BIAS) << F::MANT_BITS) | static_cast<uint32_t>(d_mant >> DROP);
+        return true;
+    }
+
+    // Subnormal in T: the full significand shifts right by s more bits
+    const int32_t s = (1 - F::BIAS) - e;
+    if (s > static_cast<int32_t>(F::MANT_BITS)) return false;
+    const uint64_t significand = d_mant | (uint64_t(1) << 52);
+    if (significand & ((uint64_t(1) << (DROP + s)) - 1)) return false;
+    raw_bits = sign | static_cast<uint32_t>(significand >> (DROP + s));
+    return true;
+}
+
+/**
+ * @brief calculate_ulp_error against a raw format-T result.
+ * * Takes the integer path when ref is representable in T (e.g. a correctly rounded
+ * golden reference); a higher precision ref falls back to calculate_ulp_error.
+ * Same result as calculate_ulp_error(ref, fp_to_double<T>(val_raw), T) in both cases.
+ */
+template<FPType T>
+inline double calculate_ulp_error_raw(double ref, uint32_t val_raw) {
+    uint32_t ref_raw;
+    if (fp_from_double_exact<T>(ref, ref_raw)) return ulp_error_bits<T>(ref_raw, val_raw);
+    return calculate_ulp_error(ref, fp_to_double<T>(val_raw), T);
+}
+
+/**
+ * @brief Runtime-format wrappers.
+ */
+inline uint64_t ulp_distance_bits(uint32_t a_raw, uint32_t b_raw, FPType type) {
+    return fp_dispatch(type, [&](auto fmt) { return ulp_distance_bits<decltype(fmt)::value>(a_raw, b_raw); });
+}
+
+inline double ulp_error_bits(uint32_t ref_raw, uint32_t val_raw, FPType type) {
+    return fp_dispatch(type, [&](auto fmt) { return ulp_error_bits<decltype(fmt)::value>(ref_raw, val_raw); });
+}
+
+inline double calculate_ulp_error_raw(double ref, uint32_t val_raw, FPType type) {
+    return fp_dispatch(type, [&](auto fmt) { return calculate_ulp_error_raw<decltype(fmt)::value>(ref, val_raw); });
+}
+
+/**
+ * @brief Batch ulp_distance_bits over n pairs (the format is resolved once, outside the loop).
+ * @tparam Bits uint16_t or uint32_t raw payload type.
+ */
+template<typename Bits>
+inline void ulp_distance_bits_batch(const Bits* a_raw, const Bits* b_raw, uint64_t* out, size_t n, FPType type) {
+    fp_dispatch(type, [&](auto fmt) {
+        for (size_t i = 0; i < n; ++i) out[i] = ulp_distance_bits<decltype(fmt)::value>(a_raw[i], b_raw[i]);
+    });
+}
+
+/**
+ * @brief Batch ulp_error_bits over n (reference, value) pairs.
+ */
+template<typename Bits>
+inline void ulp_error_bits_batch(const Bits* ref_raw, const Bits* val_raw, double* out, size_t n, FPType type) {
+    fp_dispatch(type, [&](auto fmt) {
+        for (size_t i = 0; i < n; ++i) out[i] = ulp_error_bits<decltype(fmt)::value>(ref_raw[i], val_raw[i]);
+    });
+}
+
 #endif // FP_UTILS_HPP
\ No newline at end of file
@@ -0,0 +1,442 @@
+#ifndef GOLDEN_IO_HPP
+#define GOLDEN_IO_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <utility>   // std::move
+#include <fcntl.h>     // open
+#include <unistd.h>    // close
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
+#include "fp_utils.hpp"
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Golden binary files are stored little-endian");
+
+// =========================================================
+// Binary Golden-Reference Format
+// =========================================================
+//
+// Layout (all fields little-endian):
+//   [0, 64)              GoldenHeader
+//   [results_offset, ..) uint16_t results[count]   (result for input first_input + i)
+//   [values_offset, ..)  float values[count]       (optional, e.g. ULP error or reference value)
+//
+// Inputs are implicit: the tables are dense over [first_input, first_input + count),
+// so a lookup is a single index and the arrays can be used straight from the mapping.
+
+/**
+ * @brief Kind of data stored in a golden file.
+ */
+enum class GoldenFormat : uint16_t {
+    ApproxOutput = 1,  // Approximation output per input
+    UlpReport = 2,     // Approximation output + ULP error per input
+    Reference = 3,     // Correctly rounded result (+ rounding residual in ULPs, fp_reference.hpp) per input
+};
+
+/**
+ * @brief Function the table was generated for.
+ */
+enum class GoldenFunction : uint16_t {
+    Unknown = 0,
+    Exp = 1,
+};
+
+/**
+ * @brief Base of the exponential (None for functions without a base).
+ */
+enum class GoldenBase : uint16_t {
+    None = 0,
+    Two = 2,
+    E = 0xE,
+};
+
+namespace golden_io {
+    constexpr char MAGIC[8] = {'B', 'F', 'G', 'O', 'L', 'D', '\r', '\n'};
+    constexpr uint16_t VERSION = 1;
+    constexpr uint64_t PAYLOAD_ALIGN = 64;
+
+    /** @brief Header flag: the values array is present. */
+    constexpr uint32_t FLAG_HAS_VALUES = 1u << 0;
+
+    inline uint64_t align_up(uint64_t v, uint64_t a) { return (v + a - 1) / a * a; }
+}
+
+/**
+ * @brief On-disk header (64 bytes).
+ */
+struct GoldenHeader {
+    char magic[8];
+    uint16_t version;
+    uint16_t format;          // GoldenFormat
+    uint16_t function;        // GoldenFunction
+    uint16_t base;            // GoldenBase
+    uint32_t fp_type;         // FPType of inputs and results
+    uint32_t flags;           // golden_io::FLAG_*
+    uint64_t first_input;     // Input pattern of results[0]
+    uint64_t count;           // Number of entries
+    uint64_t config_hash;     // Hash of the datapath configuration (0 = not recorded)
+    uint64_t results_offset;  // Byte offset of results
+    uint64_t values_offset;   // Byte offset of values (0 if absent)
+};
+
+static_assert(sizeof(GoldenHeader) == 64, "GoldenHeader must stay 64 bytes");
+
+/**
+ * @brief Metadata supplied when writing a golden file.
+ */
+struct GoldenInfo {
+    GoldenFormat format = GoldenFormat::ApproxOutput;
+    GoldenFunction function = GoldenFunction::Unknown;
+    GoldenBase base = GoldenBase::None;
+    FPType fp_type = FPType::BF16;
+    uint64_t first_input = 0;
+    uint64_t config_hash = 0;
+};
+
+/**
+ * @brief Returns true if the file starts with the binary golden magic.
+ */
+inline bool golden_is_binary(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    char magic[sizeof(golden_io::MAGIC)];
+    if (!f.read(magic, sizeof(magic))) return false;
+    return std::memcmp(magic, golden_io::MAGIC, sizeof(magic)) == 0;
+}
+
+/**
+ * @brief Writes a binary golden file.
+ * * @param values Optional per-entry float array (nullptr to omit).
+ * @return false (with a message in *error) on I/O failure.
+ */
+inline bool golden_write_binary(const std::string& path, const GoldenInfo& info,
+                                const uint16_t* results, const float* values, uint64_t count,
+                                std::string* error = nullptr) {
+    // The payload offsets must not wrap: results (and values) start after one alignment block each
+    if (count > (UINT64_MAX - 2 * golden_io::PAYLOAD_ALIGN) / (sizeof(uint16_t) + sizeof(float))) {
+        if (error) *error = "Entry count too large for " + path;
+        return false;
+    }
+
+    GoldenHeader hdr = {};
+    std::memcpy(hdr.magic, golden_io::MAGIC, sizeof(hdr.magic));
+    hdr.version = golden_io::VERSION;
+    hdr.format = static_cast<uint16_t>(info.format);
+    hdr.function = static_cast<uint16_t>(info.function);
+    hdr.base = static_cast<uint16_t>(info.base);
+    hdr.fp_type = static_cast<uint32_t>(info.fp_type);
+    hdr.flags = values ? golden_io::FLAG_HAS_VALUES : 0;
+    hdr.first_input = info.first_input;
+    hdr.count = count;
+    hdr.config_hash = info.config_hash;
+    hdr.results_offset = golden_io::PAYLOAD_ALIGN;
+    uint64_t results_end = hdr.results_offset + count * sizeof(uint16_t);
+    hdr.values_offset = values ? golden_io::align_up(results_end, golden_io::PAYLOAD_ALIGN) : 0;
+
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    if (!f.is_open()) {
+        if (error) *error = "Could not open " + path + " for writing";
+        return false;
+    }
+
+    std::vector<char> pad(golden_io::PAYLOAD_ALIGN, 0);
+    f.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+    f.write(pad.data(), hdr.results_offset - sizeof(hdr));
+    f.write(reinterpret_cast<const char*>(results), count * sizeof(uint16_t));
+    if (values) {
+        f.write(pad.data(), hdr.values_offset - results_end);
+        f.write(reinterpret_cast<const char*>(values), count * sizeof(float));
+    }
+
+    if (!f) {
+        if (error) *error = "Write to " + path + " failed";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Read-only golden table, backed either by an mmap of a binary file or by a
+ * parsed text file.
+ * * results() and values() point straight into the mapping for binary files, so opening
+ * a table costs one mmap regardless of its size. Text files ("HEX_IN HEX_OUT [VALUE]"
+ * per line, dense and increasing) are parsed into owned buffers and exposed through the
+ * same interface, which keeps the existing .txt goldens usable.
+ */
+class GoldenFile {
+public:
+    GoldenFile() = default;
+    ~GoldenFile() { close(); }
+
+    GoldenFile(const GoldenFile&) = delete;
+    GoldenFile& operator=(const GoldenFile&) = delete;
+
+    GoldenFile(GoldenFile&& other) noexcept { *this = std::move(other); }
+    GoldenFile& operator=(GoldenFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            map_ = other.map_;
+            map_size_ = other.map_size_;
+            hdr_ = other.hdr_;
+            results_ = other.results_;
+            values_ = other.values_;
+            owned_results_ = std::move(other.owned_results_);
+            owned_values_ = std::move(other.owned_values_);
+            if (!map_) {
+                results_ = owned_results_.data();
+                values_ = owned_values_.empty() ? nullptr : owned_values_.data();
+            }
+            other.map_ = nullptr;
+            other.map_size_ = 0;
+            other.results_ = nullptr;
+            other.values_ = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Opens a golden file, detecting binary vs text by the magic.
+     * @return false (with a message in *error) if the file is missing or malformed.
+     */
+    bool open(const std::string& path, std::string* error = nullptr) {
+        return golden_is_binary(path) ? open_binary(path, error) : open_text(path, error);
+    }
+
+    /** @brief Maps a binary golden file. */
+    bool open_binary(const std::string& path, std::string* error = nullptr) {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return fail(error, "Could not open " + path);
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < sizeof(GoldenHeader)) {
+            ::close(fd);
+            return fail(error, path + ": file too short for a golden header");
+        }
+
+        void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (map == MAP_FAILED) return fail(error, "mmap of " + path + " failed");
+
+        map_ = map;
+        map_size_ = st.st_size;
+        std::memcpy(&hdr_, map_, sizeof(hdr_));
+
+        std::string problem = validate();
+        if (!problem.empty()) {
+            close();
+            return fail(error, path + ": " + problem);
+        }
+
+        const char* base = static_cast<const char*>(map_);
+        results_ = reinterpret_cast<const uint16_t*>(base + hdr_.results_offset);
+        values_ = has_values() ? reinterpret_cast<const float*>(base + hdr_.values_offset) : nullptr;
+        return true;
+    }
+
+    /**
+     * @brief Parses a text golden file.
+     * * Two columns give an ApproxOutput table, three columns an UlpReport table
+     * ("NaN" / "Inf" are accepted in the value column). Function and base are not
+     * recorded in text files and are left Unknown / None.
+     */
+    bool open_text(const std::string& path, std::string* error = nullptr) {
+        close();
+        std::ifstream infile(path);
+        if (!infile.is_open()) return fail(error, "Could not open " + path);
+
+        std::string line;
+        int line_no = 0;
+        int columns = 0;
+        while (std::getline(infile, line)) {
+            line_no++;
+            // Skip empty lines or comments
+            if (line.empty() || line[0] == '/' || line[0] == '#') continue;
+
+            std::istringstream iss(line);
+            std::string hex_input, hex_output, value;
+            if (!(iss >> hex_input >> hex_output)) {
+                return fail(error, path + ":" + std::to_string(line_no) + ": could not parse line");
+            }
+            int line_columns = (iss >> value) ? 3 : 2;
+            if (columns == 0) columns = line_columns;
+            if (line_columns != columns) {
+                return fail(error, path + ":" + std::to_string(line_no) + ": inconsistent column count");
+            }
+
+            const std::string where = path + ":" + std::to_string(line_no) + ": ";
+            uint64_t input_raw = 0, output_raw = 0;
+            float v = 0.0f;
+            if (!parse_hex(hex_input, &input_raw)) return fail(error, where + "bad input '" + hex_input + "'");
+            if (!parse_hex(hex_output, &output_raw) || output_raw > 0xFFFF) {
+                return fail(error, where + "bad 16-bit result '" + hex_output + "'");
+            }
+            if (columns == 3 && !parse_value(value, &v)) return fail(error, where + "bad value '" + value + "'");
+            if (owned_results_.empty()) {
+                hdr_.first_input = input_raw;
+            } else if (input_raw != hdr_.first_input + owned_results_.size()) {
+                return fail(error, where + "inputs are not dense and increasing");
+            }
+            owned_results_.push_back(static_cast<uint16_t>(output_raw));
+            if (columns == 3) owned_values_.push_back(v);
+        }
+
+        std::memcpy(hdr_.magic, golden_io::MAGIC, sizeof(hdr_.magic));
+        hdr_.version = golden_io::VERSION;
+        hdr_.format = static_cast<uint16_t>(columns == 3 ? GoldenFormat::UlpReport : GoldenFormat::ApproxOutput);
+        hdr_.function = static_cast<uint16_t>(GoldenFunction::Unknown);
+        hdr_.base = static_cast<uint16_t>(GoldenBase::None);
+        hdr_.fp_type = static_cast<uint32_t>(FPType::BF16);
+        hdr_.flags = (columns == 3) ? golden_io::FLAG_HAS_VALUES : 0;
+        hdr_.count = owned_results_.size();
+        results_ = owned_results_.data();
+        values_ = owned_values_.empty() ? nullptr : owned_values_.data();
+        return true;
+    }
+
+    /** @brief Releases the mapping or owned buffers. */
+    void close() {
+        if (map_) munmap(map_, map_size_);
+        map_ = nullptr;
+        map_size_ = 0;
+        hdr_ = GoldenHeader();
+        results_ = nullptr;
+        values_ = nullptr;
+        owned_results_.clear();
+        owned_values_.clear();
+    }
+
+    const GoldenHeader& header() const { return hdr_; }
+    GoldenFormat format() const { return static_cast<GoldenFormat>(hdr_.format); }
+    GoldenFunction function() const { return static_cast<GoldenFunction>(hdr_.function); }
+    GoldenBase base() const { return static_cast<GoldenBase>(hdr_.base); }
+    uint64_t first_input() const { return hdr_.first_input; }
+    uint64_t count() const { return hdr_.count; }
+    uint64_t config_hash() const { return hdr_.config_hash; }
+    bool has_values() const { return (hdr_.flags & golden_io::FLAG_HAS_VALUES) != 0; }
+    bool is_mapped() const { return map_ != nullptr; }
+
+    /** @brief Dense result array, results()[i] is the result for first_input() + i. */
+    const uint16_t* results() const { return results_; }
+
+    /** @brief Dense value array (nullptr if the file has none). */
+    const float* values() const { return values_; }
+
+    bool contains(uint64_t input) const { return input - hdr_.first_input < hdr_.count; }
+    uint16_t result(uint64_t input) const { return results_[input - hdr_.first_input]; }
+    float value(uint64_t input) const { return values_[input - hdr_.first_input]; }
+
+    /** @brief Metadata of this table, e.g. to write it back in the other format. */
+    GoldenInfo info() const {
+        GoldenInfo info;
+        info.format = format();
+        info.function = function();
+        info.base = base();
+        info.fp_type = static_cast<FPType>(hdr_.fp_type);
+        info.first_input = hdr_.first_input;
+        info.config_hash = hdr_.config_hash;
+        return info;
+    }
+
+private:
+    static bool fail(std::string* error, const std::string& msg) {
+        if (error) *error = msg;
+        return false;
+    }
+
+    /** @brief Parses a whole token as hex ("0x" prefix optional); false on junk or overflow. */
+    static bool parse_hex(const std::string& s, uint64_t* out) {
+        if (s.empty() || s[0] == '-' || s[0] == '+') return false;
+        char* end = nullptr;
+        errno = 0;
+        const unsigned long long v = std::strtoull(s.c_str(), &end, 16);
+        if (errno == ERANGE || end == s.c_str() || *end != '\0') return false;
+        *out = v;
+        return true;
+    }
+
+    /** @brief Parses a whole token as a float, "NaN" or "Inf"; false on junk or overflow. */
+    static bool parse_value(const std::string& s, float* out) {
+        if (s == "NaN") { *out = std::numeric_limits<float>::quiet_NaN(); return true; }
+        if (s == "Inf") { *out = std::numeric_limits<float>::infinity(); return true; }
+        char* end = nullptr;
+        errno = 0;
+        const float v = std::strtof(s.c_str(), &end);
+        if (errno == ERANGE || end == s.c_str() || *end != '\0') return false;
+        *out = v;
+        return true;
+    }
+
+    std::string validate() const {
+        if (std::memcmp(hdr_.magic, golden_io::MAGIC, sizeof(hdr_.magic)) != 0) return "bad magic";
+        if (hdr_.version != golden_io::VERSION) return "unsupported version " + std::to_string(hdr_.version);
+        if (hdr_.format < static_cast<uint16_t>(GoldenFormat::ApproxOutput) ||
+            hdr_.format > static_cast<uint16_t>(GoldenFormat::Reference)) return "unknown format";
+        if (hdr_.count > map_size_) return "entry count exceeds file size";
+        // count <= map_size_ keeps count * size from overflowing; offset <= map_size_ keeps the
+        // remaining size from wrapping (offset + size could wrap for an offset near 2^64)
+        if (hdr_.results_offset % alignof(uint16_t) != 0 ||
+            hdr_.results_offset < sizeof(GoldenHeader) || hdr_.results_offset > map_size_ ||
+            hdr_.count * sizeof(uint16_t) > map_size_ - hdr_.results_offset) return "results out of bounds";
+        if (has_values() &&
+            (hdr_.values_offset % alignof(float) != 0 ||
+             hdr_.values_offset < sizeof(GoldenHeader) || hdr_.values_offset > map_size_ ||
+             hdr_.count * sizeof(float) > map_size_ - hdr_.values_offset)) return "values out of bounds";
+        return "";
+    }
+
+    void* map_ = nullptr;
+    size_t map_size_ = 0;
+    GoldenHeader hdr_ = {};
+    const uint16_t* results_ = nullptr;
+    const float* values_ = nullptr;
+    std::vector<uint16_t> owned_results_;
+    std::vector<float> owned_values_;
+};
+
+/**
+ * @brief Writes a golden table in the text format used by modeling/golden_ref.
+ * * "HEX_IN HEX_OUT" per line, plus the value with 4 decimals ("NaN" / "Inf") when the
+ * table has values. uppercase selects the hex digit case (the CUDA reference uses lowercase).
+ */
+inline bool golden_write_text(const std::string& path, const GoldenFile& table, bool uppercase = true,
+                              std::string* error = nullptr) {
+    std::ofstream outfile(path);
+    if (!outfile.is_open()) {
+        if (error) *error = "Could not open " + path + " for writing";
+        return false;
+    }
+
+    outfile << std::hex << (uppercase ? std::uppercase : std::nouppercase) << std::setfill('0');
+    for (uint64_t i = 0; i < table.count(); ++i) {
+        outfile << std::setw(4) << (table.first_input() + i) << " " << std::setw(4) << table.results()[i];
+        if (table.has_values()) {
+            float v = table.values()[i];
+            outfile << " ";
+            if (std::isnan(v)) {
+                outfile << "NaN";
+            } else if (std::isinf(v)) {
+                outfile << "Inf";
+            } else {
+                outfile << std::dec << std::fixed << std::setprecision(4) << v << std::hex;
+            }
+        }
+        outfile << "\n";
+    }
+
+    if (!outfile) {
+        if (error) *error = "Write to " + path + " failed";
+        return false;
+    }
+    return true;
+}
+
+#endif // GOLDEN_IO_HPP
@@ -0,0 +1,430 @@
+#ifndef ULP_ANALYSIS_HPP
+#define ULP_ANALYSIS_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+#include <charconv>  // std::to_chars
+#include "fp_utils.hpp"
+#include "fp_sweep.hpp"
+#include "fp_convert.hpp"
+#include "fp_reference.hpp"
+#include "golden_io.hpp"
+
+// =========================================================
+// ULP Histograms
+// =========================================================
+
+/**
+ * @brief Fixed-bucket ULP error histogram with count, max and sum.
+ * * Buckets: exactly 0, (0, 0.5], (0.5, 1], (1, 2], (2, 4], (4, 8], (8, 16], (16, 256],
+ * > 256, and a last bucket for non-finite errors (NaN / Inf). Max and sum only cover
+ * finite errors; max_ulp starts at 0.
+ */
+struct UlpHistogram {
+    static constexpr int NUM_BINS = 10;
+    static constexpr int NONFINITE_BIN = NUM_BINS - 1;
+
+    uint64_t bins[NUM_BINS] = {};
+    uint64_t count = 0;          // All samples
+    uint64_t finite = 0;         // Samples with a finite error
+    double max_ulp = 0.0;
+    double sum_ulp = 0.0;
+
+    /** @brief Upper edge of bucket b (inclusive); bucket 0 is exactly 0. */
+    static double upper_edge(int b) {
+        static const double edges[NUM_BINS - 2] = {0.0, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0, 256.0};
+        return edges[b];
+    }
+
+    /** @brief Short bucket label for reports ("0", "<=0.5", ..., ">256", "nonfinite"). */
+    static std::string label(int b) {
+        if (b == 0) return "0";
+        if (b == NONFINITE_BIN) return "nonfinite";
+        char buf[32];
+        if (b == NONFINITE_BIN - 1) {
+            std::snprintf(buf, sizeof(buf), ">%g", upper_edge(b - 1));
+        } else {
+            std::snprintf(buf, sizeof(buf), "<=%g", upper_edge(b));
+        }
+        return buf;
+    }
+
+    static int bin_of(double ulp) {
+        if (!std::isfinite(ulp)) return NONFINITE_BIN;
+        int b = 0;
+        while (b < NONFINITE_BIN - 1 && ulp > upper_edge(b)) b++;
+        return b;
+    }
+
+    void add(double ulp) {
+        bins[bin_of(ulp)]++;
+        count++;
+        if (std::isfinite(ulp)) {
+            finite++;
+            sum_ulp += ulp;
+            max_ulp = std::max(max_ulp, ulp);
+        }
+    }
+
+    void merge(const UlpHistogram& o) {
+        for (int b = 0; b < NUM_BINS; ++b) bins[b] += o.bins[b];
+        count += o.count;
+        finite += o.finite;
+        sum_ulp += o.sum_ulp;
+        max_ulp = std::max(max_ulp, o.max_ulp);
+    }
+
+    double mean_ulp() const { return finite ? sum_ulp / finite : 0.0; }
+};
+
+/**
+ * @brief Output classes used to split the report.
+ * * Saturated covers +-Inf and the largest finite magnitude (overflow clamped by the datapath).
+ */
+enum class UlpOutputClass : int { Normal = 0, Subnormal, Zero, Saturated, NaN, Count };
+
+inline const char* ulp_output_class_name(UlpOutputClass c) {
+    switch (c) {
+        case UlpOutputClass::Normal: return "normal";
+        case UlpOutputClass::Subnormal: return "subnormal";
+        case UlpOutputClass::Zero: return "zero";
+        case UlpOutputClass::Saturated: return "saturated";
+        case UlpOutputClass::NaN: return "nan";
+        default: return "unknown";
+    }
+}
+
+inline UlpOutputClass ulp_output_class(uint32_t raw, FPType type) {
+    const FPConfig cfg = get_fp_config(type);
+    const uint32_t magnitude = raw & ((1u << (cfg.exp_bits + cfg.mant_bits)) - 1u);
+    const uint32_t inf_bits = ((1u << cfg.exp_bits) - 1u) << cfg.mant_bits;
+    if (magnitude > inf_bits) return UlpOutputClass::NaN;
+    if (magnitude >= inf_bits - 1u) return UlpOutputClass::Saturated;
+    if (magnitude == 0) return UlpOutputClass::Zero;
+    if (magnitude < (1u << cfg.mant_bits)) return UlpOutputClass::Subnormal;
+    return UlpOutputClass::Normal;
+}
+
+// =========================================================
+// Analysis
+// =========================================================
+
+/**
+ * @brief One entry of the worst-inputs list.
+ */
+struct UlpWorstCase {
+    uint32_t input;
+    uint32_t output;
+    double ulp;
+};
+
+/**
+ * @brief Options for ulp_analyze.
+ */
+struct UlpAnalysisOptions {
+    unsigned num_threads = 0;    // 0 = std::thread::hardware_concurrency()
+    size_t top_k = 16;           // Length of the worst-inputs list
+    bool write_text = true;      // Build the "HEX_IN HEX_OUT ULP" text report
+};
+
+/**
+ * @brief Full result of ulp_analyze.
+ * * by_binade is indexed by sign * 2^exp_bits + raw input exponent field, so every
+ * input binade (including the denormal/zero binade 0 and the Inf/NaN binade) has its
+ * own histogram. worst is sorted by decreasing error, ties by increasing input;
+ * NaN errors are never listed and Inf errors rank above every finite error.
+ */
+struct UlpReport {
+    FPType type = FPType::BF16;
+    uint32_t first_input = 0;
+    UlpHistogram total;
+    std::vector<UlpHistogram> by_binade;
+    UlpHistogram by_class[static_cast<int>(UlpOutputClass::Count)];
+    std::vector<UlpWorstCase> worst;
+    uint32_t max_ulp_input = 0;   // First input reaching total.max_ulp
+    std::vector<float> ulp;       // Per-input error (for the binary ULP golden)
+    std::string text;             // Text report, one line per input
+};
+
+namespace ulp_analysis_detail {
+    /** @brief Strict weak order of the worst-inputs list (worst first, then by input). */
+    inline bool worse(const UlpWorstCase& a, const UlpWorstCase& b) {
+        if (a.ulp != b.ulp) return a.ulp > b.ulp;
+        return a.input < b.input;
+    }
+
+    inline void keep_top(std::vector<UlpWorstCase>& v, size_t k) {
+        std::sort(v.begin(), v.end(), worse);
+        if (v.size() > k) v.resize(k);
+    }
+
+    /**
+     * @brief Per-chunk statistics; fp_sweep merges them in chunk order, so text lines,
+     * sums and the first-max input come out in input order for any thread count.
+     */
+    struct Shard {
+        UlpHistogram total;
+        std::vector<UlpHistogram> by_binade;
+        UlpHistogram by_class[static_cast<int>(UlpOutputClass::Count)];
+        std::vector<UlpWorstCase> worst;
+        uint32_t max_ulp_input = 0;
+        std::string text;
+        size_t top_k = 0;
+
+        void merge(const Shard& o) {
+            if (o.total.max_ulp > total.max_ulp) max_ulp_input = o.max_ulp_input;
+            total.merge(o.total);
+            if (by_binade.size() < o.by_binade.size()) by_binade.resize(o.by_binade.size());
+            for (size_t i = 0; i < o.by_binade.size(); ++i) by_binade[i].merge(o.by_binade[i]);
+            for (int c = 0; c < static_cast<int>(UlpOutputClass::Count); ++c) by_class[c].merge(o.by_class[c]);
+            top_k = std::max(top_k, o.top_k);
+            worst.insert(worst.end(), o.worst.begin(), o.worst.end());
+            keep_top(worst, top_k);
+            text += o.text;
+        }
+    };
+
+    inline char* put_hex4(char* p, uint32_t v) {
+        static const char digits[] = "0123456789ABCDEF";
+        for (int shift = 12; shift >= 0; shift -= 4) *p++ = digits[(v >> shift) & 0xF];
+        return p;
+    }
+
+    /**
+     * @brief Formats one report line exactly like the original iostream version
+     * ("%04X %04X %.4f", NaN / Inf spelled out).
+     * * std::to_chars gives the same correctly rounded digits as printf at a fraction
+     * of the cost; formatting dominated the analysis time.
+     */
+    inline void append_line(std::string& text, uint32_t input, uint32_t output, double ulp) {
+        char buf[400];   // Fixed notation of the largest double needs 309 digits
+        char* p = put_hex4(buf, input);
+        *p++ = ' ';
+        p = put_hex4(p, output);
+        *p++ = ' ';
+        if (std::isnan(ulp)) {
+            p = std::copy_n("NaN", 3, p);
+        } else if (std::isinf(ulp)) {
+            p = std::copy_n("Inf", 3, p);
+        } else {
+            p = std::to_chars(p, buf + sizeof(buf) - 1, ulp, std::chars_format::fixed, 4).ptr;
+        }
+        *p++ = '\n';
+        text.append(buf, static_cast<size_t>(p - buf));
+    }
+
+    /**
+     * @brief Sweeps the range with fp_sweep: every chunk fills its own histograms, worst
+     * list and text, and the chunk-order reduction makes the report identical for any
+     * thread count. ref_at(i) returns the ideal result for outputs[i].
+     */
+    template<typename RefAt>
+    UlpReport analyze(const uint16_t* outputs, uint64_t count, uint32_t first_input, RefAt ref_at, FPType type,
+                      const UlpAnalysisOptions& opts) {
+        const FPConfig cfg = get_fp_config(type);
+        const size_t num_binades = size_t(2) << cfg.exp_bits;
+
+        UlpReport report;
+        report.type = type;
+        report.first_input = first_input;
+        report.ulp.resize(count);
+
+        SweepOptions sweep_opts;
+        sweep_opts.num_threads = opts.num_threads;
+
+        auto sweep = fp_sweep<Shard>(0, count, [&](uint64_t i, SweepShard<Shard>& shard) {
+            Shard& s = shard.stats;
+            if (s.by_binade.empty()) {
+                s.by_binade.resize(num_binades);
+                s.top_k = opts.top_k;
+            }
+
+            const uint32_t input = static_cast<uint32_t>((first_input + i) & ((uint64_t(1) << cfg.total_bits) - 1));
+            const uint32_t output = outputs[i];
+            const double ulp = calculate_ulp_error_raw(ref_at(i), output, type);
+            report.ulp[i] = static_cast<float>(ulp);
+
+            if (std::isfinite(ulp) && ulp > s.total.max_ulp) s.max_ulp_input = input;
+            s.total.add(ulp);
+            s.by_binade[input >> cfg.mant_bits].add(ulp);
+            s.by_class[static_cast<int>(ulp_output_class(output, type))].add(ulp);
+
+            if (!std::isnan(ulp) && opts.top_k) {
+                // Trim lazily: sort only when the candidate list doubles
+                s.worst.push_back({input, output, ulp});
+                if (s.worst.size() >= 2 * opts.top_k) keep_top(s.worst, opts.top_k);
+            }
+
+            if (opts.write_text) append_line(s.text, input, output, ulp);
+        }, sweep_opts);
+
+        Shard& merged = sweep.stats;
+        keep_top(merged.worst, opts.top_k);
+        merged.by_binade.resize(num_binades);
+
+        report.total = merged.total;
+        report.by_binade = std::move(merged.by_binade);
+        for (int c = 0; c < static_cast<int>(UlpOutputClass::Count); ++c) report.by_class[c] = merged.by_class[c];
+        report.worst = std::move(merged.worst);
+        report.max_ulp_input = merged.max_ulp_input;
+        report.text = std::move(merged.text);
+        return report;
+    }
+}
+
+/**
+ * @brief Measures the ULP error of count outputs for the inputs first_input, first_input + 1, ...
+ * against a reference function evaluated in double.
+ * * Inputs are widened with fp_to_double_batch; errors come from calculate_ulp_error_raw
+ * (integer path when the reference is representable).
+ *
+ * @param outputs     Raw outputs (e.g. GoldenFile::results()).
+ * @param count       Number of outputs.
+ * @param first_input Raw input of outputs[0].
+ * @param reference   Callable double(double x) returning the ideal result.
+ * @param type        Format of inputs and outputs.
+ */
+template<typename RefFn>
+UlpReport ulp_analyze(const uint16_t* outputs, uint64_t count, uint32_t first_input, RefFn reference,
+                      FPType type = FPType::BF16, const UlpAnalysisOptions& opts = UlpAnalysisOptions()) {
+    std::vector<uint16_t> inputs(count);
+    for (uint64_t i = 0; i < count; ++i) inputs[i] = static_cast<uint16_t>(first_input + i);
+    std::vector<double> x_values(count);
+    fp_to_double_batch(inputs.data(), x_values.data(), count, type);
+
+    return ulp_analysis_detail::analyze(outputs, count, first_input,
+                                        [&](uint64_t i) { return reference(x_values[i]); }, type, opts);
+}
+
+/**
+ * @brief Same as ulp_analyze, with the ideal results looked up in a golden REFERENCE
+ * table (see gen_bf16_reference) instead of being recomputed.
+ * @return false (with a message in *error) if the table is not a reference table or
+ * does not cover [first_input, first_input + count).
+ */
+inline bool ulp_analyze_reference(const uint16_t* outputs, uint64_t count, uint32_t first_input,
+                                  const GoldenFile& reference, UlpReport& report, FPType type = FPType::BF16,
+                                  const UlpAnalysisOptions& opts = UlpAnalysisOptions(), std::string* error = nullptr) {
+    if (reference.format() != GoldenFormat::Reference || !reference.has_values()) {
+        if (error) *error = "not a reference table (format 3 with residual values)";
+        return false;
+    }
+    if (count && (!reference.contains(first_input) || !reference.contains(first_input + count - 1))) {
+        if (error) *error = "reference table does not cover the analyzed inputs";
+        return false;
+    }
+
+    const uint16_t* results = reference.results() + (first_input - reference.first_input());
+    const float* residuals = reference.values() + (first_input - reference.first_input());
+    report = ulp_analysis_detail::analyze(outputs, count, first_input, [&](uint64_t i) {
+        return fp_reference_value(results[i], residuals[i], type);
+    }, type, opts);
+    return true;
+}
+
+// =========================================================
+// JSON Output
+// =========================================================
+
+namespace ulp_analysis_detail {
+    inline const char* format_name(FPType type) {
+        switch (type) {
+            case FPType::BF16: return "bf16";
+            default: return "unknown";
+        }
+    }
+
+    inline std::string json_number(double v) {
+        if (std::isnan(v)) return "null";
+        if (std::isinf(v)) return v > 0 ? "\"inf\"" : "\"-inf\"";
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%.6g", v);
+        return buf;
+    }
+
+    inline std::string json_hex(uint32_t v) {
+        char buf[16];
+        std::snprintf(buf, sizeof(buf), "\"0x%04X\"", v);
+        return buf;
+    }
+
+    inline void json_histogram(std::ofstream& out, const UlpHistogram& h) {
+        out << "\"count\": " << h.count << ", \"finite\": " << h.finite
+            << ", \"max_ulp\": " << json_number(h.max_ulp)
+            << ", \"mean_ulp\": " << json_number(h.mean_ulp()) << ", \"histogram\": [";
+        for (int b = 0; b < UlpHistogram::NUM_BINS; ++b) out << (b ? ", " : "") << h.bins[b];
+        out << "]";
+    }
+}
+
+/**
+ * @brief Writes a report as JSON: summary, bucket labels, per-binade and per-class
+ * histograms (empty ones omitted) and the worst inputs.
+ * @param function Function name recorded in the file (e.g. "exp2").
+ * @return false if the file cannot be written.
+ */
+inline bool ulp_write_json(const std::string& path, const UlpReport& report, const std::string& function) {
+    using namespace ulp_analysis_detail;
+    std::ofstream out(path);
+    if (!out.is_open()) return false;
+
+    const FPConfig cfg = get_fp_config(report.type);
+    const uint32_t exp_count = 1u << cfg.exp_bits;
+
+    out << "{\n  \"function\": \"" << function << "\",\n  \"format\": \"" << format_name(report.type) << "\",\n";
+    out << "  \"first_input\": " << json_hex(report.first_input) << ",\n";
+    out << "  \"max_ulp_input\": " << json_hex(report.max_ulp_input) << ",\n  \"total\": {";
+    json_histogram(out, report.total);
+    out << "},\n  \"bins\": [";
+    for (int b = 0; b < UlpHistogram::NUM_BINS; ++b) out << (b ? ", " : "") << "\"" << UlpHistogram::label(b) << "\"";
+    out << "],\n";
+
+    // Binades: raw exponent field plus its unbiased exponent (denormal binade: 1 - bias, Inf/NaN: "special")
+    out << "  \"by_binade\": [";
+    bool first = true;
+    for (uint32_t i = 0; i < report.by_binade.size(); ++i) {
+        const UlpHistogram& h = report.by_binade[i];
+        if (!h.count) continue;
+        uint32_t raw_exp = i % exp_count;
+        out << (first ? "\n" : ",\n") << "    {\"sign\": " << (i / exp_count) << ", \"exponent_field\": " << raw_exp
+            << ", \"exponent\": ";
+        if (raw_exp == exp_count - 1) {
+            out << "\"special\"";
+        } else {
+            out << (raw_exp ? static_cast<int>(raw_exp) - cfg.bias : 1 - cfg.bias);
+        }
+        out << ", ";
+        json_histogram(out, h);
+        out << "}";
+        first = false;
+    }
+    out << "\n  ],\n";
+
+    out << "  \"by_output_class\": [";
+    first = true;
+    for (int c = 0; c < static_cast<int>(UlpOutputClass::Count); ++c) {
+        if (!report.by_class[c].count) continue;
+        out << (first ? "\n" : ",\n") << "    {\"class\": \"" << ulp_output_class_name(static_cast<UlpOutputClass>(c))
+            << "\", ";
+        json_histogram(out, report.by_class[c]);
+        out << "}";
+        first = false;
+    }
+    out << "\n  ],\n";
+
+    out << "  \"worst\": [";
+    for (size_t i = 0; i < report.worst.size(); ++i) {
+        const UlpWorstCase& w = report.worst[i];
+        out << (i ? ",\n" : "\n") << "    {\"input\": " << json_hex(w.input) << ", \"output\": " << json_hex(w.output)
+            << ", \"ulp\": " << json_number(w.ulp) << "}";
+    }
+    out << "\n  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+#endif // ULP_ANALYSIS_HPP
@@ -0,0 +1,170 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include "../src/approximations/bf16_exp2.hpp"
+#include "../src/approximations/bf16_exp2_core_native.hpp"
+
+/**
+ * @brief Benchmark: runtime-base datapath vs compile-time Base specialization.
+ * * The runtime side is a frozen copy of the core as it was before the base became a
+ * template parameter: mant_src * log2(e) is always computed and a mux on base2 picks
+ * mant_src or the product. Polynomial and rounding are the shared stages, so each row
+ * measures only the removed multiplier and mux. The flag is read from a volatile so the
+ * compiler cannot constant-fold it into the call site, which is what happens in real
+ * callers that take the base as data.
+ */
+
+typedef bf16_exp_high_accuracy Cfg;
+
+static volatile bool g_base2_flag = true;
+static volatile uint32_t g_sink = 0;
+
+/** @brief Pre-specialization range reduction (ac_fixed): multiply always, then select. */
+inline int32_t runtime_base_reduce(const FPRaw& input_parts, bool base2, mant_of_t<Cfg>& mant_val) {
+    typedef ac_fixed<Cfg::IN_CONV_INT_W + Cfg::IN_F, Cfg::IN_CONV_INT_W, false> unified_t;
+
+    ac_fixed<Cfg::MANT_SRC_W, Cfg::MANT_SRC_I, false> mant_src;
+    mant_src[Cfg::MANT_SRC_W - 1] = 1;
+    mant_src.set_slc(0, (ac_int<Cfg::TARGET_MANT_W, false>)input_parts.mantissa);
+
+    ac_fixed<Cfg::LOG2E_W, Cfg::LOG2E_I, false> log2e_const;
+    log2e_const.set_slc(0, ac_int<Cfg::LOG2E_W, false>(Cfg::LOG2E_BITS));
+    ac_fixed<Cfg::MANT_MULT_W, Cfg::MANT_MULT_I, false> mant_mult = mant_src * log2e_const;
+
+    unified_t val = base2 ? (unified_t)mant_src : (unified_t)mant_mult;
+    if (input_parts.exponent >= 0) {
+        val <<= input_parts.exponent;
+    } else {
+        val >>= (-input_parts.exponent);
+    }
+
+    mant_val = 0;
+    mant_val.set_slc(0, val.slc<Cfg::IN_F>(0));
+    return -(int)val.to_int();
+}
+
+inline FPRaw runtime_base_core(const FPRaw& input_parts, bool base2) {
+    mant_of_t<Cfg> mant_val = 0;
+    int32_t exponent_bias = runtime_base_reduce(input_parts, base2, mant_val);
+    PolyResultT<Cfg> poly_res = bf16_exp2_poly<Cfg>(mant_val);
+    return bf16_exp_round<Cfg>(poly_res.mantissa.slc<Cfg::POLY_OUT_W>(0), poly_res.exponent + exponent_bias);
+}
+
+/** @brief Pre-specialization range reduction (native): multiply always, then select. */
+inline int32_t runtime_base_reduce_native(const FPRaw& input_parts, bool base2, uint64_t& mant_val) {
+    using bf16_native::ones;
+    const int unified_w = bf16_native::unified_w<Cfg>();
+
+    uint64_t mant_src = (uint64_t(1) << Cfg::MANT_SRC_F) | (input_parts.mantissa & ones<uint64_t>(Cfg::TARGET_MANT_W));
+    uint64_t mant_mult = mant_src * Cfg::LOG2E_BITS;
+
+    uint64_t val = base2 ? mant_src << (Cfg::IN_F - Cfg::MANT_SRC_F) : mant_mult << (Cfg::IN_F - Cfg::MANT_MULT_F);
+    if (input_parts.exponent >= 0) {
+        val = (input_parts.exponent < unified_w) ? ((val << input_parts.exponent) & ones<uint64_t>(unified_w)) : 0;
+    } else {
+        val = (-input_parts.exponent < unified_w) ? (val >> (-input_parts.exponent)) : 0;
+    }
+
+    mant_val = val & ones<uint64_t>(Cfg::IN_F);
+    return -static_cast<int32_t>(val >> Cfg::IN_F);
+}
+
+inline FPRaw runtime_base_core_native(const FPRaw& input_parts, bool base2) {
+    uint64_t mant_val;
+    int32_t exponent_bias = runtime_base_reduce_native(input_parts, base2, mant_val);
+    PolyResultNativeT<Cfg> poly_res = bf16_exp2_poly_native<Cfg>(mant_val);
+    return bf16_exp_round_native<Cfg>(poly_res.mantissa, poly_res.exponent + exponent_bias);
+}
+
+// Negative BF16 inputs that reach the core (exponent in [INPUT_MIN_EXP, INPUT_MAX_EXP])
+std::vector<FPRaw> core_inputs() {
+    std::vector<FPRaw> inputs;
+    for (uint32_t i = 0x8000; i <= 0xFFFF; ++i) {
+        FPRaw parts = fp_decompose(i, FPType::BF16);
+        if (parts.status.is_nan || parts.status.is_inf || parts.status.is_zero || parts.status.is_denormal) continue;
+        if (parts.exponent < bf16_cfg::INPUT_MIN_EXP || parts.exponent > bf16_cfg::INPUT_MAX_EXP) continue;
+        inputs.push_back(parts);
+    }
+    return inputs;
+}
+
+// Best of several trials (after one warm-up pass) to suppress scheduling noise
+template<typename Fn>
+double time_ns_per_op(const std::vector<FPRaw>& inputs, int reps, Fn fn) {
+    const int TRIALS = 7;
+    uint32_t acc = 0;
+    for (const auto& in : inputs) acc += fn(in);
+
+    double best = 0.0;
+    for (int t = 0; t < TRIALS; ++t) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r) {
+            for (const auto& in : inputs) {
+                acc += fn(in);
+            }
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / (double(reps) * inputs.size());
+        if (t == 0 || ns < best) best = ns;
+    }
+    g_sink = acc;
+    return best;
+}
+
+void report(const char* name, double runtime_ns, double template_ns) {
+    std::cout << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << runtime_ns << std::setw(12) << template_ns
+              << std::setw(10) << (100.0 * (runtime_ns - template_ns) / runtime_ns) << "%\n";
+}
+
+template<Base B>
+void bench_base(const std::vector<FPRaw>& inputs, const char* label) {
+    const int REPS_HLS = 10;
+    const int REPS_NATIVE = 100;
+    const bool base2 = (B == Base::Two);
+    g_base2_flag = base2;
+
+    // The frozen copy must compute the same function, or the timing compares different work
+    size_t differ = 0;
+    for (const auto& in : inputs) {
+        differ += fp_recompose(runtime_base_core(in, base2), FPType::BF16) !=
+                  fp_recompose(bf16_exp_core_approx<B, Cfg>(in), FPType::BF16);
+        differ += fp_recompose(runtime_base_core_native(in, base2), FPType::BF16) !=
+                  fp_recompose(bf16_exp_core_approx_native<B, Cfg>(in), FPType::BF16);
+    }
+
+    std::cout << "\n=== Base: " << label << " ===\n";
+    if (differ) std::cout << "WARNING: runtime-base copy differs from the template on " << differ << " outputs\n";
+    std::cout << std::left << std::setw(26) << "Path" << std::right << std::setw(12) << "bool ns/op"
+              << std::setw(12) << "tmpl ns/op" << std::setw(11) << "gain\n";
+
+    double rt = time_ns_per_op(inputs, REPS_HLS, [](const FPRaw& in) {
+        return fp_recompose(runtime_base_core(in, g_base2_flag), FPType::BF16);
+    });
+    double ct = time_ns_per_op(inputs, REPS_HLS, [](const FPRaw& in) {
+        return fp_recompose(bf16_exp_core_approx<B, Cfg>(in), FPType::BF16);
+    });
+    report("HLS core (ac_fixed)", rt, ct);
+
+    rt = time_ns_per_op(inputs, REPS_NATIVE, [](const FPRaw& in) {
+        return fp_recompose(runtime_base_core_native(in, g_base2_flag), FPType::BF16);
+    });
+    ct = time_ns_per_op(inputs, REPS_NATIVE, [](const FPRaw& in) {
+        return fp_recompose(bf16_exp_core_approx_native<B, Cfg>(in), FPType::BF16);
+    });
+    report("Native core", rt, ct);
+}
+
+int main() {
+    std::cout << "--- BF16 exp Core: Runtime Base vs Compile-Time Base Benchmark ---\n";
+
+    std::vector<FPRaw> inputs = core_inputs();
+    std::cout << "Core inputs per pass: " << inputs.size() << "\n";
+
+    bench_base<Base::Two>(inputs, "2 (exp2)");
+    bench_base<Base::E>(inputs, "e (expe)");
+
+    return 0;
+}
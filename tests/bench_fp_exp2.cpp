@@ -0,0 +1,266 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include "../src/approximations/bf16_exp2.hpp"
+#include "../src/utils/bench_harness.hpp"
+
+/**
+ * @brief Microbenchmark suite for fp_utils and the exp2 model.
+ * * Every function runs on three input distributions:
+ *   - seq:       patterns in increasing order (branch predictor friendly),
+ *   - random:    the same patterns shuffled with a fixed seed,
+ *   - realistic: softmax-style arguments (x - max(x) of normally distributed logits)
+ *                for the exp functions, unit-normal activations for fp_utils.
+ *
+ * Usage: bench_fp_exp2 [--json out.json] [--baseline base.json] [--threshold 0.10] [--quick]
+ * Returns 1 if any case is slower than the baseline by more than the threshold.
+ */
+
+const uint32_t RNG_SEED = 12345;
+
+// Rounds a double to BF16 (RNE through float, NaN handling not needed for these inputs)
+uint32_t to_bf16(double v) {
+    float f = static_cast<float>(v);
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    bits += 0x7FFF + ((bits >> 16) & 1);
+    return bits >> 16;
+}
+
+bool is_core_input(const FPRaw& p) {
+    return !p.status.is_nan && !p.status.is_inf && !p.status.is_zero && !p.status.is_denormal &&
+           p.exponent >= bf16_cfg::INPUT_MIN_EXP && p.exponent <= bf16_cfg::INPUT_MAX_EXP;
+}
+
+template<typename T>
+std::vector<T> shuffled(std::vector<T> v) {
+    std::mt19937 rng(RNG_SEED);
+    std::shuffle(v.begin(), v.end(), rng);
+    return v;
+}
+
+// Softmax arguments: rows of 64 N(0, 3) logits, shifted by the row maximum (all <= 0)
+std::vector<uint32_t> softmax_inputs(size_t n) {
+    std::mt19937 rng(RNG_SEED);
+    std::normal_distribution<double> logit(0.0, 3.0);
+    std::vector<uint32_t> out;
+    out.reserve(n);
+    while (out.size() < n) {
+        double row[64];
+        double max_v = -1e30;
+        for (double& v : row) {
+            v = logit(rng);
+            max_v = std::max(max_v, v);
+        }
+        for (double v : row) {
+            if (out.size() < n) out.push_back(to_bf16(v - max_v));
+        }
+    }
+    return out;
+}
+
+// Unit-normal activations
+std::vector<uint32_t> activation_inputs(size_t n) {
+    std::mt19937 rng(RNG_SEED);
+    std::normal_distribution<double> act(0.0, 1.0);
+    std::vector<uint32_t> out(n);
+    for (auto& v : out) v = to_bf16(act(rng));
+    return out;
+}
+
+struct UlpPair {
+    double ref;
+    double val;
+};
+
+std::vector<UlpPair> ulp_pairs(const std::vector<uint32_t>& inputs) {
+    std::vector<UlpPair> out;
+    out.reserve(inputs.size());
+    for (uint32_t in : inputs) {
+        double x = fp_to_double(in, FPType::BF16);
+        out.push_back({std::exp2(x), fp_to_double(bf16_exp2_approx(static_cast<uint16_t>(in), true), FPType::BF16)});
+    }
+    return out;
+}
+
+// Same pairs with the reference rounded to BF16 (a correctly rounded golden reference)
+struct RawUlpPair {
+    uint32_t ref;
+    uint32_t val;
+};
+
+std::vector<RawUlpPair> raw_ulp_pairs(const std::vector<uint32_t>& inputs) {
+    std::vector<RawUlpPair> out;
+    out.reserve(inputs.size());
+    for (uint32_t in : inputs) {
+        double x = fp_to_double(in, FPType::BF16);
+        out.push_back({to_bf16(std::exp2(x)), bf16_exp2_approx(static_cast<uint16_t>(in), true)});
+    }
+    return out;
+}
+
+// Fractional parts that bf16_exp2_poly sees for the given core inputs (base 2 range reduction)
+std::vector<mant_t> poly_inputs(const std::vector<FPRaw>& core) {
+    std::vector<mant_t> out;
+    out.reserve(core.size());
+    for (const FPRaw& p : core) {
+        uint64_t val = ((uint64_t(1) << bf16_cfg::MANT_SRC_F) | p.mantissa) << (bf16_cfg::IN_F - bf16_cfg::MANT_SRC_F);
+        val = (p.exponent >= 0) ? (val << p.exponent) : (val >> -p.exponent);
+        mant_t m = 0;
+        m.set_slc(0, ac_int<bf16_cfg::IN_F, false>(val & ((uint64_t(1) << bf16_cfg::IN_F) - 1)));
+        out.push_back(m);
+    }
+    return out;
+}
+
+int main(int argc, char** argv) {
+    std::string json_path;
+    std::string baseline_path;
+    double threshold = 0.10;
+    BenchOptions opts;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (arg == "--baseline" && i + 1 < argc) {
+            baseline_path = argv[++i];
+        } else if (arg == "--threshold" && i + 1 < argc) {
+            threshold = std::stod(argv[++i]);
+        } else if (arg == "--quick") {
+            opts.trials = 2;
+            opts.min_trial_ms = 5.0;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--json out.json] [--baseline base.json] [--threshold 0.10] [--quick]\n";
+            return 1;
+        }
+    }
+
+    std::cout << "--- fp_utils / BF16 exp2 Microbenchmarks ---\n\n";
+
+    // --- Input sets ---
+    const size_t REALISTIC_N = 1 << 16;
+
+    std::vector<uint32_t> all_seq(0x10000);
+    for (uint32_t i = 0; i < all_seq.size(); ++i) all_seq[i] = i;
+    std::vector<uint32_t> neg_seq(all_seq.begin() + 0x8000, all_seq.end());
+
+    std::vector<uint32_t> activations = activation_inputs(REALISTIC_N);
+    std::vector<uint32_t> softmax = softmax_inputs(REALISTIC_N);
+
+    auto decompose_all = [](const std::vector<uint32_t>& bits) {
+        std::vector<FPRaw> out;
+        out.reserve(bits.size());
+        for (uint32_t b : bits) out.push_back(fp_decompose(b, FPType::BF16));
+        return out;
+    };
+    auto core_only = [](const std::vector<FPRaw>& parts) {
+        std::vector<FPRaw> out;
+        for (const FPRaw& p : parts) {
+            if (is_core_input(p)) out.push_back(p);
+        }
+        return out;
+    };
+
+    struct Dist {
+        const char* name;
+        std::vector<uint32_t> fp_bits;    // fp_utils inputs (all patterns)
+        std::vector<uint32_t> exp_bits;   // bf16_exp2_approx inputs
+    };
+    std::vector<Dist> dists = {
+        {"seq", all_seq, neg_seq},
+        {"random", shuffled(all_seq), shuffled(neg_seq)},
+        {"realistic", activations, softmax},
+    };
+
+    // --- Run ---
+    std::vector<BenchResult> results;
+    bench_print_header();
+    auto record = [&results](const BenchResult& r) {
+        bench_print(r);
+        results.push_back(r);
+    };
+
+    for (const Dist& d : dists) {
+        std::vector<FPRaw> fp_parts = decompose_all(d.fp_bits);
+        std::vector<FPRaw> core = core_only(decompose_all(d.exp_bits));
+        std::vector<uint16_t> exp_raw(d.exp_bits.begin(), d.exp_bits.end());
+        std::vector<UlpPair> pairs = ulp_pairs(d.exp_bits);
+        std::vector<RawUlpPair> raw_pairs = raw_ulp_pairs(d.exp_bits);
+        std::vector<mant_t> poly = poly_inputs(core);
+
+        record(bench_run("fp_classify", d.name, d.fp_bits, [](uint32_t b) {
+            FPStatus s = fp_classify(b, FPType::BF16);
+            return s.is_nan + 2 * s.is_inf + 4 * s.is_zero + 8 * s.is_denormal;
+        }, opts));
+        record(bench_run("fp_decompose", d.name, d.fp_bits, [](uint32_t b) {
+            FPRaw p = fp_decompose(b, FPType::BF16);
+            return p.mantissa + p.exponent + p.sign;
+        }, opts));
+        record(bench_run("fp_recompose", d.name, fp_parts, [](const FPRaw& p) {
+            return fp_recompose(p, FPType::BF16);
+        }, opts));
+        record(bench_run("fp_to_double", d.name, d.fp_bits, [](uint32_t b) {
+            return fp_to_double(b, FPType::BF16);
+        }, opts));
+        record(bench_run("calculate_ulp_error", d.name, pairs, [](const UlpPair& p) {
+            return calculate_ulp_error(p.ref, p.val, FPType::BF16);
+        }, opts));
+        record(bench_run("calc_ulp_error (bf16 ref)", d.name, raw_pairs, [](const RawUlpPair& p) {
+            return calculate_ulp_error(fp_to_double(p.ref, FPType::BF16), fp_to_double(p.val, FPType::BF16), FPType::BF16);
+        }, opts));
+        record(bench_run("ulp_error_bits", d.name, raw_pairs, [](const RawUlpPair& p) {
+            return ulp_error_bits<FPType::BF16>(p.ref, p.val);
+        }, opts));
+        record(bench_run("ulp_distance_bits", d.name, raw_pairs, [](const RawUlpPair& p) {
+            return ulp_distance_bits<FPType::BF16>(p.ref, p.val);
+        }, opts));
+        record(bench_run("bf16_exp2_poly", d.name, poly, [](const mant_t& m) {
+            PolyResult r = bf16_exp2_poly(m);
+            return r.mantissa.slc<32>(bf16_cfg::POLY_OUT_W - 32).to_uint64() + r.exponent;
+        }, opts));
+        record(bench_run("bf16_exp2_core_approx (2)", d.name, core, [](const FPRaw& p) {
+            return fp_recompose(bf16_exp_core_approx<Base::Two>(p), FPType::BF16);
+        }, opts));
+        record(bench_run("bf16_exp2_core_approx (e)", d.name, core, [](const FPRaw& p) {
+            return fp_recompose(bf16_exp_core_approx<Base::E>(p), FPType::BF16);
+        }, opts));
+        record(bench_run("bf16_exp2_approx (2)", d.name, exp_raw, [](uint16_t x) {
+            return bf16_exp_approx<Base::Two>(x);
+        }, opts));
+        record(bench_run("bf16_exp2_approx (e)", d.name, exp_raw, [](uint16_t x) {
+            return bf16_exp_approx<Base::E>(x);
+        }, opts));
+    }
+
+    // --- Save / compare ---
+    if (!json_path.empty()) {
+        if (!bench_write_json(json_path, results)) {
+            std::cerr << "Error: Could not write " << json_path << "\n";
+            return 1;
+        }
+        std::cout << "\nResults written to: " << json_path << "\n";
+    }
+
+    if (!baseline_path.empty()) {
+        std::vector<BenchResult> baseline;
+        if (!bench_read_json(baseline_path, baseline)) {
+            std::cout << "\nNo baseline at " << baseline_path << ", skipping comparison.\n";
+            return 0;
+        }
+        std::cout << "\n=== Comparison against " << baseline_path << " (threshold "
+                  << std::fixed << std::setprecision(0) << (threshold * 100.0) << "%) ===\n";
+        int regressions = bench_compare(results, baseline, threshold);
+        if (regressions) {
+            std::cout << "\n[FAIL] " << regressions << " case(s) regressed.\n";
+            return 1;
+        }
+        std::cout << "\n[PASS] No regressions.\n";
+    }
+
+    return 0;
+}
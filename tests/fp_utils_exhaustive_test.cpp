@@ -2,47 +2,78 @@
 #include <iomanip>
 #include <vector>
 #include "fp_utils.hpp"
+#include "fp_sweep.hpp"
 
 int main() {
     std::cout << "--- Universal Hardware FP Utils Exhaustive Test (BF16) ---\n" << std::endl;
     std::cout << "Running Exhaustive Test (0x0000 - 0xFFFF)...\n";
 
-    bool all_passed = true;
-    int failures = 0;
     const int MAX_FAILURES_TO_PRINT = 10;
 
     // Iterate through all possible 16-bit values
-    for (uint32_t i = 0; i <= 0xFFFF; ++i) {
+    SweepResult<> sweep = fp_sweep(0, 0x10000, [](uint64_t bits, SweepShard<>& shard) {
+        uint32_t i = static_cast<uint32_t>(bits);
+
         // 1. Decompose
         FPRaw components = fp_decompose(i, FPType::BF16);
-        
+
         // 2. Recompose
         uint32_t reconstructed = fp_recompose(components, FPType::BF16);
 
         // 3. Verify
         // We mask with 0xFFFF because we are testing 16-bit BF16 values packed in uint32_t
         if ((i & 0xFFFF) != (reconstructed & 0xFFFF)) {
-            if (failures < MAX_FAILURES_TO_PRINT) {
-                std::cout << "Mismatch: Input 0x" << std::hex << std::setw(4) << std::setfill('0') << i 
-                          << " -> Output 0x" << std::setw(4) << reconstructed << std::dec << "\n";
-                
-                if (failures == 0) {
-                     std::cout << "  [Debug First Fail] Decomposed: S=" << components.sign 
-                               << " Exp=" << components.exponent 
-                               << " Mant=0x" << std::hex << components.mantissa 
-                               << " Hidden=" << components.hidden_bit << "\n";
-                }
-            }
-            failures++;
-            all_passed = false;
+            shard.fail(i, i, reconstructed);
+        }
+    });
+
+    for (size_t k = 0; k < sweep.mismatches.size() && k < MAX_FAILURES_TO_PRINT; ++k) {
+        const SweepMismatch& m = sweep.mismatches[k];
+        std::cout << "Mismatch: Input 0x" << std::hex << std::setw(4) << std::setfill('0') << m.input
+                  << " -> Output 0x" << std::setw(4) << m.actual << std::dec << "\n";
+
+        if (k == 0) {
+            FPRaw components = fp_decompose(static_cast<uint32_t>(m.input), FPType::BF16);
+            std::cout << "  [Debug First Fail] Decomposed: S=" << components.sign
+                      << " Exp=" << components.exponent
+                      << " Mant=0x" << std::hex << components.mantissa
+                      << " Hidden=" << components.hidden_bit << std::dec << "\n";
         }
     }
 
-    if (failures == 0) {
-        std::cout << "\n[SUCCESS] Exhaustive test passed! Checked all 65536 values.\n";
+    // Integer ULP fast path vs calculate_ulp_error: every reference pattern against a strided
+    // set of values plus its own neighbourhood (binade crossings, sign crossings, specials)
+    std::cout << "Checking ulp_error_bits against calculate_ulp_error...\n";
+    SweepResult<> ulp_sweep = fp_sweep(0, 0x10000, [](uint64_t bits, SweepShard<>& shard) {
+        uint32_t ref = static_cast<uint32_t>(bits);
+        double ref_value = fp_to_double(ref, FPType::BF16);
+
+        uint32_t round_trip = 0;
+        bool representable = fp_from_double_exact<FPType::BF16>(ref_value, round_trip);
+        bool special = fp_classify(ref, FPType::BF16).is_nan || fp_classify(ref, FPType::BF16).is_inf;
+        if (representable == special || (representable && round_trip != ref)) shard.fail(ref, ref, round_trip);
+
+        auto check_pair = [&](uint32_t val) {
+            double expected = calculate_ulp_error(ref_value, fp_to_double(val, FPType::BF16), FPType::BF16);
+            double got = ulp_error_bits<FPType::BF16>(ref, val);
+            if (!((std::isnan(expected) && std::isnan(got)) || got == expected)) shard.fail(ref, val, 0);
+        };
+        for (uint32_t val = bits % 251; val <= 0xFFFF; val += 251) check_pair(val);
+        for (int k = -4; k <= 4; ++k) check_pair((ref + k) & 0xFFFF);
+        check_pair(ref ^ 0x8000);
+    });
+
+    for (size_t k = 0; k < ulp_sweep.mismatches.size() && k < MAX_FAILURES_TO_PRINT; ++k) {
+        const SweepMismatch& m = ulp_sweep.mismatches[k];
+        std::cout << "ULP mismatch: Ref 0x" << std::hex << std::setw(4) << std::setfill('0') << m.input
+                  << " Val 0x" << std::setw(4) << m.expected << std::dec << "\n";
+    }
+
+    if (sweep.failures == 0 && ulp_sweep.failures == 0) {
+        std::cout << "\n[SUCCESS] Exhaustive test passed! Checked all " << sweep.checked << " values.\n";
     } else {
-        std::cout << "\n[FAIL] Exhaustive test failed! Total mismatches: " << failures << "\n";
+        std::cout << "\n[FAIL] Exhaustive test failed! Total mismatches: " << sweep.failures + ulp_sweep.failures << "\n";
     }
 
-    return all_passed ? 0 : 1;
-}
\ No newline at end of file
+    return (sweep.failures == 0 && ulp_sweep.failures == 0) ? 0 : 1;
+}
@@ -3,6 +3,7 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <limits>
 #include "fp_utils.hpp"
 
 void print_binary16(uint32_t n) {
@@ -285,6 +286,168 @@ bool test_calculate_ulp_error() {
     return all_passed;
 }
 
+// =========================================================
+// Test: Compile-Time Format API
+// =========================================================
+static_assert(FPFormat<FPType::BF16>::EXP_MASK == 0xFF, "BF16 exponent mask");
+static_assert(FPFormat<FPType::BF16>::MANT_MASK == 0x7F, "BF16 mantissa mask");
+static_assert(FPFormat<FPType::BF16>::PAYLOAD_MASK == 0xFFFF, "BF16 payload mask");
+static_assert(FPFormat<FPType::BF16>::SIGN_SHIFT == 15, "BF16 sign position");
+
+bool test_compile_time_format() {
+    std::cout << "=== TEST: Compile-Time Format API vs Hard-Coded Fields ===\n\n";
+
+    // Expected fields of the decompose/recompose patterns, written out from the BF16 layout
+    // (1 sign, 8 exponent bits with bias 127, 7 mantissa bits), independent of fp_utils.
+    enum Class { ZERO, DENORMAL, NORMAL, INFINITE, NOT_A_NUMBER };
+    struct FieldCase {
+        uint32_t value;
+        Class cls;
+        bool sign;
+        int32_t exponent;
+        uint32_t mantissa;
+        bool hidden_bit;
+        double expected;
+        const char* description;
+    };
+    const double inf = std::numeric_limits<double>::infinity();
+    const std::vector<FieldCase> cases = {
+        {0x3F80, NORMAL,       false,    0, 0x00, true,  1.0,                      "1.0 (Normal)"},
+        {0xC000, NORMAL,       true,     1, 0x00, true,  -2.0,                     "-2.0 (Normal)"},
+        {0x0000, ZERO,         false,    0, 0x00, false, 0.0,                      "+0.0"},
+        {0x8000, ZERO,         true,     0, 0x00, false, -0.0,                     "-0.0"},
+        {0x7F80, INFINITE,     false,    0, 0x00, false, inf,                      "+Inf"},
+        {0xFF80, INFINITE,     true,     0, 0x00, false, -inf,                     "-Inf"},
+        {0x0080, NORMAL,       false, -126, 0x00, true,  std::ldexp(1.0, -126),    "+Min Normal"},
+        {0x8080, NORMAL,       true,  -126, 0x00, true,  -std::ldexp(1.0, -126),   "-Min Normal"},
+        {0x7F7F, NORMAL,       false,  127, 0x7F, true,  std::ldexp(255.0, 120),   "+Max Normal"},
+        {0xFF7F, NORMAL,       true,   127, 0x7F, true,  -std::ldexp(255.0, 120),  "-Max Normal"},
+        {0x3FC0, NORMAL,       false,    0, 0x40, true,  1.5,                      "+Middle Normal (1.5)"},
+        {0x0001, DENORMAL,     false, -126, 0x01, false, std::ldexp(1.0, -133),    "+Min Denormal"},
+        {0x8001, DENORMAL,     true,  -126, 0x01, false, -std::ldexp(1.0, -133),   "-Min Denormal"},
+        {0x007F, DENORMAL,     false, -126, 0x7F, false, std::ldexp(127.0, -133),  "+Max Denormal"},
+        {0x807F, DENORMAL,     true,  -126, 0x7F, false, -std::ldexp(127.0, -133), "-Max Denormal"},
+        {0x0040, DENORMAL,     false, -126, 0x40, false, std::ldexp(1.0, -127),    "+Middle Denormal"},
+        {0x7FC0, NOT_A_NUMBER, false,    0, 0x40, false, std::nan(""),             "+NaN (Standard QNaN)"},
+        {0x7F81, NOT_A_NUMBER, false,    0, 0x01, false, std::nan(""),             "+NaN (Min Payload)"},
+        {0x7FFF, NOT_A_NUMBER, false,    0, 0x7F, false, std::nan(""),             "+NaN (Max Payload)"},
+        {0xFFC0, NOT_A_NUMBER, true,     0, 0x40, false, std::nan(""),             "-NaN (Standard QNaN)"},
+    };
+
+    bool all_passed = true;
+    for (const FieldCase& c : cases) {
+        const FPStatus st = fp_classify<FPType::BF16>(c.value);
+        const FPRaw p = fp_decompose<FPType::BF16>(c.value);
+        const double d = fp_to_double<FPType::BF16>(c.value);
+
+        bool same = st.is_zero == (c.cls == ZERO) && st.is_denormal == (c.cls == DENORMAL) &&
+                    st.is_inf == (c.cls == INFINITE) && st.is_nan == (c.cls == NOT_A_NUMBER) &&
+                    p.status.is_zero == st.is_zero && p.status.is_denormal == st.is_denormal &&
+                    p.status.is_inf == st.is_inf && p.status.is_nan == st.is_nan &&
+                    p.sign == c.sign && p.exponent == c.exponent && p.mantissa == c.mantissa &&
+                    p.hidden_bit == c.hidden_bit &&
+                    (c.cls == NOT_A_NUMBER ? std::isnan(d) : (d == c.expected && std::signbit(d) == c.sign)) &&
+                    fp_recompose<FPType::BF16>(p) == c.value;
+
+        std::cout << (same ? "  [PASS] " : "  [FAIL] ") << c.description << "\n";
+        all_passed &= same;
+    }
+
+    // Recompose of fields that are not a decomposed pattern
+    FPRaw qnan = {};
+    qnan.status.is_nan = true;
+    FPRaw tiny = {};
+    tiny.exponent = -127;
+    tiny.hidden_bit = true;
+    FPRaw huge = {};
+    huge.exponent = 128;
+    huge.hidden_bit = true;
+    huge.mantissa = 0x12;
+    bool recompose = fp_recompose<FPType::BF16>(qnan) == 0x7FC0 && fp_recompose<FPType::BF16>(tiny) == 0x0000 &&
+                     fp_recompose<FPType::BF16>(huge) == 0x7F80;
+    std::cout << (recompose ? "  [PASS]" : "  [FAIL]") << " Empty NaN payload -> QNaN, exponent underflow -> 0, overflow -> Inf\n\n";
+
+    return all_passed && recompose;
+}
+
+// =========================================================
+// Test: Integer-Domain ULP Distance
+// =========================================================
+bool test_ulp_distance_bits() {
+    std::cout << "=== TEST: Integer-Domain ULP Distance ===\n\n";
+
+    struct DistanceCase {
+        uint32_t a;
+        uint32_t b;
+        uint64_t expected;
+        const char* description;
+    };
+    std::vector<DistanceCase> cases = {
+        {0x3F80, 0x3F80, 0, "Same value"},
+        {0x3F80, 0x3F81, 1, "Adjacent normals"},
+        {0x3F7F, 0x3F80, 1, "Across a binade boundary"},
+        {0x0000, 0x8000, 0, "+0 vs -0"},
+        {0x0001, 0x8001, 2, "Smallest subnormals across zero"},
+        {0x3F80, 0xBF80, 2 * 0x3F80, "1.0 vs -1.0"},
+        {0x007F, 0x0080, 1, "Largest subnormal to smallest normal"},
+        {0x7F7F, 0x7F80, 1, "Max finite to Inf"},
+        {0x7FC0, 0x3F80, ULP_DISTANCE_NAN, "NaN operand"},
+    };
+
+    bool all_passed = true;
+    for (const auto& c : cases) {
+        uint64_t d = ulp_distance_bits(c.a, c.b, FPType::BF16);
+        bool pass = (d == c.expected) && (ulp_distance_bits(c.b, c.a, FPType::BF16) == d);
+        std::cout << (pass ? "  [PASS] " : "  [FAIL] ") << c.description << ": " << d << "\n";
+        all_passed &= pass;
+    }
+
+    // ulp_error_bits / calculate_ulp_error_raw must return exactly what calculate_ulp_error returns
+    struct ErrorCase {
+        uint32_t ref;
+        uint32_t val;
+        const char* description;
+    };
+    std::vector<ErrorCase> error_cases = {
+        {0x4000, 0x3FFF, "Value just below a binade boundary (0.5 ULP of ref)"},
+        {0x3FFF, 0x4000, "Value just above a binade boundary"},
+        {0x0000, 0x0001, "Zero reference"},
+        {0x0001, 0x8001, "Subnormals across zero"},
+        {0x3F80, 0x0001, "Far-apart exponents (double path)"},
+        {0x7F80, 0x7F80, "Inf reference, Inf value"},
+        {0x7F80, 0x7F7F, "Inf reference, finite value"},
+        {0x3F80, 0x7FC0, "NaN value"},
+    };
+    for (const auto& c : error_cases) {
+        double expected = calculate_ulp_error(fp_to_double(c.ref, FPType::BF16), fp_to_double(c.val, FPType::BF16), FPType::BF16);
+        double got = ulp_error_bits(c.ref, c.val, FPType::BF16);
+        double got_raw = calculate_ulp_error_raw(fp_to_double(c.ref, FPType::BF16), c.val, FPType::BF16);
+        bool pass = (std::isnan(expected) && std::isnan(got) && std::isnan(got_raw)) || (got == expected && got_raw == expected);
+        std::cout << (pass ? "  [PASS] " : "  [FAIL] ") << c.description << ": " << got << "\n";
+        all_passed &= pass;
+    }
+
+    // Higher precision reference falls back to the double path
+    double ref = 1.0 + 1.0 / 3.0;
+    bool fallback = calculate_ulp_error_raw(ref, 0x3FAB, FPType::BF16) ==
+                    calculate_ulp_error(ref, fp_to_double(0x3FAB, FPType::BF16), FPType::BF16);
+    std::cout << (fallback ? "  [PASS] " : "  [FAIL] ") << "Non-representable reference\n";
+    all_passed &= fallback;
+
+    // Batch versions
+    std::vector<uint16_t> a = {0x3F80, 0x0001, 0x4000};
+    std::vector<uint16_t> b = {0x3F82, 0x8001, 0x3FFF};
+    std::vector<uint64_t> dist(a.size());
+    std::vector<double> err(a.size());
+    ulp_distance_bits_batch(a.data(), b.data(), dist.data(), a.size(), FPType::BF16);
+    ulp_error_bits_batch(a.data(), b.data(), err.data(), a.size(), FPType::BF16);
+    bool batch = dist[0] == 2 && dist[1] == 2 && dist[2] == 1 && err[0] == 2.0 && err[1] == 2.0 && err[2] == 0.5;
+    std::cout << (batch ? "  [PASS] " : "  [FAIL] ") << "Batch versions\n\n";
+    all_passed &= batch;
+
+    return all_passed;
+}
+
 // =========================================================
 // Main
 // =========================================================
@@ -298,6 +461,8 @@ int main() {
     all_passed &= test_decompose_recompose();
     all_passed &= test_fp_to_double();
     all_passed &= test_calculate_ulp_error();
+    all_passed &= test_compile_time_format();
+    all_passed &= test_ulp_distance_bits();
 
     std::cout << "==========================================================\n";
     if (all_passed) {
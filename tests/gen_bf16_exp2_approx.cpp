@@ -2,12 +2,17 @@
 #include <fstream>
 #include <iomanip>
 #include <cstdint>
+#include <vector>
 #include "../src/approximations/bf16_exp2.hpp"
+#include "../src/utils/fp_sweep.hpp"
+#include "../src/utils/golden_io.hpp"
 
 int main() {
     const std::string filename_exp2 = "modeling/golden_ref/bf16_exp2_approx_out.txt";
     const std::string filename_expe = "modeling/golden_ref/bf16_expe_approx_out.txt";
-    
+    const std::string bin_filename_exp2 = "modeling/golden_ref/bf16_exp2_approx_out.bin";
+    const std::string bin_filename_expe = "modeling/golden_ref/bf16_expe_approx_out.bin";
+
     std::ofstream outfile_exp2(filename_exp2);
     std::ofstream outfile_expe(filename_expe);
 
@@ -22,15 +27,27 @@ int main() {
 
     std::cout << "Generating approximation data for all BF16 values...\n";
 
-    // Iterate through all possible negative 16-bit values
-    for (uint32_t i = 0x8000; i <= 0xFFFF; ++i) {
-        uint16_t input_raw = static_cast<uint16_t>(i);
-        
+    // Evaluate all possible negative 16-bit values in parallel
+    const uint32_t FIRST = 0x8000;
+    const uint32_t LAST = 0xFFFF;
+    std::vector<uint16_t> results_exp2(LAST - FIRST + 1);
+    std::vector<uint16_t> results_expe(LAST - FIRST + 1);
+
+    fp_sweep_for_each(FIRST, uint64_t(LAST) + 1, [&](uint64_t bits) {
+        uint16_t input_raw = static_cast<uint16_t>(bits);
+
         // Run approximation for exp2 (base 2)
-        uint16_t output_exp2 = bf16_exp2_approx(input_raw, true);
+        results_exp2[bits - FIRST] = bf16_exp2_approx(input_raw, true);
 
         // Run approximation for expe (base e)
-        uint16_t output_expe = bf16_exp2_approx(input_raw, false);
+        results_expe[bits - FIRST] = bf16_exp2_approx(input_raw, false);
+    });
+
+    // Write results in input order
+    for (uint32_t i = FIRST; i <= LAST; ++i) {
+        uint16_t input_raw = static_cast<uint16_t>(i);
+        uint16_t output_exp2 = results_exp2[i - FIRST];
+        uint16_t output_expe = results_expe[i - FIRST];
 
         // Write to exp2 file
         outfile_exp2 << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << input_raw 
@@ -45,7 +62,28 @@ int main() {
 
     outfile_exp2.close();
     outfile_expe.close();
+
+    // Binary copies for mmap-based consumers (ulp_error_analysis)
+    GoldenInfo info;
+    info.format = GoldenFormat::ApproxOutput;
+    info.function = GoldenFunction::Exp;
+    info.first_input = FIRST;
+    info.config_hash = bf16_exp2_config_hash();
+
+    std::string error;
+    info.base = GoldenBase::Two;
+    if (!golden_write_binary(bin_filename_exp2, info, results_exp2.data(), nullptr, results_exp2.size(), &error)) {
+        std::cerr << "Error: " << error << "\n";
+        return 1;
+    }
+    info.base = GoldenBase::E;
+    if (!golden_write_binary(bin_filename_expe, info, results_expe.data(), nullptr, results_expe.size(), &error)) {
+        std::cerr << "Error: " << error << "\n";
+        return 1;
+    }
+
     std::cout << "Done. Data written to " << filename_exp2 << " and " << filename_expe << "\n";
+    std::cout << "Binary copies written to " << bin_filename_exp2 << " and " << bin_filename_expe << "\n";
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,112 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include "../src/utils/fp_utils.hpp"
+#include "../src/utils/fp_sweep.hpp"
+#include "../src/utils/fp_reference.hpp"
+#include "../src/utils/golden_io.hpp"
+
+/**
+ * @brief CPU replacement for modeling/golden_ref/bf16_exp2.cu.
+ * * Evaluates 2^x and e^x for all 65536 BF16 inputs in x87 extended precision (64-bit
+ * significand), rounds them correctly to BF16 and writes golden REFERENCE tables with
+ * the rounding residual as the value column. The ULP tools load these tables instead of
+ * recomputing std::exp2 / std::exp.
+ *
+ * Usage: gen_bf16_reference [--cuda-golden modeling/golden_ref/output.txt]
+ * Fails if any entry is a hard case (extended precision too close to a rounding boundary).
+ */
+
+struct ReferenceJob {
+    const char* name;
+    GoldenBase base;
+    std::string path;
+};
+
+int main(int argc, char** argv) {
+    std::string cuda_golden = "modeling/golden_ref/output.txt";
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--cuda-golden" && i + 1 < argc) {
+            cuda_golden = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--cuda-golden output.txt]\n";
+            return 1;
+        }
+    }
+
+    static_assert(std::numeric_limits<long double>::digits >= 64, "Extended precision long double required");
+
+    const ReferenceJob jobs[] = {
+        {"exp2", GoldenBase::Two, "modeling/golden_ref/bf16_exp2_ref.bin"},
+        {"expe", GoldenBase::E, "modeling/golden_ref/bf16_expe_ref.bin"},
+    };
+    const uint64_t COUNT = 0x10000;
+    bool ok = true;
+
+    for (const ReferenceJob& job : jobs) {
+        std::cout << "Generating correctly rounded BF16 " << job.name << " reference...\n";
+
+        std::vector<uint16_t> results(COUNT);
+        std::vector<float> residuals(COUNT);
+        std::atomic<uint64_t> hard_cases(0);
+        const bool base2 = (job.base == GoldenBase::Two);
+
+        fp_sweep_for_each(0, COUNT, [&](uint64_t bits) {
+            // BF16 inputs are exact in long double
+            long double x = static_cast<long double>(fp_to_double(static_cast<uint32_t>(bits), FPType::BF16));
+            long double y = base2 ? std::exp2(x) : std::exp(x);
+
+            // 2^n and e^0 are exact, everything else is transcendental (never a true tie)
+            bool exact = base2 ? (std::isfinite(x) && std::nearbyint(x) == x) : (x == 0.0L);
+            FPReferenceEntry e = fp_round_reference<FPType::BF16>(y, exact);
+            results[bits] = static_cast<uint16_t>(e.result);
+            residuals[bits] = e.residual;
+            if (e.hard) {
+                hard_cases.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        GoldenInfo info;
+        info.format = GoldenFormat::Reference;
+        info.function = GoldenFunction::Exp;
+        info.base = job.base;
+        info.fp_type = FPType::BF16;
+        info.first_input = 0;
+
+        std::string error;
+        if (!golden_write_binary(job.path, info, results.data(), residuals.data(), COUNT, &error)) {
+            std::cerr << "Error: " << error << "\n";
+            ok = false;
+            continue;
+        }
+
+        std::cout << "  Hard cases: " << hard_cases.load() << "\n";
+        ok &= (hard_cases.load() == 0);
+
+        // Agreement with the CUDA golden (exp2f + __float2bfloat16 on the GPU)
+        GoldenFile cuda;
+        if (base2 && cuda.open(cuda_golden) && cuda.first_input() == 0 && cuda.count() == COUNT) {
+            uint64_t differ = 0;
+            for (uint64_t i = 0; i < COUNT; ++i) {
+                bool both_nan = fp_classify(results[i], FPType::BF16).is_nan &&
+                                fp_classify(cuda.results()[i], FPType::BF16).is_nan;
+                if (!both_nan && results[i] != cuda.results()[i]) differ++;
+            }
+            std::cout << "  Entries differing from " << cuda_golden << ": " << differ << "\n";
+        }
+
+        std::cout << "  Written to: " << job.path << "\n";
+    }
+
+    if (ok) {
+        std::cout << "\n[SUCCESS] Reference tables generated.\n";
+    } else {
+        std::cout << "\n[FAIL] Reference generation incomplete.\n";
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include "golden_io.hpp"
+
+/**
+ * @brief Converts golden-reference tables between the text and binary formats.
+ * * The direction follows the input: a binary file is written out as text, a text file
+ * as binary. Text files carry no metadata, so function, base, format and config hash
+ * can be given on the command line when converting to binary. Without --hash, an
+ * existing binary output keeps its config hash, so refreshing a committed golden from
+ * its text copy does not drop the hash that ties it to the datapath.
+ */
+void print_usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " <input> <output> [options]\n"
+              << "  --function exp2|expe   Function/base recorded in the binary header\n"
+              << "  --format approx|ulp|reference\n"
+              << "                         Override the format inferred from the column count\n"
+              << "  --hash <hex>           Config hash recorded in the binary header\n"
+              << "                         (default: kept from an existing binary output)\n"
+              << "  --lowercase            Lowercase hex digits when writing text\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    const std::string input_filename = argv[1];
+    const std::string output_filename = argv[2];
+
+    GoldenFile table;
+    std::string error;
+    if (!table.open(input_filename, &error)) {
+        std::cerr << "Error: " << error << "\n";
+        return 1;
+    }
+
+    GoldenInfo info = table.info();
+    bool uppercase = true;
+    bool has_hash = false;
+    for (int i = 3; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = (i + 1 < argc);
+        if (arg == "--function" && has_value) {
+            std::string fn = argv[++i];
+            info.function = GoldenFunction::Exp;
+            if (fn == "exp2") {
+                info.base = GoldenBase::Two;
+            } else if (fn == "expe") {
+                info.base = GoldenBase::E;
+            } else {
+                std::cerr << "Error: Unknown function " << fn << "\n";
+                return 1;
+            }
+        } else if (arg == "--format" && has_value) {
+            std::string fmt = argv[++i];
+            if (fmt == "approx") {
+                info.format = GoldenFormat::ApproxOutput;
+            } else if (fmt == "ulp") {
+                info.format = GoldenFormat::UlpReport;
+            } else if (fmt == "reference") {
+                info.format = GoldenFormat::Reference;
+            } else {
+                std::cerr << "Error: Unknown format " << fmt << "\n";
+                return 1;
+            }
+        } else if (arg == "--hash" && has_value) {
+            info.config_hash = std::stoull(argv[++i], nullptr, 16);
+            has_hash = true;
+        } else if (arg == "--lowercase") {
+            uppercase = false;
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Keep the hash of the binary being replaced unless one was given
+    if (!table.is_mapped() && !has_hash && golden_is_binary(output_filename)) {
+        GoldenFile previous;
+        if (previous.open(output_filename)) info.config_hash = previous.config_hash();
+    }
+
+    bool ok;
+    if (table.is_mapped()) {
+        ok = golden_write_text(output_filename, table, uppercase, &error);
+    } else {
+        ok = golden_write_binary(output_filename, info, table.results(), table.values(), table.count(), &error);
+    }
+    if (!ok) {
+        std::cerr << "Error: " << error << "\n";
+        return 1;
+    }
+
+    std::cout << input_filename << " -> " << output_filename << " (" << table.count() << " entries, "
+              << (table.is_mapped() ? "binary to text" : "text to binary") << ")\n";
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include "../src/approximations/bf16_exp2_batch.hpp"
+
+struct IsaCase {
+    Bf16BatchIsa isa;
+    const char* name;
+    bool supported;
+};
+
+/**
+ * @brief Runs one ISA over all 65536 inputs and compares against the scalar model.
+ * * The batch starts at an odd offset so the vector loop and the scalar tail are both exercised.
+ */
+bool check_isa(const IsaCase& c, bool base2) {
+    const uint32_t N = 0x10000;
+    const size_t OFFSET = 3;
+    std::vector<uint16_t> in(N + OFFSET), out(N + OFFSET);
+    for (uint32_t i = 0; i < N; ++i) in[i + OFFSET] = static_cast<uint16_t>(i);
+
+    bf16_exp2_approx_batch(in.data() + OFFSET, out.data() + OFFSET, N, base2, c.isa);
+
+    int failures = 0;
+    const int MAX_FAILURES_TO_PRINT = 10;
+    for (uint32_t i = 0; i < N; ++i) {
+        uint16_t expected = bf16_exp2_approx(static_cast<uint16_t>(i), base2);
+        uint16_t got = out[i + OFFSET];
+        if (got != expected) {
+            if (failures < MAX_FAILURES_TO_PRINT) {
+                std::cout << "  Mismatch: Input 0x" << std::hex << std::setw(4) << std::setfill('0') << i
+                          << " -> Expected 0x" << std::setw(4) << expected
+                          << " Got 0x" << std::setw(4) << got << std::dec << "\n";
+            }
+            failures++;
+        }
+    }
+
+    std::cout << (failures == 0 ? "[PASS] " : "[FAIL] ") << c.name << " " << (base2 ? "exp2" : "expe");
+    if (failures) std::cout << ": " << failures << " mismatches";
+    std::cout << "\n";
+    return failures == 0;
+}
+
+int main() {
+    std::cout << "--- BF16 exp2 Batch Kernel Equivalence Test ---\n" << std::endl;
+
+    Bf16BatchIsa best = bf16_exp2_batch_isa();
+    std::vector<IsaCase> cases = {
+        {Bf16BatchIsa::Scalar, "Scalar", true},
+        {Bf16BatchIsa::AVX2, "AVX2", best == Bf16BatchIsa::AVX2 || best == Bf16BatchIsa::AVX512BW},
+        {Bf16BatchIsa::AVX512BW, "AVX-512BW", best == Bf16BatchIsa::AVX512BW},
+    };
+
+    bool all_passed = true;
+    for (const auto& c : cases) {
+        if (!c.supported) {
+            std::cout << "[SKIP] " << c.name << " not supported on this CPU\n";
+            continue;
+        }
+        all_passed &= check_isa(c, true);
+        all_passed &= check_isa(c, false);
+    }
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Batch kernels are bit-identical to bf16_exp2_approx.\n";
+    } else {
+        std::cout << "\n[FAIL] Batch kernels differ from bf16_exp2_approx.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
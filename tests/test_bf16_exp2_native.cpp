@@ -0,0 +1,59 @@
+#include <iostream>
+#include <iomanip>
+#include "../src/approximations/bf16_exp2.hpp"
+
+/**
+ * @brief Exhaustive equivalence test: native-integer core vs ac_fixed (HLS) core.
+ * * Every BF16 pattern that bf16_exp2_approx would route to the core (finite, exponent in
+ * [INPUT_MIN_EXP, INPUT_MAX_EXP]) is evaluated by both models; sign is ignored by the
+ * core, so positive patterns are included as well. Checked for every datapath variant.
+ */
+template<typename Cfg>
+bool check_base(bool base2, const char* variant) {
+    int failures = 0;
+    int checked = 0;
+    const int MAX_FAILURES_TO_PRINT = 10;
+
+    for (uint32_t i = 0; i <= 0xFFFF; ++i) {
+        FPRaw parts = fp_decompose(i, FPType::BF16);
+        if (parts.status.is_nan || parts.status.is_inf || parts.status.is_zero) continue;
+        if (parts.exponent < bf16_cfg::INPUT_MIN_EXP || parts.exponent > bf16_cfg::INPUT_MAX_EXP) continue;
+
+        uint32_t hls = fp_recompose(base2 ? bf16_exp_core_approx<Base::Two, Cfg>(parts)
+                                          : bf16_exp_core_approx<Base::E, Cfg>(parts), FPType::BF16);
+        uint32_t native = fp_recompose(base2 ? bf16_exp_core_approx_native<Base::Two, Cfg>(parts)
+                                             : bf16_exp_core_approx_native<Base::E, Cfg>(parts), FPType::BF16);
+
+        checked++;
+        if (hls != native) {
+            if (failures < MAX_FAILURES_TO_PRINT) {
+                std::cout << "  Mismatch: Input 0x" << std::hex << std::setw(4) << std::setfill('0') << i
+                          << " -> HLS 0x" << std::setw(4) << hls
+                          << " Native 0x" << std::setw(4) << native << std::dec << "\n";
+            }
+            failures++;
+        }
+    }
+
+    std::cout << (failures == 0 ? "[PASS] " : "[FAIL] ") << variant << " " << (base2 ? "exp2" : "expe")
+              << ": " << checked << " core inputs, " << failures << " mismatches\n";
+    return failures == 0;
+}
+
+int main() {
+    std::cout << "--- BF16 exp2 Native vs HLS Core Equivalence Test ---\n" << std::endl;
+
+    bool all_passed = true;
+    all_passed &= check_base<bf16_exp_high_accuracy>(true, "high-accuracy");
+    all_passed &= check_base<bf16_exp_high_accuracy>(false, "high-accuracy");
+    all_passed &= check_base<bf16_exp_low_area>(true, "low-area");
+    all_passed &= check_base<bf16_exp_low_area>(false, "low-area");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Native core is bit-identical to the ac_fixed core.\n";
+    } else {
+        std::cout << "\n[FAIL] Native core differs from the ac_fixed core.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
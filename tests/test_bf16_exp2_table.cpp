@@ -0,0 +1,81 @@
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+#include "../src/approximations/bf16_exp2_table.hpp"
+#include "../src/utils/golden_io.hpp"
+
+int main() {
+    std::cout << "--- BF16 exp2 Lookup Table Self-Check ---\n" << std::endl;
+
+    // Race the lazy initialization from several threads; every thread must see the same table.
+    const int NUM_THREADS = 4;
+    std::vector<const uint16_t*> seen(NUM_THREADS * 2, nullptr);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([t, &seen]() {
+            seen[2 * t] = bf16_exp2_table::get(true).data();
+            seen[2 * t + 1] = bf16_exp2_table::get(false).data();
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    bool all_passed = true;
+    for (int t = 1; t < NUM_THREADS; ++t) {
+        if (seen[2 * t] != seen[0] || seen[2 * t + 1] != seen[1]) {
+            std::cout << "[FAIL] Thread " << t << " observed a different table instance.\n";
+            all_passed = false;
+        }
+    }
+
+    const char* names[2] = {"exp2", "expe"};
+    const char* goldens[2] = {"modeling/golden_ref/bf16_exp2_approx_out.bin", "modeling/golden_ref/bf16_expe_approx_out.bin"};
+    for (int b = 0; b < 2; ++b) {
+        bool base2 = (b == 0);
+        const bf16_exp2_table::table_t& table = bf16_exp2_table::get(base2);
+
+        // Every input against the model routed through the other core implementation
+        uint32_t first_mismatch = 0;
+        uint32_t mismatches = bf16_exp2_table::verify(table, base2, &first_mismatch);
+        if (mismatches == 0) {
+            std::cout << "[PASS] " << names[b] << " table matches the other core for all 65536 inputs.\n";
+        } else {
+            std::cout << "[FAIL] " << names[b] << " table vs other core: " << mismatches << " mismatches, first at 0x"
+                      << std::hex << std::setw(4) << std::setfill('0') << first_mismatch << std::dec << "\n";
+            all_passed = false;
+        }
+
+        // Negative half against the committed golden outputs
+        GoldenFile golden;
+        std::string error;
+        if (!golden.open(goldens[b], &error) || golden.header().fp_type != static_cast<uint32_t>(FPType::BF16) ||
+            golden.base() != (base2 ? GoldenBase::Two : GoldenBase::E) || golden.config_hash() != bf16_exp2_config_hash() ||
+            golden.first_input() + golden.count() > bf16_exp2_table::TABLE_SIZE) {
+            std::cout << "[FAIL] " << names[b] << " golden unusable: " << (error.empty() ? goldens[b] : error) << "\n";
+            all_passed = false;
+            continue;
+        }
+        mismatches = bf16_exp2_table::verify(table, golden.results(), static_cast<uint32_t>(golden.first_input()),
+                                             static_cast<uint32_t>(golden.count()), &first_mismatch);
+        if (mismatches == 0 && golden.count() != 0) {
+            std::cout << "[PASS] " << names[b] << " table matches " << goldens[b] << " (" << golden.count() << " inputs).\n";
+        } else {
+            std::cout << "[FAIL] " << names[b] << " table vs golden: " << mismatches << " mismatches, first at 0x"
+                      << std::hex << std::setw(4) << std::setfill('0') << first_mismatch << std::dec << "\n";
+            all_passed = false;
+        }
+    }
+
+    if (bf16_exp2_table_self_check() != 0) {
+        std::cout << "[FAIL] bf16_exp2_table_self_check reported mismatches.\n";
+        all_passed = false;
+    }
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Lookup tables match the other core and the committed goldens.\n";
+    } else {
+        std::cout << "\n[FAIL] Lookup table self-check failed.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
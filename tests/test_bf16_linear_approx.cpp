@@ -3,49 +3,24 @@
 #include <cmath>
 #include <cstring>
 #include <cstdint>
+#include <vector>
 
 // Include the utilities and the generated coefficients
 // Adjust paths if your directory structure is different
 #include "../src/utils/fp_utils.hpp"
+#include "../src/utils/fp_convert.hpp"
 #include "../modeling/coeff_gen/bf16_exp2_coeffs.hpp"
 
-/**
- * @brief Converts a double to BF16 raw bits (uint16_t).
- * 
- * Standard BFloat16 conversion usually involves taking the upper 16 bits 
- * of the Float32 representation.
- */
-uint16_t double_to_bf16(double val) {
-    // 1. Convert double to float (standard IEEE 754 single precision)
-    float f = static_cast<float>(val);
-    
-    // 2. Bit-cast float to uint32_t to access bits
-    uint32_t bits;
-    std::memcpy(&bits, &f, sizeof(bits));
-
-    // Handle NaN explicitly
-    if (std::isnan(f)) {
-        return 0x7FC0; // Canonical qNaN
-    }
-    
-    // 3. Round to Nearest Even (RNE)
-    // We add a bias based on the LSB of the target format to handle the tie-breaking rule.
-    // If LSB is 0, we add 0x7FFF (round half down/truncate if exactly half).
-    // If LSB is 1, we add 0x8000 (round half up to next even).
-    uint32_t lsb = (bits >> 16) & 1;
-    uint32_t rounding_bias = 0x7FFF + lsb;
-    bits += rounding_bias;
-    
-    // 4. Shift right by 16
-    return static_cast<uint16_t>(bits >> 16);
-}
-
 int main() {
     // Use the constants defined in the generated header file
     // Range: [-0.25, -0.001953125)
     const float start_range = bf16_exp2::INTERVAL_START;
     const float end_range = bf16_exp2::INTERVAL_END;
 
+    // Inputs in range and their results (narrowed to BF16 in one batch below)
+    std::vector<uint16_t> inputs;
+    std::vector<float> results;
+
     // Iterate through all possible 16-bit patterns
     for (uint32_t i = 0; i <= 0xFFFF; ++i) {
         // Convert raw bits to double for analysis
@@ -65,17 +40,23 @@ int main() {
             // 3. Calculate Linear Approximation: y = ax + b
             double y = a * x + b;
 
-            // 4. Convert result back to BF16 raw bits
-            uint16_t y_raw = double_to_bf16(y);
-
-            // 5. Output in format: HEX_IN HEX_OUT
-            std::cout << std::hex << std::uppercase 
-                      << std::setw(4) << std::setfill('0') << i 
-                      << " " 
-                      << std::setw(4) << std::setfill('0') << y_raw 
-                      << "\n";
+            inputs.push_back(static_cast<uint16_t>(i));
+            results.push_back(static_cast<float>(y));
         }
     }
 
+    // 4. Convert results back to BF16 raw bits (RNE, vectorized)
+    std::vector<uint16_t> results_raw(results.size());
+    float_to_bf16_batch(results.data(), results_raw.data(), results.size());
+
+    // 5. Output in format: HEX_IN HEX_OUT
+    for (size_t k = 0; k < inputs.size(); ++k) {
+        std::cout << std::hex << std::uppercase 
+                  << std::setw(4) << std::setfill('0') << inputs[k] 
+                  << " " 
+                  << std::setw(4) << std::setfill('0') << results_raw[k] 
+                  << "\n";
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,28 @@
+#ifndef TEST_CHECK_HPP
+#define TEST_CHECK_HPP
+
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Prints one "[PASS] what" / "[FAIL] what" line.
+ * @return cond, so results can be folded with all_passed &= check(...).
+ */
+inline bool check(bool cond, const char* what) {
+    std::cout << (cond ? "[PASS] " : "[FAIL] ") << what << "\n";
+    return cond;
+}
+
+inline bool check(bool cond, const std::string& what) {
+    return check(cond, what.c_str());
+}
+
+/** @brief Scratch directory: argv[1], else the directory holding the test binary. */
+inline std::string scratch_dir(int argc, char** argv) {
+    if (argc > 1) return argv[1];
+    const std::string self = argv[0];
+    const size_t slash = self.find_last_of('/');
+    return slash == std::string::npos ? "." : self.substr(0, slash);
+}
+
+#endif // TEST_CHECK_HPP
@@ -0,0 +1,75 @@
+#include <iostream>
+#include <algorithm>
+#include "bf16_cost_model.hpp"
+#include "test_check.hpp"
+
+typedef bf16_exp_high_accuracy HA;
+typedef bf16_exp_low_area LA;
+
+constexpr ExpCostEstimate ha = bf16_exp_cost_estimate<HA>();
+constexpr ExpCostEstimate la = bf16_exp_cost_estimate<LA>();
+
+// The estimate is usable in constant expressions
+static_assert(ha.mult_pp_bits == 21 * 39, "a*x: 21 x 39 partial products");
+static_assert(ha.critical_delay(EXP_PIPE_CUTS_ALL) < ha.critical_delay(EXP_PIPE_CUTS_NONE), "pipelining shortens the period");
+
+int main() {
+    std::cout << "--- Resource and Timing Estimate Unit Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. Structure derived from the widths
+    all_passed &= check(ha.mult_rows == HA::COEFF_W && ha.mult_cols == HA::MULT_W && ha.mult_pp_bits == 819 &&
+                        ha.mult_levels == bf16_cost::dadda_levels(21),
+                        "a*x multiplier: 21 x 39 = 819 partial products in 60 columns, Dadda levels of 21 rows");
+    all_passed &= check(ha.rom_bits == 5376 && la.rom_bits == 960,
+                        "coefficient ROM: 128 x 42 and 32 x 30 bits");
+    constexpr ExpCostEstimate trunc = bf16_exp_cost_estimate<bf16_exp_trunc_mult_t<HA, 25>>();
+    all_passed &= check(trunc.mult_pp_bits == bf16_trunc_mult_pp_bits(HA::COEFF_W, HA::IN_W, HA::MULT_W - 25) &&
+                        trunc.mult_pp_bits == 294 && trunc.mult_cols == 25,
+                        "truncated a*x (25 columns kept): 294 partial products");
+    all_passed &= check(ha.reduce_shift_stages == bf16_cost::ceil_log2(HA::INPUT_MAX_EXP - HA::INPUT_MIN_EXP + 1) &&
+                        ha.lzc_depth == bf16_cost::ceil_log2(ha.lzc_w),
+                        "shifter stages and priority-encoder depth follow the shift range and width");
+
+    // 2. Datapath variants move area in the expected direction
+    constexpr ExpCostEstimate csd = bf16_exp_cost_estimate<bf16_exp_csd_log2e_t<HA, 9, 0x5c551e>>();
+    constexpr ExpCostEstimate rtz = bf16_exp_cost_estimate<bf16_exp_rounding_t<HA, bf16_round_rtz>>();
+    constexpr ExpCostEstimate sr = bf16_exp_cost_estimate<bf16_exp_rounding_t<HA, bf16_round_stochastic<bf16_lfsr16>>>();
+    all_passed &= check(trunc.logic_area() < ha.logic_area() && csd.log2e_pp_bits < ha.log2e_pp_bits &&
+                        csd.logic_area() < ha.logic_area() && la.area(EXP_PIPE_CUTS_NONE) < ha.area(EXP_PIPE_CUTS_NONE),
+                        "truncation, shift-and-add log2(e) and the low-area widths reduce area");
+    all_passed &= check(rtz.round_inc_w == 0 && rtz.logic_area() < ha.logic_area() &&
+                        sr.lfsr_bits == 16 && sr.rand_add_w > 0 && sr.area(EXP_PIPE_CUTS_NONE) > ha.area(EXP_PIPE_CUTS_NONE),
+                        "rounding: RTZ drops the incrementer, stochastic adds a 16-bit LFSR and an adder");
+
+    // 3. Stage delays follow the pipeline partitions
+    int sum = 0, worst = 0;
+    for (int op = 0; op < EXP_PIPE_OPS; ++op) {
+        sum += ha.op_delay[op];
+        worst = std::max(worst, ha.op_delay[op]);
+    }
+    all_passed &= check(ha.critical_delay(EXP_PIPE_CUTS_NONE) == sum + bf16_cost::REG_DELAY &&
+                        ha.critical_delay(EXP_PIPE_CUTS_ALL) == worst + bf16_cost::REG_DELAY &&
+                        ha.register_bits(EXP_PIPE_CUTS_NONE) == 16,
+                        "single stage: sum of operation delays; 8 stages: slowest operation");
+
+    bool monotonic = true;
+    for (uint32_t cuts = 0; cuts <= EXP_PIPE_CUTS_ALL; ++cuts) {
+        for (int op = 0; op < EXP_PIPE_OPS - 1; ++op) {
+            const uint32_t more = cuts | (1u << op);
+            monotonic &= ha.critical_delay(more) <= ha.critical_delay(cuts) && ha.register_bits(more) >= ha.register_bits(cuts);
+        }
+    }
+    int stage_sum = 0;
+    for (int s = 0; s < 4; ++s) stage_sum += ha.stage_delay(EXP_PIPE_CUTS_4, s) - bf16_cost::REG_DELAY;
+    all_passed &= check(monotonic && stage_sum == sum && ha.fmax(EXP_PIPE_CUTS_4) > ha.fmax(EXP_PIPE_CUTS_NONE),
+                        "all 128 partitions: a cut never lengthens the period or removes registers");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Resource and timing estimate is consistent with the widths.\n";
+    } else {
+        std::cout << "\n[FAIL] Resource and timing estimate mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include "bf16_exp2_quad.hpp"
+#include "bf16_dse.hpp"
+#include "test_check.hpp"
+
+typedef bf16_exp_high_accuracy HA;
+typedef bf16_exp_csd_log2e_t<HA, 10> HaCsdFull;                 // Every digit of log2(e)
+typedef bf16_exp_csd_log2e_t<HA, 9, 0x5c551e> HaCsdSearched;    // Fewest bit-identical digits (dse_bf16_csd_log2e)
+typedef bf16_exp_csd_log2e_t<HA, 7> HaCsdTrunc;                 // Truncated recoding
+typedef bf16_exp_csd_log2e_t<bf16_exp_quad, 6> QuadCsd;         // Shared range reduction of another engine
+
+/** @brief Counts the inputs where the ac_fixed and native linear cores of Cfg differ (both bases). */
+template<typename Cfg>
+int ac_native_mismatches() {
+    int mismatches = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        mismatches += bf16_exp_approx<Base::Two, Cfg>(in) != bf16_exp_approx_with(in, [](const FPRaw& parts) {
+            return bf16_exp_core_approx_native<Base::Two, Cfg>(parts);
+        });
+        mismatches += bf16_exp_approx<Base::E, Cfg>(in) != bf16_exp_approx_with(in, [](const FPRaw& parts) {
+            return bf16_exp_core_approx_native<Base::E, Cfg>(parts);
+        });
+    }
+    return mismatches;
+}
+
+int main() {
+    std::cout << "--- Shift-and-Add log2(e) Multiplier Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. CSD recoding: exact, non-adjacent, top digits first
+    std::mt19937_64 rng(22);
+    bool recoded = true;
+    for (int s = 0; s < 100000; ++s) {
+        const uint64_t c = rng() & bf16_native::ones<uint64_t>(40);
+        const bf16_csd_t csd = bf16_csd_encode(c);
+        const uint64_t digits = csd.pos | csd.neg;
+        recoded &= csd.value() == c && (csd.pos & csd.neg) == 0 && (digits & (digits >> 1)) == 0 &&
+                   csd.digits == __builtin_popcountll(digits) && csd.digits <= __builtin_popcountll(c);
+    }
+    all_passed &= check(recoded, "CSD recoding is exact, non-adjacent and never has more digits than binary");
+    const bf16_csd_t full = bf16_csd_encode(HA::LOG2E_BITS);
+    const bf16_csd_t top3 = bf16_csd_encode(HA::LOG2E_BITS, 3);
+    all_passed &= check(full.digits == 10 && __builtin_popcountll(HA::LOG2E_BITS) == 12 && top3.digits == 3 &&
+                        top3.value() == 0x5c0000, "committed log2(e): 10 CSD digits (12 ones), top 3 = 0x5c0000");
+
+    // 2. Every digit kept: the shift-and-add is the general multiplier
+    int differ = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        differ += bf16_exp_approx<Base::E, HaCsdFull>(in) != bf16_exp_approx<Base::E>(in);
+        differ += bf16_exp_approx<Base::E, HaCsdSearched>(in) != bf16_exp_approx<Base::E>(in);
+        differ += bf16_exp_approx<Base::Two, HaCsdSearched>(in) != bf16_exp_approx<Base::Two>(in);
+    }
+    all_passed &= check(differ == 0, "10 digits of log2(e), and 9 digits of 0x5c551e, == general multiplier (all inputs)");
+
+    // 3. HLS and native models agree bit for bit
+    all_passed &= check(ac_native_mismatches<HaCsdFull>() == 0 && ac_native_mismatches<HaCsdSearched>() == 0 &&
+                        ac_native_mismatches<HaCsdTrunc>() == 0,
+                        "ac_fixed and native shift-and-add cores are bit-identical (3 recodings, 2^x, e^x, all inputs)");
+    int quad_mismatches = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        quad_mismatches += bf16_exp_quad_approx<Base::E, QuadCsd>(in) != bf16_exp_approx_with(in, [](const FPRaw& parts) {
+            return bf16_exp_quad_core_approx_native<Base::E, QuadCsd>(parts);
+        });
+    }
+    all_passed &= check(quad_mismatches == 0, "shared range reduction: quadratic engine with 6 digits, ac_fixed == native");
+
+    // 4. Search: fewest digits, bit-identical or within a budget
+    DseReferences refs;
+    const DseCsdPoint trunc = bf16_dse_evaluate_csd<HaCsdTrunc, HA>(refs, 0);
+    all_passed &= check(trunc.digits == 7 && trunc.adders == 6 && trunc.log2e_bits == 0x5c5500 && trunc.mismatches > 0 &&
+                        trunc.expe_max_ulp > 0.5, "7 truncated digits change e^x");
+    const std::vector<DseCsdPoint> searched = bf16_dse_csd_search<HA>(64, refs, 0);
+    all_passed &= check(!searched.empty() && searched[0].digits == 9 && searched[0].log2e_bits == 0x5c551e &&
+                        searched[0].mismatches == 0 && searched[0].expe_max_ulp <= 0.5,
+                        "search: 0x5c551e keeps e^x bit-identical with 9 digits (8 adders)");
+    bool none_fewer = true;
+    for (const DseCsdPoint& p : searched) none_fewer &= p.digits == 9 || p.mismatches > 0;
+    all_passed &= check(none_fewer && bf16_dse_log2e_probe<HA>::LOG2E_CSD_POS == HA::LOG2E_BITS &&
+                        bf16_dse_log2e_probe<HA>::LOG2E_CSD_NEG == 0,
+                        "no constant within 64 LSBs is bit-identical with 8 digits; probe restored");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Shift-and-add log2(e) multiplier is bit-accurate.\n";
+    } else {
+        std::cout << "\n[FAIL] Shift-and-add log2(e) multiplier mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include "bf16_dse.hpp"
+#include "test_check.hpp"
+
+// A configuration whose CALC_W needs the 128-bit carrier
+typedef bf16_exp_cfg_t<6, 20, 30> WideCfg;
+static_assert(WideCfg::CALC_W > 64, "WideCfg must exercise the __int128 carrier");
+
+DsePoint make_point(double max_ulp, double mean_ulp, uint64_t rom_bits, int coeff_w) {
+    DsePoint p = {};
+    p.exp2_max_ulp = max_ulp;
+    p.expe_max_ulp = max_ulp;
+    p.mean_ulp = mean_ulp;
+    p.rom_bits = rom_bits;
+    p.coeff_w = coeff_w;
+    p.in_w = 39;
+    p.mant_src_w = 8;
+    p.log2e_w = 23;
+    return p;
+}
+
+int main() {
+    std::cout << "--- Datapath Width Policy / DSE Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. The default policy is the committed datapath
+    all_passed &= check(bf16_exp_cfg::LOG2E_BITS == bf16_exp2_packed::log2e_int_val.to_uint64(),
+                        "policy log2(e) == packed log2e_int_val");
+    all_passed &= check(bf16_exp_cfg::COEFF_W == bf16_exp2_packed::COEFF_W && bf16_exp_cfg::LUT_SIZE == bf16_exp2_packed::LUT_SIZE,
+                        "policy widths == packed header widths");
+
+    int mismatches = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        uint16_t with = bf16_exp_approx_with(static_cast<uint16_t>(raw), [](const FPRaw& parts) {
+            return bf16_exp_core_approx_native<Base::E, bf16_exp_cfg>(parts, bf16_exp2_packed::coeffs_u64);
+        });
+        if (with != bf16_exp_approx<Base::E>(static_cast<uint16_t>(raw))) mismatches++;
+    }
+    all_passed &= check(mismatches == 0, "bf16_exp_approx_with + native policy core == bf16_exp_approx (e^x, all inputs)");
+
+    // 2. Both datapath variants in one binary, picked per call site
+    all_passed &= check(bf16_exp_low_area::LOG2E_BITS == bf16_exp2_low_area_packed::log2e_int_val.to_uint64(),
+                        "low-area log2(e) == its header's log2e_int_val");
+    int differ = 0;
+    for (uint32_t raw = 0x8000; raw <= 0xFFFF; ++raw) {
+        differ += bf16_exp_approx<Base::E, bf16_exp_low_area>(static_cast<uint16_t>(raw)) !=
+                  bf16_exp_approx<Base::E>(static_cast<uint16_t>(raw));
+    }
+    all_passed &= check(differ > 0, "low-area and high-accuracy variants are distinct datapaths");
+    UlpHistogram low_exp2 = bf16_dse_exhaustive<Base::Two, bf16_exp_low_area>(bf16_exp_low_area::ROM, nullptr, 0);
+    UlpHistogram low_expe = bf16_dse_exhaustive<Base::E, bf16_exp_low_area>(bf16_exp_low_area::ROM, nullptr, 0);
+    all_passed &= check(low_exp2.max_ulp < 0.502 && low_expe.max_ulp < 0.504, "low-area worst case as documented (0.5010 / 0.5034 ULP)");
+    all_passed &= check(bf16_exp2_config_hash() == bf16_exp2_config_hash<bf16_exp_high_accuracy>() &&
+                        bf16_exp2_config_hash() != bf16_exp2_config_hash<bf16_exp_low_area>(),
+                        "config hash tells the variants apart");
+
+    // 3. A refitted wide configuration: exhaustive check agrees with the fit on the core inputs
+    LatticeFitOptions wide_opts;
+    wide_opts.coeff_f = WideCfg::COEFF_F;
+    wide_opts.lut_size = WideCfg::LUT_SIZE;
+    wide_opts.radius = 4;
+    LatticeFitResult wide = bf16_lattice_fit<WideCfg>(wide_opts);
+    all_passed &= check(wide.rom.size() == 64 && wide.score.inputs == 2 * 17 * 128, "wide configuration: 64 entries, all core inputs");
+    all_passed &= check(bf16_lattice_evaluate<WideCfg>(wide.rom.data()).max_ulp == wide.score.max_ulp,
+                        "wide configuration: assembled ROM reproduces the fit");
+    all_passed &= check(wide.score.max_ulp < 0.6, "wide configuration: refit stays near correct rounding");
+
+    UlpHistogram exp2_half = bf16_dse_exhaustive<Base::Two, WideCfg>(wide.rom.data(), nullptr, 0);
+    all_passed &= check(exp2_half.count == 0x8000 && exp2_half.max_ulp >= bf16_lattice_evaluate<WideCfg>(wide.rom.data(), true, false).max_ulp,
+                        "exhaustive half-range check covers the core inputs");
+
+    // 4. Pareto marking
+    std::vector<DsePoint> pts = {
+        make_point(0.50, 0.20, 5376, 21),   // Most accurate
+        make_point(0.50, 0.25, 5376, 21),   // Dominated by the first
+        make_point(0.60, 0.30, 1792, 14),   // Cheapest
+        make_point(0.70, 0.30, 1792, 14),   // Dominated by the third
+        make_point(0.55, 0.22, 3328, 13),   // Trade-off
+    };
+    bf16_dse_mark_pareto(pts);
+    all_passed &= check(pts[0].pareto && !pts[1].pareto && pts[2].pareto && !pts[3].pareto && pts[4].pareto,
+                        "Pareto front marks exactly the non-dominated points");
+    all_passed &= check(!bf16_dse_dominates(pts[0], pts[0]), "a point does not dominate itself");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Width policy and design-space exploration are consistent.\n";
+    } else {
+        std::cout << "\n[FAIL] Width policy / DSE mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+#ifndef TEST_EXP_ENGINE_HPP
+#define TEST_EXP_ENGINE_HPP
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include "test_check.hpp"
+#include "bf16_dse.hpp"
+
+/**
+ * @brief Checks shared by the alternative exp engines (quadratic, multipartite, non-uniform).
+ * * An engine is described by an adaptor with two static templates:
+ *   template<Base B> static uint16_t hls(uint16_t raw)       full routing with the ac_fixed core
+ *   template<Base B> static FPRaw native(const FPRaw& parts)  native integer core
+ * References are callables ref(BaseTag<B>(), raw) returning the expected raw BF16 result.
+ */
+template<Base B>
+using BaseTag = std::integral_constant<Base, B>;
+
+/** @brief Number of (input, base) pairs, over all 65,536 inputs and both bases, where the engine differs from ref. */
+template<typename Engine, typename Ref>
+inline int engine_mismatches(Ref ref) {
+    int mismatches = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        mismatches += Engine::template hls<Base::Two>(in) != ref(BaseTag<Base::Two>(), in);
+        mismatches += Engine::template hls<Base::E>(in) != ref(BaseTag<Base::E>(), in);
+    }
+    return mismatches;
+}
+
+/** @brief Reference: the engine's native core behind the same special-case routing. */
+template<typename Engine>
+inline int engine_native_mismatches() {
+    return engine_mismatches<Engine>([](auto base, uint16_t in) {
+        constexpr Base B = decltype(base)::value;
+        return bf16_exp_approx_with(in, [](const FPRaw& parts) { return Engine::template native<B>(parts); });
+    });
+}
+
+/** @brief Reference: the committed linear high-accuracy datapath. */
+template<typename Engine>
+inline int engine_linear_mismatches() {
+    return engine_mismatches<Engine>([](auto base, uint16_t in) { return bf16_exp_approx<decltype(base)::value>(in); });
+}
+
+/** @brief True if the native core is correctly rounded (max <= 0.5 ULP) on the negative half, both bases. */
+template<typename Engine>
+inline bool engine_correctly_rounded() {
+    const UlpHistogram exp2_half = bf16_dse_exhaustive_with<Base::Two>([](const FPRaw& parts) {
+        return Engine::template native<Base::Two>(parts);
+    }, nullptr, 0);
+    const UlpHistogram expe_half = bf16_dse_exhaustive_with<Base::E>([](const FPRaw& parts) {
+        return Engine::template native<Base::E>(parts);
+    }, nullptr, 0);
+    return exp2_half.count == 0x8000 && expe_half.count == 0x8000 && exp2_half.max_ulp <= 0.5 && expe_half.max_ulp <= 0.5;
+}
+
+/** @brief ac_fixed vs native core on every input and both bases, then exhaustive accuracy. */
+template<typename Engine>
+inline bool check_engine_cores(const std::string& name) {
+    bool passed = check(engine_native_mismatches<Engine>() == 0,
+                        "ac_fixed and native " + name + " cores are bit-identical (2^x, e^x, all inputs)");
+    passed &= check(engine_correctly_rounded<Engine>(), "negative half range correctly rounded (max <= 0.5 ULP)");
+    return passed;
+}
+
+#endif // TEST_EXP_ENGINE_HPP
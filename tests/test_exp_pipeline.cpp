@@ -0,0 +1,99 @@
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <random>
+#include "bf16_exp2_pipeline.hpp"
+#include "test_check.hpp"
+
+typedef bf16_exp_rounding_t<bf16_exp_high_accuracy, bf16_round_stochastic<bf16_lfsr16>> HaSr16;
+
+/** @brief Streams every input through a partition with random handshakes; counts outputs differing from bf16_exp_approx. */
+template<Base B, typename Cfg>
+int stream_mismatches(uint32_t cuts, double valid_p, double ready_p, uint64_t seed, ExpPipeStats* stats = nullptr) {
+    std::vector<uint16_t> in(0x10000), out(0x10000, 0), expected(0x10000);
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) in[raw] = static_cast<uint16_t>(raw);
+
+    if constexpr (Cfg::Rounding::MODE == RoundMode::Stochastic) Cfg::Rounding::Source::seed(seed);
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) expected[raw] = bf16_exp_approx<B, Cfg>(in[raw]);
+
+    std::mt19937_64 rng(seed);
+    std::bernoulli_distribution valid(valid_p), ready(ready_p);
+    ExpPipeOptions opts;
+    opts.cuts = cuts;
+    if constexpr (Cfg::Rounding::MODE == RoundMode::Stochastic) Cfg::Rounding::Source::seed(seed);
+    ExpPipeStats s = bf16_exp_pipeline_stream<B, Cfg>(in.data(), in.size(), out.data(), opts,
+                                                      [&](uint64_t) { return valid(rng); }, [&](uint64_t) { return ready(rng); });
+    if (stats) *stats = s;
+
+    int mismatches = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) mismatches += out[raw] != expected[raw];
+    return mismatches + static_cast<int>(0x10000 - s.emitted);
+}
+
+int main() {
+    std::cout << "--- Pipelined exp Unit Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. Partitions
+    Bf16ExpPipeline<Base::Two> full, single(ExpPipeOptions{EXP_PIPE_CUTS_NONE}), four(ExpPipeOptions{EXP_PIPE_CUTS_4});
+    all_passed &= check(full.stages() == EXP_PIPE_OPS && single.stages() == 1 && four.stages() == 4 &&
+                        four.stage_of(ExpPipeOp::Reduce) == 0 && four.stage_of(ExpPipeOp::LutFetch) == 1 &&
+                        four.stage_of(ExpPipeOp::Normalize) == 2 && four.stage_of(ExpPipeOp::Recompose) == 3 &&
+                        four.latency() == 4 && four.initiation_interval() == 1,
+                        "stage boundaries: 8, 1 and 4 stages, operations mapped to their stage");
+
+    // 2. Bit-identical to the functional model under back-pressure
+    int mismatches = 0;
+    for (uint32_t cuts : {EXP_PIPE_CUTS_NONE, EXP_PIPE_CUTS_2, EXP_PIPE_CUTS_3, EXP_PIPE_CUTS_4, EXP_PIPE_CUTS_ALL}) {
+        mismatches += stream_mismatches<Base::Two, bf16_exp_high_accuracy>(cuts, 0.7, 0.6, cuts + 1);
+        mismatches += stream_mismatches<Base::E, bf16_exp_high_accuracy>(cuts, 0.9, 0.5, cuts + 2);
+    }
+    mismatches += stream_mismatches<Base::E, bf16_exp_low_area>(EXP_PIPE_CUTS_3, 1.0, 0.8, 7);
+    all_passed &= check(mismatches == 0, "5 partitions, random valid/ready: results == bf16_exp_approx (2^x, e^x, all inputs)");
+    all_passed &= check(stream_mismatches<Base::Two, HaSr16>(EXP_PIPE_CUTS_ALL, 0.8, 0.5, 24) == 0,
+                        "stochastic rounding: same LFSR sequence as the functional model");
+
+    // 3. Free-flowing stream: latency = stages, II = 1, one result per cycle after the fill
+    ExpPipeStats s;
+    all_passed &= check(stream_mismatches<Base::Two, bf16_exp_high_accuracy>(EXP_PIPE_CUTS_ALL, 1.0, 1.0, 1, &s) == 0 &&
+                        s.min_latency == 8 && s.max_latency == 8 && s.measured_ii() == 1.0 &&
+                        s.cycles == 0x10000 + 8 && s.input_stalls == 0 && s.output_stalls == 0,
+                        "no stalls: latency 8, II 1, 65536 results in 65544 cycles");
+
+    // 4. Sink stalls: the pipeline fills, then back-pressures the input
+    Bf16ExpPipeline<Base::E> pipe(ExpPipeOptions{EXP_PIPE_CUTS_4});
+    int accepted = 0;
+    bool emitted = false;
+    for (int c = 0; c < 10; ++c) {
+        ExpPipeCycle io = pipe.cycle(true, 0xBF80, false);
+        accepted += io.accepted;
+        emitted |= io.emitted;
+    }
+    const bool full_stall = accepted == 4 && !emitted && pipe.in_flight() == 4 && pipe.stats().input_stalls == 6 &&
+                            pipe.stats().output_stalls == 6 && pipe.stage_register(3)->output == bf16_exp_approx<Base::E>(0xBF80);
+    ExpPipeCycle drain = pipe.cycle(false, 0, true);
+    all_passed &= check(full_stall && drain.emitted && drain.output == bf16_exp_approx<Base::E>(0xBF80) && pipe.in_flight() == 3,
+                        "stalled sink: 4 tokens fill 4 stages, input stalls, results held in the output register");
+
+    // 5. Multi-cycle unit: a 2-cycle multiplier halves the throughput
+    ExpPipeOptions slow;
+    slow.cuts = EXP_PIPE_CUTS_4;
+    slow.op_cycles[static_cast<int>(ExpPipeOp::Multiply)] = 2;
+    std::vector<uint16_t> in(1000), out(1000);
+    for (size_t i = 0; i < in.size(); ++i) in[i] = static_cast<uint16_t>(0xBC00 + i);
+    ExpPipeStats ss = bf16_exp_pipeline_stream<Base::Two>(in.data(), in.size(), out.data(), slow);
+    bool same = true;
+    for (size_t i = 0; i < in.size(); ++i) same &= out[i] == bf16_exp_approx<Base::Two>(in[i]);
+    all_passed &= check(same && Bf16ExpPipeline<Base::Two>(slow).initiation_interval() == 2 && ss.measured_ii() > 1.99 &&
+                        ss.measured_ii() <= 2.0 && ss.min_latency == 5 && ss.max_latency == 6 &&
+                        ss.throughput() > 0.49 && ss.throughput() < 0.5 && ss.occupancy() > 0.7 && ss.occupancy() < 0.75,
+                        "2-cycle multiplier: II 2, latency 5 (6 waiting for it), half throughput, 3/4 occupancy");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Pipelined exp unit is cycle- and bit-accurate.\n";
+    } else {
+        std::cout << "\n[FAIL] Pipelined exp unit mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+#include <iostream>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <random>
+#include "fp_utils.hpp"
+#include "fp_convert.hpp"
+#include "test_check.hpp"
+
+template<typename T>
+bool same_bits(const std::vector<T>& a, const std::vector<T>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+}
+
+// Value equality with NaN == NaN (fp_to_double returns the canonical NaN)
+bool same_value(double a, double b) {
+    return (std::isnan(a) && std::isnan(b)) || (a == b && std::signbit(a) == std::signbit(b));
+}
+
+int main() {
+    std::cout << "--- BF16 <-> FP32/FP64 Batch Conversion Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // All BF16 patterns, odd length for the scalar tail
+    const size_t N = 0x10000 + 5;
+    std::vector<uint16_t> bf16(N);
+    for (size_t i = 0; i < N; ++i) bf16[i] = static_cast<uint16_t>(i);
+
+    // 1. Widening: exact, matches fp_to_double and keeps NaN bits
+    std::vector<float> f_batch(N), f_scalar(N);
+    std::vector<double> d_batch(N), d_scalar(N);
+    bf16_to_float_batch(bf16.data(), f_batch.data(), N);
+    bf16_to_double_batch(bf16.data(), d_batch.data(), N);
+    fp_convert_detail::bf16_to_float_scalar(bf16.data(), f_scalar.data(), N);
+    fp_convert_detail::bf16_to_double_scalar(bf16.data(), d_scalar.data(), N);
+    all_passed &= check(same_bits(f_batch, f_scalar), "bf16_to_float_batch == scalar (bitwise)");
+    all_passed &= check(same_bits(d_batch, d_scalar), "bf16_to_double_batch == scalar (bitwise)");
+
+    int mismatches = 0;
+    for (size_t i = 0; i < N; ++i) {
+        uint32_t fbits;
+        std::memcpy(&fbits, &f_batch[i], sizeof(fbits));
+        if (fbits != static_cast<uint32_t>(bf16[i]) << 16) mismatches++;
+        if (!same_value(d_batch[i], fp_to_double(bf16[i], FPType::BF16))) mismatches++;
+    }
+    all_passed &= check(mismatches == 0, "widening is exact and matches fp_to_double (incl. subnormals)");
+
+    std::vector<double> d_fp(N);
+    fp_to_double_batch(bf16.data(), d_fp.data(), N, FPType::BF16);
+    all_passed &= check(same_bits(d_fp, d_batch), "fp_to_double_batch (BF16) uses the widening kernel");
+
+    // 2. Narrowing: all widened patterns round-trip (NaN -> canonical qNaN)
+    std::vector<uint16_t> back(N);
+    float_to_bf16_batch(f_batch.data(), back.data(), N);
+    mismatches = 0;
+    for (size_t i = 0; i < N; ++i) {
+        bool nan = fp_classify(bf16[i], FPType::BF16).is_nan;
+        if (back[i] != (nan ? BF16_CANONICAL_QNAN : bf16[i])) mismatches++;
+    }
+    all_passed &= check(mismatches == 0, "float_to_bf16_batch round trip");
+
+    // 3. Narrowing RNE on arbitrary FP32 patterns, SIMD vs scalar reference
+    std::mt19937 rng(7);
+    std::vector<float> f_rand(1 << 20);
+    for (auto& f : f_rand) {
+        uint32_t bits = rng();
+        // Bias towards exact ties and round-up carries into the exponent
+        if ((bits & 7) == 0) bits = (bits & 0xFFFF0000u) | 0x8000u;
+        if ((bits & 7) == 1) bits |= 0x007FFFFFu;
+        std::memcpy(&f, &bits, sizeof(f));
+    }
+    std::vector<uint16_t> n_batch(f_rand.size()), n_scalar(f_rand.size());
+    float_to_bf16_batch(f_rand.data(), n_batch.data(), f_rand.size());
+    fp_convert_detail::float_to_bf16_scalar(f_rand.data(), n_scalar.data(), f_rand.size());
+    all_passed &= check(n_batch == n_scalar, "float_to_bf16_batch == scalar on 2^20 random FP32 patterns");
+
+    // Spot checks: ties to even, overflow to Inf, NaN
+    all_passed &= check(float_to_bf16_rne(bf16_to_float(0x3F80) + std::ldexp(1.0f, -8)) == 0x3F80, "tie rounds to even (down)");
+    all_passed &= check(float_to_bf16_rne(bf16_to_float(0x3F81) + std::ldexp(1.0f, -8)) == 0x3F82, "tie rounds to even (up)");
+    all_passed &= check(float_to_bf16_rne(3.4e38f) == 0x7F80, "overflow rounds to +Inf");
+    all_passed &= check(double_to_bf16_rne(std::nan("")) == BF16_CANONICAL_QNAN, "NaN -> canonical qNaN");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Batch conversions are bit-exact.\n";
+    } else {
+        std::cout << "\n[FAIL] Batch conversion mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
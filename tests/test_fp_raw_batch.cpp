@@ -0,0 +1,100 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdint>
+#include "fp_utils.hpp"
+#include "fp_raw_batch.hpp"
+#include "test_check.hpp"
+
+bool same_raw(const FPRaw& a, const FPRaw& b) {
+    return a.sign == b.sign && a.exponent == b.exponent && a.mantissa == b.mantissa &&
+           a.hidden_bit == b.hidden_bit && a.status.is_zero == b.status.is_zero &&
+           a.status.is_denormal == b.status.is_denormal && a.status.is_inf == b.status.is_inf &&
+           a.status.is_nan == b.status.is_nan;
+}
+
+int main() {
+    std::cout << "--- FPRawBatch (SoA) Decompose/Recompose Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // All BF16 patterns; odd length exercises the partial sign word
+    const size_t N = 0x10000 + 3;
+    std::vector<uint16_t> raw(N);
+    for (size_t i = 0; i < N; ++i) raw[i] = static_cast<uint16_t>(i * 40503u);
+    for (size_t i = 0; i < 0x10000; ++i) raw[i] = static_cast<uint16_t>(i);
+
+    FPRawBatch batch;
+    fp_decompose_batch<FPType::BF16>(raw.data(), N, batch);
+
+    all_passed &= check(batch.size() == N, "batch size");
+    all_passed &= check(reinterpret_cast<uintptr_t>(batch.exponent.data()) % 64 == 0 &&
+                        reinterpret_cast<uintptr_t>(batch.mantissa.data()) % 64 == 0 &&
+                        reinterpret_cast<uintptr_t>(batch.status.data()) % 64 == 0 &&
+                        reinterpret_cast<uintptr_t>(batch.sign.data()) % 64 == 0, "arrays are cache-line aligned");
+
+    // 1. Decompose matches the scalar path element by element
+    int mismatches = 0;
+    for (size_t i = 0; i < N; ++i) {
+        if (!same_raw(batch.get(i), fp_decompose(raw[i], FPType::BF16))) mismatches++;
+    }
+    all_passed &= check(mismatches == 0, "fp_decompose_batch == fp_decompose (all patterns)");
+
+    // 2. Recompose round trip
+    std::vector<uint16_t> back(N);
+    fp_recompose_batch<FPType::BF16>(batch, back.data());
+    all_passed &= check(back == raw, "fp_recompose_batch round trip (all patterns)");
+
+    // Generic (non-AVX2) build of the block loops gives the same arrays
+    FPRawBatch generic(N);
+    std::vector<uint16_t> generic_back(N);
+    fp_batch_detail::decompose_range<FPType::BF16>(raw.data(), N, generic);
+    fp_batch_detail::recompose_range<FPType::BF16>(generic, generic_back.data());
+    all_passed &= check(generic.sign == batch.sign && generic.exponent == batch.exponent &&
+                        generic.mantissa == batch.mantissa && generic.status == batch.status &&
+                        generic_back == raw, "generic build == dispatched build");
+
+    // 3. Recompose matches the scalar path on synthetic records (priority + saturation)
+    FPRawBatch synth;
+    std::vector<FPRaw> records;
+    for (int s = 0; s < 2; ++s) {
+        for (int kind = 0; kind < 5; ++kind) {
+            for (int e = -200; e <= 200; e += 3) {
+                for (uint32_t m = 0; m < 0x80; m += 9) {
+                    FPRaw r = {};
+                    r.sign = s;
+                    r.exponent = e;
+                    r.mantissa = m;
+                    r.hidden_bit = 1;
+                    r.status.is_zero = (kind == 1);
+                    r.status.is_inf = (kind == 2);
+                    r.status.is_nan = (kind == 3);
+                    r.status.is_denormal = (kind == 4);
+                    records.push_back(r);
+                }
+            }
+        }
+    }
+    synth.resize(records.size());
+    for (size_t i = 0; i < records.size(); ++i) synth.set(i, records[i]);
+
+    std::vector<uint32_t> synth_bits(records.size());
+    fp_recompose_batch(synth, synth_bits.data(), FPType::BF16);
+    mismatches = 0;
+    for (size_t i = 0; i < records.size(); ++i) {
+        if (synth_bits[i] != fp_recompose(records[i], FPType::BF16)) mismatches++;
+    }
+    all_passed &= check(mismatches == 0, "fp_recompose_batch == fp_recompose (synthetic records)");
+
+    // 4. Footprint
+    size_t soa_bytes = N / 8 + N * (sizeof(int16_t) + sizeof(uint32_t) + sizeof(uint8_t));
+    std::cout << "  SoA footprint: " << std::fixed << std::setprecision(2) << double(soa_bytes) / N
+              << " B/element vs sizeof(FPRaw) = " << sizeof(FPRaw) << " B\n";
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] FPRawBatch matches the scalar FPRaw path.\n";
+    } else {
+        std::cout << "\n[FAIL] FPRawBatch differs from the scalar FPRaw path.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
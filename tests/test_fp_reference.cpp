@@ -0,0 +1,101 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cmath>
+#include <cstdint>
+#include "fp_utils.hpp"
+#include "fp_reference.hpp"
+#include "golden_io.hpp"
+#include "ulp_analysis.hpp"
+#include "test_check.hpp"
+
+int main(int argc, char** argv) {
+    std::cout << "--- Correctly Rounded Reference Test ---\n" << std::endl;
+    bool all_passed = true;
+    constexpr FPType BF16 = FPType::BF16;
+
+    // 1. Every finite BF16 value rounds to itself with a zero residual
+    int mismatches = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        FPStatus s = fp_classify(raw, BF16);
+        if (s.is_nan) continue;
+        FPReferenceEntry e = fp_round_reference<BF16>(fp_to_double(raw, BF16));
+        uint32_t expected = s.is_zero ? (raw & 0x8000) : raw;
+        if (e.result != expected || e.residual != 0.0f || e.hard) mismatches++;
+    }
+    all_passed &= check(mismatches == 0, "BF16 values are fixed points");
+
+    // 2. Midpoints tie to even (exact), points just off a midpoint round to the nearer side
+    mismatches = 0;
+    for (uint32_t raw = 0; raw < 0x7F7F; ++raw) {
+        long double lo = fp_to_double(raw, BF16);
+        long double hi = fp_to_double(raw + 1, BF16);
+        long double mid = (lo + hi) / 2;
+        uint32_t even = (raw & 1) ? raw + 1 : raw;
+        if (fp_round_reference<BF16>(mid, true).result != even) mismatches++;
+        if (!fp_round_reference<BF16>(mid).hard) mismatches++;
+        long double off = (hi - lo) / 1024;
+        if (fp_round_reference<BF16>(mid - off).result != raw) mismatches++;
+        if (fp_round_reference<BF16>(mid + off).result != raw + 1) mismatches++;
+        if (fp_round_reference<BF16>(-(mid + off)).result != ((raw + 1) | 0x8000)) mismatches++;
+    }
+    all_passed &= check(mismatches == 0, "RNE ties, near-midpoint rounding, sign, subnormals, binade carries");
+
+    // 3. Residual recovers the extended value
+    mismatches = 0;
+    for (long double v : {1.0L / 3.0L, -2.718281828459045235L, 0x1.fffp-130L, 1e-45L, 3.3e38L}) {
+        FPReferenceEntry e = fp_round_reference<BF16>(v);
+        double back = fp_reference_value(e.result, e.residual, BF16);
+        if (std::fabs(back - static_cast<double>(v)) > std::fabs(static_cast<double>(v)) * 1e-7) mismatches++;
+    }
+    all_passed &= check(mismatches == 0, "result + residual == value");
+
+    FPReferenceEntry big = fp_round_reference<BF16>(0x1.ffp127L);
+    all_passed &= check(big.result == 0x7F80 && std::isinf(fp_reference_value(big.result, big.residual, BF16)),
+                        "overflow rounds to Inf");
+    all_passed &= check(fp_round_reference<BF16>(NAN).result == 0x7FC0, "NaN -> canonical qNaN");
+
+    // 4. Table-driven ULP analysis matches the recomputing one
+    std::vector<uint16_t> results(0x10000);
+    std::vector<float> residuals(0x10000);
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        long double x = fp_to_double(raw, BF16);
+        FPReferenceEntry e = fp_round_reference<BF16>(std::exp2(x), std::isfinite(x) && std::nearbyint(x) == x);
+        results[raw] = static_cast<uint16_t>(e.result);
+        residuals[raw] = e.residual;
+    }
+    GoldenInfo info;
+    info.format = GoldenFormat::Reference;
+    info.function = GoldenFunction::Exp;
+    info.base = GoldenBase::Two;
+    const std::string dir = scratch_dir(argc, argv);
+    const std::string path = dir + "/test_fp_reference_exp2.bin";
+    GoldenFile table;
+    bool written = golden_write_binary(path, info, results.data(), residuals.data(), results.size()) && table.open(path);
+    all_passed &= check(written, "reference table written and mapped");
+
+    // Outputs: the correctly rounded result, nudged by one ULP for every 5th input
+    std::vector<uint16_t> outputs(results.begin() + 0x8000, results.end());
+    for (size_t i = 0; i < outputs.size(); i += 5) {
+        if (!fp_classify(outputs[i], BF16).is_nan && outputs[i] != 0x7F80) outputs[i]++;
+    }
+    UlpReport from_table;
+    bool analyzed = written && ulp_analyze_reference(outputs.data(), outputs.size(), 0x8000, table, from_table);
+    UlpReport recomputed = ulp_analyze(outputs.data(), outputs.size(), 0x8000, [](double x) { return std::exp2(x); });
+    all_passed &= check(analyzed && from_table.text == recomputed.text, "ulp_analyze_reference == ulp_analyze (text report)");
+    all_passed &= check(analyzed && std::fabs(from_table.total.max_ulp - recomputed.total.max_ulp) < 1e-6, "same max ULP");
+
+    UlpReport unused;
+    all_passed &= check(!ulp_analyze_reference(outputs.data(), 10, 0xFFFF, table, unused), "range outside the table is rejected");
+    table.close();
+    std::remove(path.c_str());
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Reference rounding and table lookup are correct.\n";
+    } else {
+        std::cout << "\n[FAIL] Reference rounding or table lookup mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <cstdint>
+#include "fp_sweep.hpp"
+#include "test_check.hpp"
+
+/** @brief Example statistics: count and order-sensitive checksum of visited patterns. */
+struct VisitStats {
+    uint64_t count = 0;
+    uint64_t checksum = 0;
+    void merge(const VisitStats& other) {
+        count += other.count;
+        checksum = checksum * 0x100000001B3ull + other.checksum;
+    }
+};
+
+// Fails every 1000th pattern
+void visit(uint64_t bits, SweepShard<VisitStats>& shard) {
+    shard.stats.count++;
+    shard.stats.checksum += bits;
+    if (bits % 1000 == 0) shard.fail(bits, 0, 1);
+}
+
+int main() {
+    std::cout << "--- Sweep Engine Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // Range straddling 2^32 exercises 64-bit pattern handling
+    const uint64_t BEGIN = (1ull << 32) - 50000;
+    const uint64_t END = (1ull << 32) + 50000;
+
+    SweepOptions single;
+    single.num_threads = 1;
+    single.chunk_size = 1024;
+    SweepOptions multi = single;
+    multi.num_threads = 8;
+
+    SweepResult<VisitStats> r1 = fp_sweep<VisitStats>(BEGIN, END, visit, single);
+    SweepResult<VisitStats> r8 = fp_sweep<VisitStats>(BEGIN, END, visit, multi);
+
+    all_passed &= check(r1.checked == END - BEGIN && r8.checked == END - BEGIN, "Every pattern visited once");
+    all_passed &= check(r1.stats.count == r8.stats.count && r1.stats.checksum == r8.stats.checksum,
+                        "Statistics merge is independent of thread count");
+    all_passed &= check(r1.failures == 100 && r8.failures == 100, "All failures found");
+
+    bool ordered = r8.mismatches.size() == 100;
+    for (size_t k = 1; k < r8.mismatches.size(); ++k) ordered &= r8.mismatches[k - 1].input < r8.mismatches[k].input;
+    all_passed &= check(ordered, "Mismatches merged in input order");
+
+    // Early stop must report exactly the first N failures
+    multi.max_failures = 7;
+    SweepResult<VisitStats> rs = fp_sweep<VisitStats>(BEGIN, END, visit, multi);
+    bool first_n = rs.mismatches.size() == 7;
+    uint64_t expected = ((BEGIN + 999) / 1000) * 1000;
+    for (size_t k = 0; first_n && k < rs.mismatches.size(); ++k, expected += 1000) {
+        first_n = (rs.mismatches[k].input == expected);
+    }
+    all_passed &= check(first_n && rs.stopped_early, "Early stop keeps the first N failures");
+
+    // Stats of an early stop cover the same chunks whatever the thread count
+    single.max_failures = 7;
+    SweepResult<VisitStats> rs1 = fp_sweep<VisitStats>(BEGIN, END, visit, single);
+    bool same = true;
+    for (int rep = 0; rep < 20; ++rep) {
+        SweepResult<VisitStats> r = fp_sweep<VisitStats>(BEGIN, END, visit, multi);
+        same &= r.stats.count == rs1.stats.count && r.stats.checksum == rs1.stats.checksum &&
+                r.checked == rs1.checked && r.failures == rs1.failures;
+    }
+    all_passed &= check(same && rs1.checked == rs1.stats.count && rs1.checked < END - BEGIN,
+                        "Early stop: stats, checked and failures independent of thread count");
+
+    // Parallel map
+    std::vector<uint8_t> seen(70000, 0);
+    fp_sweep_for_each(0, seen.size(), [&](uint64_t bits) { seen[bits]++; }, multi);
+    bool once = true;
+    for (uint8_t v : seen) once &= (v == 1);
+    all_passed &= check(once, "fp_sweep_for_each visits every pattern exactly once");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Sweep engine tests passed.\n";
+    } else {
+        std::cout << "\n[FAIL] Sweep engine tests failed.\n";
+    }
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include "golden_io.hpp"
+#include "test_check.hpp"
+
+std::string read_all(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+int main(int argc, char** argv) {
+    std::cout << "--- Golden Reference I/O Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    const std::string dir = scratch_dir(argc, argv);
+    const std::string bin_path = dir + "/test_golden_io.bin";
+    const std::string txt_path = dir + "/test_golden_io.txt";
+    const std::string txt2_path = dir + "/test_golden_io_2.txt";
+
+    // Synthetic ULP report over the negative half of BF16
+    const uint64_t FIRST = 0x8000;
+    const uint64_t COUNT = 0x8000;
+    std::vector<uint16_t> results(COUNT);
+    std::vector<float> values(COUNT);
+    for (uint64_t i = 0; i < COUNT; ++i) {
+        results[i] = static_cast<uint16_t>((i * 2654435761u) >> 7);
+        values[i] = static_cast<float>(i % 10000) / 10000.0f;
+    }
+    values[5] = std::numeric_limits<float>::quiet_NaN();
+    values[6] = std::numeric_limits<float>::infinity();
+
+    GoldenInfo info;
+    info.format = GoldenFormat::UlpReport;
+    info.function = GoldenFunction::Exp;
+    info.base = GoldenBase::E;
+    info.first_input = FIRST;
+    info.config_hash = 0x0123456789ABCDEFull;
+
+    std::string error;
+    all_passed &= check(golden_write_binary(bin_path, info, results.data(), values.data(), COUNT, &error),
+                        "write binary");
+    all_passed &= check(golden_is_binary(bin_path), "binary magic detected");
+
+    // 1. Binary read back through mmap
+    GoldenFile bin;
+    all_passed &= check(bin.open(bin_path, &error) && bin.is_mapped(), "open binary (mmap)");
+    all_passed &= check(bin.format() == GoldenFormat::UlpReport && bin.function() == GoldenFunction::Exp &&
+                        bin.base() == GoldenBase::E && bin.config_hash() == info.config_hash,
+                        "header metadata round trip");
+    all_passed &= check(bin.first_input() == FIRST && bin.count() == COUNT && bin.has_values(), "header geometry");
+    all_passed &= check(reinterpret_cast<uintptr_t>(bin.values()) % golden_io::PAYLOAD_ALIGN == 0,
+                        "values array is aligned");
+
+    bool same = true;
+    for (uint64_t i = 0; i < COUNT; ++i) {
+        float v = bin.value(FIRST + i);
+        same &= (bin.result(FIRST + i) == results[i]);
+        same &= (std::isnan(values[i]) ? std::isnan(v) : v == values[i]);
+    }
+    all_passed &= check(same, "payload round trip");
+    all_passed &= check(bin.contains(FIRST) && bin.contains(FIRST + COUNT - 1) &&
+                        !bin.contains(FIRST - 1) && !bin.contains(FIRST + COUNT), "contains() bounds");
+
+    // 2. Text round trip: binary -> text -> parsed -> text is byte-identical
+    all_passed &= check(golden_write_text(txt_path, bin, true, &error), "write text");
+    GoldenFile txt;
+    all_passed &= check(txt.open(txt_path, &error) && !txt.is_mapped(), "open text");
+    all_passed &= check(txt.format() == GoldenFormat::UlpReport && txt.first_input() == FIRST &&
+                        txt.count() == COUNT, "text format inferred from columns");
+    all_passed &= check(golden_write_text(txt2_path, txt, true, &error) && read_all(txt_path) == read_all(txt2_path),
+                        "text round trip is byte-identical");
+
+    // 3. Moving a mapped table keeps the view valid
+    GoldenFile moved(std::move(bin));
+    all_passed &= check(moved.is_mapped() && !bin.is_mapped() && moved.result(FIRST + 1) == results[1],
+                        "move keeps mapping");
+
+    // 4. Malformed inputs are rejected
+    {
+        std::ofstream f(txt2_path);
+        f << "8000 3F80\n8002 3F80\n";
+    }
+    GoldenFile bad;
+    all_passed &= check(!bad.open(txt2_path, &error), "non-dense text rejected");
+
+    bool malformed = true;
+    for (const char* line : {"8000 3G80", "8000 13F80", "8000 -1", "xyz 3F80", "1FFFFFFFFFFFFFFFFF 3F80",
+                             "8000 3F80 1.5x", "8000 3F80 1e99"}) {
+        {
+            std::ofstream f(txt2_path, std::ios::trunc);
+            f << "// header\n" << line << "\n";
+        }
+        error.clear();
+        malformed &= !bad.open(txt2_path, &error) && error.find(":2: bad") != std::string::npos;
+    }
+    all_passed &= check(malformed, "malformed tokens and results wider than 16 bits rejected with line number");
+
+    std::string truncated = read_all(bin_path).substr(0, 1000);
+    {
+        std::ofstream f(bin_path, std::ios::binary | std::ios::trunc);
+        f << truncated;
+    }
+    all_passed &= check(!bad.open(bin_path, &error), "truncated binary rejected");
+
+    // Payload offsets near 2^64: offset + count * size wraps below the file size
+    bool garbage = true;
+    for (int field = 0; field < 4; ++field) {
+        garbage &= golden_write_binary(bin_path, info, results.data(), values.data(), 8, &error);
+        std::string bytes = read_all(bin_path);
+        GoldenHeader hdr;
+        std::memcpy(&hdr, bytes.data(), sizeof(hdr));
+        if (field == 0) hdr.results_offset = UINT64_MAX - 7;            // + 16 bytes wraps to 8
+        if (field == 1) hdr.values_offset = UINT64_MAX - 15;            // + 32 bytes wraps to 16
+        if (field == 2) hdr.results_offset = bytes.size() + 2;          // just past the end
+        if (field == 3) hdr.values_offset = golden_io::align_up(bytes.size(), golden_io::PAYLOAD_ALIGN);
+        std::memcpy(&bytes[0], &hdr, sizeof(hdr));
+        {
+            std::ofstream f(bin_path, std::ios::binary | std::ios::trunc);
+            f << bytes;
+        }
+        error.clear();
+        garbage &= !bad.open(bin_path, &error) && error.find("out of bounds") != std::string::npos;
+    }
+    all_passed &= check(garbage, "payload offsets past the end or wrapping around 2^64 rejected");
+
+    std::remove(bin_path.c_str());
+    std::remove(txt_path.c_str());
+    std::remove(txt2_path.c_str());
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Golden I/O tests passed.\n";
+    } else {
+        std::cout << "\n[FAIL] Golden I/O tests failed.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
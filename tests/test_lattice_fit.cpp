@@ -0,0 +1,74 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include "bf16_lattice_fit.hpp"
+#include "test_check.hpp"
+
+int main() {
+    std::cout << "--- Quantization-Aware Lattice Fit Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. The committed ROM passed explicitly is the default datapath
+    int mismatches = 0;
+    for (uint32_t raw = 0x8000; raw <= 0xFFFF; ++raw) {
+        FPRaw parts = fp_decompose(raw, FPType::BF16);
+        if (parts.status.is_nan || parts.status.is_inf || parts.status.is_zero) continue;
+        if (parts.exponent < bf16_cfg::INPUT_MIN_EXP || parts.exponent > bf16_cfg::INPUT_MAX_EXP) continue;
+        uint32_t dflt = fp_recompose(bf16_exp_core_approx_native<Base::E>(parts), FPType::BF16);
+        uint32_t rom = fp_recompose(bf16_exp_core_approx_native<Base::E>(parts, bf16_exp2_packed::coeffs_u64), FPType::BF16);
+        if (dflt != rom) mismatches++;
+    }
+    all_passed &= check(mismatches == 0, "explicit ROM == built-in ROM");
+
+    const LatticeScore committed = bf16_lattice_evaluate(bf16_exp2_packed::coeffs_u64);
+    all_passed &= check(committed.inputs == 2 * 17 * 128, "2^x and e^x core inputs enumerated");
+
+    // 2. Full configuration: no worse than the committed ROM, ROM reproduces the segment scores
+    LatticeFitResult full = bf16_lattice_fit();
+    LatticeScore rescored = bf16_lattice_evaluate(full.rom.data());
+    all_passed &= check(full.segments.size() == static_cast<size_t>(bf16_cfg::LUT_SIZE) && full.rom_bits == 128 * 2 * 21,
+                        "full configuration: 128 segments, 5376 ROM bits");
+    all_passed &= check(full.score.max_ulp <= committed.max_ulp && full.score.mean_ulp() <= committed.mean_ulp() + 1e-12,
+                        "full configuration matches or beats the committed ROM");
+    all_passed &= check(rescored.max_ulp == full.score.max_ulp && std::fabs(rescored.sum_ulp - full.score.sum_ulp) < 1e-9,
+                        "assembled ROM reproduces the per-segment scores");
+
+    // 3. Reduced configuration: zero LSBs, replicated entries, same worst case as committed
+    LatticeFitOptions small;
+    small.coeff_f = 13;
+    small.lut_size = 64;
+    small.num_threads = 1;
+    LatticeFitResult reduced = bf16_lattice_fit(small);
+    small.num_threads = 3;
+    LatticeFitResult reduced_mt = bf16_lattice_fit(small);
+
+    bool layout = reduced.rom.size() == static_cast<size_t>(bf16_cfg::LUT_SIZE);
+    const uint64_t low = bf16_native::ones<uint64_t>(bf16_cfg::COEFF_F - small.coeff_f);
+    for (int i = 0; layout && i < bf16_cfg::LUT_SIZE; ++i) {
+        uint64_t a = reduced.rom[i] & bf16_native::ones<uint64_t>(bf16_cfg::COEFF_W);
+        uint64_t b = reduced.rom[i] >> bf16_cfg::COEFF_W;
+        layout = ((a & low) == 0) && ((b & low) == 0) && reduced.rom[i] == reduced.rom[i ^ 1];
+    }
+    all_passed &= check(layout, "1.13 x 64: low coefficient bits zero, entries replicated in pairs");
+    all_passed &= check(reduced.rom_bits == 64 * 2 * 14, "1.13 x 64: 1792 ROM bits");
+    all_passed &= check(bf16_lattice_evaluate(reduced.rom.data()).max_ulp == reduced.score.max_ulp &&
+                        reduced.score.max_ulp <= committed.max_ulp, "1.13 x 64 keeps the committed worst-case ULP");
+    all_passed &= check(reduced.rom == reduced_mt.rom, "fit is independent of the thread count");
+
+    // 4. Invalid options
+    LatticeFitOptions bad;
+    bad.lut_size = 48;
+    all_passed &= check(bf16_lattice_fit(bad).segments.empty(), "non power-of-two LUT size is rejected");
+    bad.lut_size = bf16_cfg::LUT_SIZE;
+    bad.coeff_f = bf16_cfg::COEFF_F + 1;
+    all_passed &= check(bf16_lattice_fit(bad).segments.empty(), "coeff_f above COEFF_F is rejected");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Lattice fitter scores and assembles ROMs correctly.\n";
+    } else {
+        std::cout << "\n[FAIL] Lattice fitter mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,186 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cmath>
+#include <cstdint>
+#include "bf16_minimax_fit.hpp"
+#include "bf16_lattice_fit.hpp"
+#include "packed_coeffs_writer.hpp"
+#include "bf16_exp2_coeffs.hpp"
+#include "bf16_exp2_packed_coeffs.hpp"
+#include "test_check.hpp"
+
+/** @brief Weighted max error of the line (a, b) on the point set. */
+double level_of(const std::vector<double>& x, const std::vector<double>& t, const std::vector<double>& s, double a, double b) {
+    double level = 0.0;
+    for (size_t j = 0; j < x.size(); ++j) level = std::max(level, std::fabs(a * x[j] + b - t[j]) / s[j]);
+    return level;
+}
+
+/** @brief Writes a/b with write_packed_coeffs and parses coeffs_u64 back (empty on failure). */
+std::vector<uint64_t> write_and_read_packed(const std::string& path, const float* a, const float* b) {
+    std::vector<uint64_t> words;
+    if (!write_packed_coeffs<bf16_exp2_packed::COEFF_I, bf16_exp2_packed::COEFF_F,
+                             bf16_exp2_packed::LOG2E_I, bf16_exp2_packed::LOG2E_F>(path, a, b, bf16_exp2_packed::LUT_SIZE)) {
+        return words;
+    }
+    std::ifstream in(path);
+    std::stringstream text;
+    text << in.rdbuf();
+    std::string body = text.str();
+    size_t pos = body.find("coeffs_u64[LUT_SIZE] = {");
+    for (int i = 0; pos != std::string::npos && i < bf16_exp2_packed::LUT_SIZE; ++i) {
+        pos = body.find("0x", pos);
+        if (pos == std::string::npos) break;
+        words.push_back(std::stoull(body.substr(pos + 2, 16), nullptr, 16));
+        pos += 2;
+    }
+    if (words.size() != static_cast<size_t>(bf16_exp2_packed::LUT_SIZE)) words.clear();
+    return words;
+}
+
+int main(int argc, char** argv) {
+    std::cout << "--- Discrete Minimax Fit Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. x^2 on {0..10}: the Chebyshev line is 10x - 12.5 (equioscillation at 0, 5, 10)
+    std::vector<double> x, t, s;
+    for (int i = 0; i <= 10; ++i) {
+        x.push_back(i);
+        t.push_back(i * i);
+        s.push_back(1.0);
+    }
+    MinimaxLine sq = minimax_linear_fit(x.data(), t.data(), s.data(), x.size());
+    all_passed &= check(std::fabs(sq.a - 10.0) < 1e-9 && std::fabs(sq.b + 12.5) < 1e-9 && std::fabs(sq.level - 12.5) < 1e-9,
+                        "x^2 on {0..10} -> 10x - 12.5, level 12.5");
+
+    // 2. Weighted fits are not beaten by any nearby line (local perturbation search)
+    bool optimal = true;
+    uint32_t lcg = 12345;
+    auto rnd = [&lcg]() { lcg = lcg * 1664525u + 1013904223u; return (lcg >> 8) / 16777216.0; };
+    for (int trial = 0; trial < 50; ++trial) {
+        x.clear(); t.clear(); s.clear();
+        double xi = 0.0;
+        for (int j = 0; j < 40; ++j) {
+            xi += 0.01 + rnd();
+            x.push_back(xi);
+            t.push_back(std::sin(xi) + 0.1 * rnd());
+            s.push_back(0.5 + rnd());
+        }
+        MinimaxLine m = minimax_linear_fit(x.data(), t.data(), s.data(), x.size());
+        if (std::fabs(level_of(x, t, s, m.a, m.b) - m.level) > 1e-12) optimal = false;
+        for (double da : {-1e-4, 0.0, 1e-4}) {
+            for (double db : {-1e-4, 0.0, 1e-4}) {
+                if (level_of(x, t, s, m.a + da, m.b + db) < m.level - 1e-12) optimal = false;
+            }
+        }
+    }
+    all_passed &= check(optimal, "weighted random sets: no perturbed line has a lower level");
+
+    double two_x[] = {1.0, 3.0}, two_t[] = {2.0, 8.0}, two_s[] = {1.0, 1.0};
+    MinimaxLine two = minimax_linear_fit(two_x, two_t, two_s, 2);
+    all_passed &= check(two.a == 3.0 && two.b == -1.0 && two.level == 0.0, "two points are interpolated");
+
+    // 2b. Polynomial exchange: degree 1 is the line fit, degree 2 is locally optimal
+    bool poly_ok = true;
+    for (int trial = 0; trial < 20; ++trial) {
+        x.clear(); t.clear(); s.clear();
+        double xi = 0.0;
+        for (int j = 0; j < 40; ++j) {
+            xi += 0.01 + rnd();
+            x.push_back(xi);
+            t.push_back(std::exp(-0.1 * xi) + 0.01 * rnd());
+            s.push_back(0.5 + rnd());
+        }
+        MinimaxLine m = minimax_linear_fit(x.data(), t.data(), s.data(), x.size());
+        MinimaxPoly p1 = minimax_poly_fit(x.data(), t.data(), s.data(), x.size(), 1);
+        if (std::fabs(p1.level - m.level) > 1e-9 * m.level) poly_ok = false;
+
+        MinimaxPoly p2 = minimax_poly_fit(x.data(), t.data(), s.data(), x.size(), 2);
+        auto level2 = [&](double d0, double d1, double d2) {
+            double level = 0.0;
+            for (size_t j = 0; j < x.size(); ++j) {
+                level = std::max(level, std::fabs(p2(x[j]) + d0 + d1 * x[j] + d2 * x[j] * x[j] - t[j]) / s[j]);
+            }
+            return level;
+        };
+        if (p2.level > m.level + 1e-12 || std::fabs(level2(0, 0, 0) - p2.level) > 1e-12) poly_ok = false;
+        for (double d0 : {-1e-5, 0.0, 1e-5}) {
+            for (double d1 : {-1e-6, 0.0, 1e-6}) {
+                for (double d2 : {-1e-7, 0.0, 1e-7}) {
+                    if (level2(d0, d1, d2) < p2.level - 1e-12) poly_ok = false;
+                }
+            }
+        }
+    }
+    all_passed &= check(poly_ok, "polynomial exchange: degree 1 == line fit, degree 2 not beaten by perturbations");
+
+    double q_x[] = {0.0, 1.0, 2.0}, q_t[] = {1.0, 2.0, 5.0}, q_s[] = {1.0, 1.0, 1.0};
+    MinimaxPoly q = minimax_poly_fit(q_x, q_t, q_s, 3, 2);
+    all_passed &= check(std::fabs(q.c[0] - 1.0) < 1e-12 && std::fabs(q.c[1]) < 1e-12 && std::fabs(q.c[2] - 1.0) < 1e-12 &&
+                        q.level == 0.0, "degree + 1 points are interpolated");
+
+    // 3. Generator ROM: minimax lines in the reduced domain, accepted through the native datapath
+    LatticeFitOptions opts;
+    opts.num_threads = 1;
+    const LatticeFitResult fit = bf16_minimax_rom_fit(opts);
+    opts.num_threads = 4;
+    all_passed &= check(bf16_minimax_rom_fit(opts).rom == fit.rom, "fit is independent of the thread count");
+
+    // Segment i covers reduced fractions m in [(LUT_MAX_IDX - i) / LUT_SIZE, ...); y = b - a*m ~ 2^-m
+    bool slopes = true;
+    std::vector<float> fit_a(bf16_cfg::LUT_SIZE), fit_b(bf16_cfg::LUT_SIZE);
+    for (const LatticeSegment& seg : fit.segments) {
+        fit_a[seg.index] = static_cast<float>(std::ldexp(static_cast<double>(seg.a_code), -bf16_cfg::COEFF_F));
+        fit_b[seg.index] = static_cast<float>(std::ldexp(static_cast<double>(seg.b_code), -bf16_cfg::COEFF_F));
+        const double m_mid = (bf16_cfg::LUT_MAX_IDX - seg.index + 0.5) / bf16_cfg::LUT_SIZE;
+        slopes &= std::fabs(fit_a[seg.index] - M_LN2 * std::exp2(-m_mid)) < 0.005 &&
+                  std::fabs(fit_b[seg.index] - fit_a[seg.index] * m_mid - std::exp2(-m_mid)) < 0.001;
+    }
+    all_passed &= check(slopes, "every segment follows 2^-m (slope ln2 * 2^-m and value at the midpoint)");
+
+    // Pack the fitted coefficients as the generator does and run every core input through the datapath
+    const std::string dir = scratch_dir(argc, argv);
+    const std::string path = dir + "/test_minimax_packed.hpp";
+    std::vector<uint64_t> fit_rom = write_and_read_packed(path, fit_a.data(), fit_b.data());
+    double worst = fit_rom.empty() ? INFINITY : 0.0;
+    size_t core_inputs = 0;
+    size_t differ = 0;
+    for (uint32_t raw = 0x8000; !fit_rom.empty() && raw <= 0xFFFF; ++raw) {
+        const FPRaw parts = fp_decompose(raw, FPType::BF16);
+        const FPStatus& st = parts.status;
+        if (st.is_nan || st.is_inf || st.is_zero || st.is_denormal) continue;
+        if (parts.exponent < bf16_cfg::INPUT_MIN_EXP || parts.exponent > bf16_cfg::INPUT_MAX_EXP) continue;
+        const long double x = fp_to_double(raw, FPType::BF16);
+        const uint32_t two = fp_recompose(bf16_exp_core_approx_native<Base::Two>(parts, fit_rom.data()), FPType::BF16);
+        const uint32_t e = fp_recompose(bf16_exp_core_approx_native<Base::E>(parts, fit_rom.data()), FPType::BF16);
+        worst = std::max(worst, calculate_ulp_error_raw<FPType::BF16>(static_cast<double>(std::exp2(x)), two));
+        worst = std::max(worst, calculate_ulp_error_raw<FPType::BF16>(static_cast<double>(std::exp(x)), e));
+        core_inputs += 2;
+
+        // The committed ROM differs before rounding but must round to the same results
+        differ += two != fp_recompose(bf16_exp_core_approx_native<Base::Two>(parts), FPType::BF16);
+        differ += e != fp_recompose(bf16_exp_core_approx_native<Base::E>(parts), FPType::BF16);
+    }
+    all_passed &= check(core_inputs == fit.score.inputs && worst <= 0.5 && fit.score.max_ulp <= 0.5,
+                        "packed fit through bf16_exp_core_approx_native: every 2^x and e^x core input within 0.5 ULP");
+    all_passed &= check(fit_rom == fit.rom && differ == 0, "fitted ROM rounds every core input like the committed ROM");
+
+    // 4. Packed writer reproduces the committed packed words from the committed float coefficients
+    const std::vector<uint64_t> words = write_and_read_packed(path, bf16_exp2::coeffs_a, bf16_exp2::coeffs_b);
+    int matches = 0;
+    for (size_t i = 0; i < words.size(); ++i) matches += words[i] == bf16_exp2_packed::coeffs_u64[i];
+    all_passed &= check(matches == bf16_exp2_packed::LUT_SIZE, "packed writer == committed coeffs_u64");
+    std::remove(path.c_str());
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Minimax fitter and packed writer are correct.\n";
+    } else {
+        std::cout << "\n[FAIL] Minimax fitter or packed writer mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+#include <iostream>
+#include <cstdint>
+#include "bf16_exp2_multipartite.hpp"
+#include "bf16_multipartite_fit.hpp"
+#include "test_exp_engine.hpp"
+
+struct MultipartiteEngine {
+    template<Base B> static uint16_t hls(uint16_t raw) { return bf16_exp_multipartite_approx<B>(raw); }
+    template<Base B> static FPRaw native(const FPRaw& parts) {
+        return bf16_exp_multipartite_core_approx_native<B, bf16_exp_multipartite>(parts);
+    }
+};
+
+int main() {
+    std::cout << "--- Multipartite exp Engine Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. HLS and native cores agree on every input and are correctly rounded
+    all_passed &= check_engine_cores<MultipartiteEngine>("multipartite");
+
+    // 2. Same results as the committed linear datapath, without its multiplier
+    all_passed &= check(engine_linear_mismatches<MultipartiteEngine>() == 0,
+                        "multipartite engine == linear high-accuracy datapath on every input");
+    all_passed &= check(bf16_exp_multipartite::ROM_BITS == 128 * 18 + 512 * 10 + 128 * 5,
+                        "ROM: 8064 bits (TIV 128 x 18, TO1 512 x 10, TO2 128 x 5)");
+
+    // 3. The header is the generator's output
+    const MultipartiteFitResult fit = bf16_multipartite_fit<bf16_exp_multipartite>();
+    bool same_tables = fit.tiv.size() == static_cast<size_t>(bf16_exp_multipartite::TIV_SIZE) &&
+                       fit.to1.size() == static_cast<size_t>(bf16_exp_multipartite::TO1_SIZE) &&
+                       fit.to2.size() == static_cast<size_t>(bf16_exp_multipartite::TO2_SIZE);
+    for (size_t i = 0; same_tables && i < fit.tiv.size(); ++i) same_tables = fit.tiv[i] == bf16_exp_multipartite::TIV[i];
+    for (size_t i = 0; same_tables && i < fit.to1.size(); ++i) same_tables = fit.to1[i] == bf16_exp_multipartite::TO1[i];
+    for (size_t i = 0; same_tables && i < fit.to2.size(); ++i) same_tables = fit.to2[i] == bf16_exp_multipartite::TO2[i];
+    all_passed &= check(same_tables && fit.score.inputs == 2 * 17 * 128, "regeneration reproduces bf16_exp2_multipartite_tables.hpp");
+    all_passed &= check(bf16_multipartite_evaluate<bf16_exp_multipartite>(bf16_exp_multipartite::tables()).max_ulp == fit.score.max_ulp,
+                        "committed tables reproduce the generator's score");
+
+    MultipartiteFitOptions one_thread;
+    one_thread.num_threads = 1;
+    const MultipartiteFitResult fit1 = bf16_multipartite_fit<bf16_exp_multipartite>(one_thread);
+    all_passed &= check(fit1.tiv == fit.tiv && fit1.to1 == fit.to1 && fit1.to2 == fit.to2, "tables are independent of the thread count");
+
+    // 4. A bipartite policy (no TO2) goes through the same generator and core
+    typedef bf16_exp_multipartite_cfg_t<8, 4, 8, 0, 0, 18, 22> Bipartite;
+    const MultipartiteFitResult bi = bf16_multipartite_fit<Bipartite>();
+    all_passed &= check(bi.to2.empty() && bi.rom_bits == 256 * 19 + 4096 * 10 && bi.score.max_ulp < 0.51,
+                        "bipartite 256: faithful on every core input");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Multipartite engine is bit-accurate and correctly rounded.\n";
+    } else {
+        std::cout << "\n[FAIL] Multipartite engine mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,58 @@
+#include <iostream>
+#include <cstdint>
+#include "bf16_exp2_nonuniform.hpp"
+#include "bf16_nonuniform_fit.hpp"
+#include "test_exp_engine.hpp"
+
+struct NonuniformEngine {
+    template<Base B> static uint16_t hls(uint16_t raw) { return bf16_exp_nonuniform_approx<B>(raw); }
+    template<Base B> static FPRaw native(const FPRaw& parts) {
+        return bf16_exp_nonuniform_core_approx_native<B, bf16_exp_nonuniform>(parts);
+    }
+};
+
+int main() {
+    std::cout << "--- Non-Uniform exp LUT Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. HLS and native cores agree on every input and are correctly rounded, like the committed 128-entry LUT
+    all_passed &= check_engine_cores<NonuniformEngine>("non-uniform");
+
+    // 2. The directory is a replication of the segment words over the uniform grid
+    const NonuniformFitResult fit = bf16_nonuniform_fit<bf16_exp_cfg>();
+    const int differ = engine_mismatches<NonuniformEngine>([&fit](auto base, uint16_t in) {
+        constexpr Base B = decltype(base)::value;
+        return bf16_exp_approx_with(in, [&fit](const FPRaw& parts) {
+            return bf16_exp_core_approx_native<B, bf16_exp_cfg>(parts, fit.expanded_rom.data());
+        });
+    });
+    all_passed &= check(differ == 0, "non-uniform core == uniform core with the expanded ROM on every input");
+    all_passed &= check(bf16_exp_nonuniform::SEG_COUNT * 4 < bf16_exp_high_accuracy::LUT_SIZE &&
+                        bf16_exp_nonuniform::ROM_BITS * 4 < static_cast<uint64_t>(bf16_exp_high_accuracy::LUT_SIZE) * bf16_exp_high_accuracy::PACKED_W,
+                        "fewer than a quarter of the coefficient words and ROM bits of the uniform LUT");
+
+    // 3. The header is the fitter's output
+    bool same = fit.rom.size() == static_cast<size_t>(bf16_exp_nonuniform::SEG_COUNT) &&
+                fit.dir.size() == static_cast<size_t>(bf16_exp_nonuniform::L1_SIZE);
+    for (size_t i = 0; same && i < fit.rom.size(); ++i) same = fit.rom[i] == bf16_exp_nonuniform::ROM[i];
+    for (size_t i = 0; same && i < fit.dir.size(); ++i) same = fit.dir[i] == bf16_exp_nonuniform::DIR[i];
+    all_passed &= check(same && fit.score.inputs == 2 * 17 * 128, "refit reproduces bf16_exp2_nonuniform_coeffs.hpp");
+    all_passed &= check(bf16_nonuniform_evaluate<bf16_exp_nonuniform>(bf16_exp_nonuniform::DIR, bf16_exp_nonuniform::ROM).max_ulp == fit.score.max_ulp,
+                        "directory and ROM reproduce the per-segment scores");
+
+    // 4. A looser target trades accuracy for fewer words, never more than the uniform LUT
+    NonuniformFitOptions loose;
+    loose.target_ulp = 0.51;
+    const NonuniformFitResult fit_loose = bf16_nonuniform_fit<bf16_exp_cfg>(loose);
+    bool balanced = fit_loose.rom.size() <= fit.rom.size();
+    for (const NonuniformRegion& r : fit_loose.regions) balanced &= (r.max_ulp <= loose.target_ulp || r.depth == 3);
+    all_passed &= check(balanced && fit_loose.score.max_ulp <= 0.51, "target 0.51 ULP: every region within the target");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Non-uniform LUT is bit-accurate and correctly rounded.\n";
+    } else {
+        std::cout << "\n[FAIL] Non-uniform LUT mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
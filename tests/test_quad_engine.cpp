@@ -0,0 +1,47 @@
+#include <iostream>
+#include <cstdint>
+#include "bf16_exp2_quad.hpp"
+#include "bf16_quad_fit.hpp"
+#include "test_exp_engine.hpp"
+
+struct QuadEngine {
+    template<Base B> static uint16_t hls(uint16_t raw) { return bf16_exp_quad_approx<B>(raw); }
+    template<Base B> static FPRaw native(const FPRaw& parts) { return bf16_exp_quad_core_approx_native<B, bf16_exp_quad>(parts); }
+};
+
+int main() {
+    std::cout << "--- Quadratic exp Engine Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. HLS and native cores agree on every input and are correctly rounded
+    all_passed &= check_engine_cores<QuadEngine>("quadratic");
+
+    // 2. Same results as the committed linear datapath, on a tenth of its ROM
+    all_passed &= check(engine_linear_mismatches<QuadEngine>() == 0, "quadratic engine == linear high-accuracy datapath on every input");
+
+    const uint64_t quad_bits = static_cast<uint64_t>(bf16_exp_quad::LUT_SIZE) * bf16_exp_quad::PACKED_W;
+    const uint64_t linear_bits = static_cast<uint64_t>(bf16_exp_high_accuracy::LUT_SIZE) * bf16_exp_high_accuracy::PACKED_W;
+    all_passed &= check(quad_bits == 512 && quad_bits * 10 < linear_bits, "ROM: 512 bits vs 5376 for the linear datapath");
+
+    // 3. The header is the fitter's output
+    const QuadFitResult fit = bf16_quad_fit<bf16_exp_quad>();
+    bool same_rom = fit.rom.size() == static_cast<size_t>(bf16_exp_quad::LUT_SIZE);
+    for (int i = 0; same_rom && i < bf16_exp_quad::LUT_SIZE; ++i) same_rom = fit.rom[i] == bf16_exp_quad::ROM[i];
+    all_passed &= check(same_rom && fit.score.inputs == 2 * 17 * 128, "refit reproduces bf16_exp2_quad_coeffs.hpp");
+    all_passed &= check(bf16_quad_evaluate<bf16_exp_quad>(bf16_exp_quad::ROM).max_ulp == fit.score.max_ulp,
+                        "assembled ROM reproduces the per-segment scores");
+
+    // 4. A 32-segment policy fits on the same terms
+    typedef bf16_exp_quad_cfg_t<5, 13, 15, 15, 12, 22> Quad32;
+    const QuadFitResult fit32 = bf16_quad_fit<Quad32>();
+    all_passed &= check(fit32.segments.size() == 32 && fit32.rom_bits == 32 * Quad32::PACKED_W && fit32.score.max_ulp <= 0.5,
+                        "32 segments: correctly rounded core inputs");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Quadratic engine is bit-accurate and correctly rounded.\n";
+    } else {
+        std::cout << "\n[FAIL] Quadratic engine mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
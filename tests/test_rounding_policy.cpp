@@ -0,0 +1,150 @@
+#include <iostream>
+#include <cmath>
+#include <cstdint>
+#include "bf16_exp2_quad.hpp"
+#include "bf16_dse.hpp"
+#include "test_check.hpp"
+
+typedef bf16_exp_high_accuracy HA;
+typedef bf16_exp_rounding_t<HA, bf16_round_rne> HaRne;
+typedef bf16_exp_rounding_t<HA, bf16_round_rtz> HaRtz;
+typedef bf16_exp_rounding_t<HA, bf16_round_half_away> HaHalfAway;
+typedef bf16_exp_rounding_t<HA, bf16_round_stochastic<bf16_lfsr16>> HaSr16;
+typedef bf16_exp_rounding_t<bf16_exp_low_area, bf16_round_stochastic<bf16_lfsr32, 8>> LaSr32;
+typedef bf16_exp_rounding_t<bf16_exp_quad, bf16_round_rtz> QuadRtz;
+
+bool is_nan(uint16_t bits) {
+    return (bits & 0x7FFF) > 0x7F80;
+}
+
+/** @brief Counts the inputs where the ac_fixed and native linear cores of Cfg differ (both bases). */
+template<typename Cfg>
+int ac_native_mismatches() {
+    int mismatches = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        // Each model takes one LFSR step per rounded result; start both from the same state
+        if constexpr (Cfg::Rounding::MODE == RoundMode::Stochastic) Cfg::Rounding::Source::seed(raw + 1);
+        const uint16_t two = bf16_exp_approx<Base::Two, Cfg>(in);
+        if constexpr (Cfg::Rounding::MODE == RoundMode::Stochastic) Cfg::Rounding::Source::seed(raw + 1);
+        mismatches += two != bf16_exp_approx_with(in, [](const FPRaw& parts) {
+            return bf16_exp_core_approx_native<Base::Two, Cfg>(parts);
+        });
+        if constexpr (Cfg::Rounding::MODE == RoundMode::Stochastic) Cfg::Rounding::Source::seed(raw + 1);
+        const uint16_t e = bf16_exp_approx<Base::E, Cfg>(in);
+        if constexpr (Cfg::Rounding::MODE == RoundMode::Stochastic) Cfg::Rounding::Source::seed(raw + 1);
+        mismatches += e != bf16_exp_approx_with(in, [](const FPRaw& parts) {
+            return bf16_exp_core_approx_native<Base::E, Cfg>(parts);
+        });
+    }
+    return mismatches;
+}
+
+int main() {
+    std::cout << "--- Rounding Policy Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. RNE is the default: same outputs and same configuration hash
+    int differ = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        differ += bf16_exp_approx<Base::Two, HaRne>(in) != bf16_exp_approx<Base::Two>(in);
+        differ += bf16_exp_approx<Base::E, HaRne>(in) != bf16_exp_approx<Base::E>(in);
+    }
+    all_passed &= check(differ == 0 && bf16_exp2_config_hash<HaRne>() == bf16_exp2_config_hash<>() &&
+                        bf16_exp2_config_hash<HaRtz>() != bf16_exp2_config_hash<>() &&
+                        bf16_exp2_config_hash<HaSr16>() != bf16_exp2_config_hash<HaRtz>(),
+                        "RNE policy == committed datapath (all inputs, same hash); other policies change the hash");
+    typedef bf16_exp_rounding_t<HA, bf16_round_stochastic<bf16_lfsr32, 16>> HaSr32;
+    typedef bf16_exp_rounding_t<HA, bf16_round_stochastic<bf16_lfsr_t<16, 0xB400, 0x1234>>> HaSr16Seed;
+    all_passed &= check(bf16_exp2_config_hash<HaSr32>() != bf16_exp2_config_hash<HaSr16>() &&
+                        bf16_exp2_config_hash<HaSr16Seed>() != bf16_exp2_config_hash<HaSr16>(),
+                        "stochastic: LFSR width and seed are part of the hash");
+
+    // 2. HLS and native models agree bit for bit
+    all_passed &= check(ac_native_mismatches<HaRtz>() == 0 && ac_native_mismatches<HaHalfAway>() == 0 &&
+                        ac_native_mismatches<HaSr16>() == 0 && ac_native_mismatches<LaSr32>() == 0,
+                        "ac_fixed and native back ends are bit-identical (RTZ, half away, 2 stochastic, 2^x, e^x)");
+    int quad_mismatches = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        quad_mismatches += bf16_exp_quad_approx<Base::Two, QuadRtz>(in) != bf16_exp_approx_with(in, [](const FPRaw& parts) {
+            return bf16_exp_quad_core_approx_native<Base::Two, QuadRtz>(parts);
+        });
+    }
+    all_passed &= check(quad_mismatches == 0, "shared back end: quadratic engine with RTZ, ac_fixed == native");
+
+    // 3. Directed modes against RNE: RTZ is RNE or one below, half away is RNE or one above (ties only)
+    bool rtz_ok = true, half_away_ok = true;
+    int rtz_down = 0, half_away_up = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        for (bool base2 : {true, false}) {
+            const uint16_t rne = base2 ? bf16_exp_approx<Base::Two>(in) : bf16_exp_approx<Base::E>(in);
+            const uint16_t rtz = base2 ? bf16_exp_approx<Base::Two, HaRtz>(in) : bf16_exp_approx<Base::E, HaRtz>(in);
+            const uint16_t away = base2 ? bf16_exp_approx<Base::Two, HaHalfAway>(in) : bf16_exp_approx<Base::E, HaHalfAway>(in);
+            if (is_nan(rne)) {
+                rtz_ok &= is_nan(rtz);
+                half_away_ok &= is_nan(away);
+                continue;
+            }
+            rtz_ok &= rtz == rne || rtz + 1 == rne;
+            half_away_ok &= away == rne || away == rne + 1;
+            rtz_down += rtz != rne;
+            half_away_up += away != rne;
+        }
+    }
+    all_passed &= check(rtz_ok && rtz_down > 0, "RTZ never exceeds RNE and is at most one code below");
+    all_passed &= check(half_away_ok && half_away_up <= rtz_down, "half away is RNE or one code above");
+
+    // Decision tables: (lsb, guard, sticky); only the even tie (0, 1, 0) separates RNE and half away
+    bool decisions = true;
+    for (int bits = 0; bits < 8; ++bits) {
+        const bool lsb = bits & 4, guard = bits & 2, sticky = bits & 1;
+        decisions &= bf16_round_up<bf16_round_rne>(lsb, guard, sticky) == (guard && (lsb || sticky));
+        decisions &= bf16_round_up<bf16_round_half_away>(lsb, guard, sticky) == guard;
+        decisions &= !bf16_round_up<bf16_round_rtz>(lsb, guard, sticky);
+    }
+    all_passed &= check(decisions, "round-up decisions of RNE, half away and RTZ");
+
+    // 4. Stochastic rounding: reproducible from the seed, between RTZ and RTZ + 1
+    bool repeat = true, bracket = true;
+    for (uint32_t raw = 0x8000; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        bf16_lfsr16::seed(raw);
+        const uint16_t a = bf16_exp_approx<Base::E, HaSr16>(in);
+        bf16_lfsr16::seed(raw);
+        repeat &= a == bf16_exp_approx<Base::E, HaSr16>(in);
+        const uint16_t rtz = bf16_exp_approx<Base::E, HaRtz>(in);
+        bracket &= is_nan(rtz) ? is_nan(a) : (a == rtz || a == rtz + 1);
+    }
+    all_passed &= check(repeat && bracket, "stochastic rounding repeats after seed() and picks RTZ or RTZ + 1");
+
+    uint64_t period = 0;
+    bf16_lfsr16::seed();
+    do {
+        bf16_lfsr16::next();
+        ++period;
+    } while (bf16_lfsr16::state != bf16_lfsr16::SEED && period <= 0x10000);
+    all_passed &= check(period == 0xFFFF, "16-bit LFSR is maximal length (period 65535)");
+
+    // 5. Accuracy reports: RNE correctly rounded, stochastic removes most of the RTZ bias
+    DseReferences refs;
+    const DseRoundingStats rne = bf16_dse_rounding_stats<Base::Two, HaRne>(refs, 0);
+    const DseRoundingStats rtz = bf16_dse_rounding_stats<Base::Two, HaRtz>(refs, 0);
+    bf16_lfsr16::seed();
+    const DseRoundingStats sr = bf16_dse_rounding_stats<Base::Two, HaSr16>(refs, 1);
+    all_passed &= check(rne.correctly_rounded == rne.hist.count && rne.hist.max_ulp <= 0.5,
+                        "RNE: every negative 2^x input correctly rounded");
+    all_passed &= check(rtz.hist.max_ulp <= 1.0 && rtz.mean_signed_ulp < -0.01 && sr.hist.max_ulp < 1.0 &&
+                        std::fabs(sr.mean_signed_ulp) < std::fabs(rtz.mean_signed_ulp) / 4,
+                        "RTZ within 1 ULP and biased low; stochastic bias under a quarter of RTZ's");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Rounding policies are bit-accurate.\n";
+    } else {
+        std::cout << "\n[FAIL] Rounding policy mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include "bf16_dse.hpp"
+#include "test_check.hpp"
+
+typedef bf16_exp_high_accuracy HA;
+typedef bf16_exp_trunc_mult_t<HA, HA::MULT_W> HaFull;          // Nothing dropped
+typedef bf16_exp_trunc_mult_t<HA, 25> HaTrunc;                  // Sweep limit of the high-accuracy datapath
+typedef bf16_exp_trunc_mult_t<HA, 30, 0> HaPlain;               // Truncation without correction
+typedef bf16_exp_trunc_mult_t<bf16_exp_low_area, 23> LowTrunc;  // Sweep limit of the low-area datapath
+
+/** @brief Counts the inputs where the ac_fixed and native cores of Cfg differ (both bases). */
+template<typename Cfg>
+int ac_native_mismatches() {
+    int mismatches = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        mismatches += bf16_exp_approx<Base::Two, Cfg>(in) != bf16_exp_approx_with(in, [](const FPRaw& parts) {
+            return bf16_exp_core_approx_native<Base::Two, Cfg>(parts);
+        });
+        mismatches += bf16_exp_approx<Base::E, Cfg>(in) != bf16_exp_approx_with(in, [](const FPRaw& parts) {
+            return bf16_exp_core_approx_native<Base::E, Cfg>(parts);
+        });
+    }
+    return mismatches;
+}
+
+/** @brief Truncated product by its definition: partial products a_j * x_i of the columns i + j >= T, plus the correction. */
+template<typename Cfg>
+uint64_t reference_product(uint64_t a, uint64_t x) {
+    uint64_t sum = Cfg::MULT_CORR << Cfg::MULT_TRUNC_W;
+    for (int j = 0; j < Cfg::COEFF_W; ++j) {
+        for (int i = 0; i < Cfg::IN_W; ++i) {
+            if (i + j >= Cfg::MULT_TRUNC_W && ((a >> j) & 1) && ((x >> i) & 1)) sum += uint64_t(1) << (i + j);
+        }
+    }
+    return sum & bf16_native::ones<uint64_t>(Cfg::MULT_W);
+}
+
+int main() {
+    std::cout << "--- Truncated a*x Multiplier Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // 1. Keeping every column is the full multiplier
+    int differ = 0;
+    for (uint32_t raw = 0; raw <= 0xFFFF; ++raw) {
+        const uint16_t in = static_cast<uint16_t>(raw);
+        differ += bf16_exp_approx<Base::E, HaFull>(in) != bf16_exp_approx<Base::E>(in);
+        differ += bf16_exp_approx<Base::Two, HaFull>(in) != bf16_exp_approx<Base::Two>(in);
+    }
+    all_passed &= check(differ == 0 && bf16_exp2_config_hash<HaFull>() == bf16_exp2_config_hash<HA>(),
+                        "MULT_W kept columns == full multiplier (all inputs, same config hash)");
+
+    // 2. HLS and native models agree bit for bit
+    all_passed &= check(ac_native_mismatches<HaTrunc>() == 0 && ac_native_mismatches<HaPlain>() == 0 &&
+                        ac_native_mismatches<LowTrunc>() == 0,
+                        "ac_fixed and native truncated cores are bit-identical (3 truncations, 2^x, e^x, all inputs)");
+
+    // 3. The product is the partial-product sum of the kept columns plus the correction
+    std::mt19937_64 rng(21);
+    int wrong = 0;
+    double corr_err = 0.0, plain_err = 0.0;
+    bool bounded = true;
+    const int samples = 20000;
+    for (int s = 0; s < samples; ++s) {
+        const uint64_t a = rng() & bf16_native::ones<uint64_t>(HA::COEFF_W);
+        const uint64_t x = rng() & bf16_native::ones<uint64_t>(HA::IN_W);
+        const uint64_t trunc = static_cast<uint64_t>(bf16_exp_mult_ax_native<HaTrunc>(a, x));
+        const uint64_t plain = static_cast<uint64_t>(bf16_exp_mult_ax_native<HaPlain>(a, x));
+        wrong += trunc != reference_product<HaTrunc>(a, x) || plain != reference_product<HaPlain>(a, x);
+
+        ac_fixed<HA::COEFF_W, HA::COEFF_I, false> a_fixed;
+        a_fixed.set_slc(0, ac_int<HA::COEFF_W, false>(a));
+        mant_of_t<HA> x_fixed;
+        x_fixed.set_slc(0, ac_int<HA::IN_W, false>(x));
+        wrong += bf16_exp_mult_ax<HaTrunc>(a_fixed, x_fixed).slc<HA::MULT_W>(0).to_uint64() != trunc;
+
+        // Dropped bits are fewer than COEFF_W per dropped column weight
+        const uint64_t full = a * x;
+        bounded &= plain <= full && full - plain < (uint64_t(HA::COEFF_W) << HaPlain::MULT_TRUNC_W);
+        corr_err += (static_cast<double>(trunc) - static_cast<double>(full)) / std::ldexp(1.0, HaTrunc::MULT_TRUNC_W);
+        plain_err += (static_cast<double>(plain) - static_cast<double>(full)) / std::ldexp(1.0, HaPlain::MULT_TRUNC_W);
+    }
+    all_passed &= check(wrong == 0, "truncated product == column-wise partial-product sum (ac_fixed and native)");
+    all_passed &= check(bounded, "uncorrected truncation error in [0, COEFF_W * 2^MULT_TRUNC_W)");
+    all_passed &= check(std::fabs(corr_err / samples) < 0.5 && plain_err / samples < -4.0,
+                        "expected-value correction centers the error on uniform operands");
+
+    // 4. Correction and cost helpers
+    all_passed &= check(HaPlain::MULT_CORR == 0 && bf16_trunc_mult_corr(HA::COEFF_W, HA::IN_W, 0) == 0 &&
+                        HaTrunc::MULT_CORR == 5, "default correction (0 when nothing is dropped, 5 at 35 dropped columns)");
+    all_passed &= check(bf16_trunc_mult_pp_bits(HA::COEFF_W, HA::IN_W, 0) == uint64_t(HA::COEFF_W) * HA::IN_W &&
+                        bf16_trunc_mult_pp_bits(HA::COEFF_W, HA::IN_W, HaTrunc::MULT_TRUNC_W) == 294,
+                        "partial-product bits: 819 full, 294 with 25 kept columns");
+
+    // 5. Sweep limits: no accuracy loss at 25 (high-accuracy) and 23 (low-area) kept columns
+    DseReferences refs;
+    const DseTruncPoint ha = bf16_dse_evaluate_trunc<HaTrunc>(refs, 0);
+    const DseTruncPoint low = bf16_dse_evaluate_trunc<LowTrunc>(refs, 0);
+    const DseTruncPoint low_full = bf16_dse_evaluate_trunc<bf16_exp_low_area>(refs, 0);
+    all_passed &= check(ha.max_ulp() <= 0.5 && ha.keep_w == 25, "high-accuracy with 25 of 60 columns stays correctly rounded");
+    all_passed &= check(low.max_ulp() <= low_full.max_ulp() && low.trunc_w == 27,
+                        "low-area with 23 of 50 columns keeps its full-multiplier worst case");
+    std::vector<DseTruncPoint> points = {low_full, low, bf16_dse_evaluate_trunc<bf16_exp_trunc_mult_t<bf16_exp_low_area, 16>>(refs, 0)};
+    all_passed &= check(bf16_dse_trunc_limit(points, low_full.max_ulp()) == 1 && bf16_dse_trunc_limit(points, 0.4) == -1,
+                        "trunc limit stops at the first truncation over the target");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] Truncated multiplier model is bit-accurate.\n";
+    } else {
+        std::cout << "\n[FAIL] Truncated multiplier mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
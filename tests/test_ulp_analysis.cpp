@@ -0,0 +1,129 @@
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include "fp_utils.hpp"
+#include "fp_convert.hpp"
+#include "ulp_analysis.hpp"
+#include "test_check.hpp"
+
+bool same_histogram(const UlpHistogram& a, const UlpHistogram& b) {
+    for (int k = 0; k < UlpHistogram::NUM_BINS; ++k) {
+        if (a.bins[k] != b.bins[k]) return false;
+    }
+    return a.count == b.count && a.finite == b.finite && a.max_ulp == b.max_ulp && a.sum_ulp == b.sum_ulp;
+}
+
+// Reference text line, formatted like the original iostream implementation
+std::string iostream_line(uint32_t input, uint32_t output, double ulp) {
+    std::ostringstream os;
+    os << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << input
+       << " " << std::setw(4) << std::setfill('0') << output
+       << " " << std::dec << std::fixed << std::setprecision(4);
+    if (std::isnan(ulp)) {
+        os << "NaN";
+    } else if (std::isinf(ulp)) {
+        os << "Inf";
+    } else {
+        os << ulp;
+    }
+    os << "\n";
+    return os.str();
+}
+
+int main() {
+    std::cout << "--- Parallel ULP Analysis Engine Test ---\n" << std::endl;
+    bool all_passed = true;
+
+    // Synthetic exp2 outputs for every BF16 input: RNE result with every 37th output nudged by k ULPs
+    std::vector<uint16_t> outputs(0x10000);
+    for (uint32_t i = 0; i < outputs.size(); ++i) {
+        uint16_t y = double_to_bf16_rne(std::exp2(bf16_to_double(static_cast<uint16_t>(i))));
+        if (i % 37 == 0 && !fp_classify(y, FPType::BF16).is_nan) y = static_cast<uint16_t>(y + (i / 37) % 5);
+        outputs[i] = y;
+    }
+    auto ref = [](double x) { return std::exp2(x); };
+
+    UlpAnalysisOptions single;
+    single.num_threads = 1;
+    UlpAnalysisOptions multi = single;
+    multi.num_threads = 8;
+
+    UlpReport r1 = ulp_analyze(outputs.data(), outputs.size(), 0, ref, FPType::BF16, single);
+    UlpReport r8 = ulp_analyze(outputs.data(), outputs.size(), 0, ref, FPType::BF16, multi);
+
+    // 1. Determinism across thread counts
+    bool same = r1.text == r8.text && r1.ulp.size() == r8.ulp.size() &&
+                std::memcmp(r1.ulp.data(), r8.ulp.data(), r1.ulp.size() * sizeof(float)) == 0 && same_histogram(r1.total, r8.total) &&
+                r1.max_ulp_input == r8.max_ulp_input && r1.worst.size() == r8.worst.size();
+    for (size_t k = 0; same && k < r1.by_binade.size(); ++k) same = same_histogram(r1.by_binade[k], r8.by_binade[k]);
+    for (int c = 0; same && c < static_cast<int>(UlpOutputClass::Count); ++c) same = same_histogram(r1.by_class[c], r8.by_class[c]);
+    for (size_t k = 0; same && k < r1.worst.size(); ++k) same = r1.worst[k].input == r8.worst[k].input;
+    all_passed &= check(same, "report is identical for 1 and 8 threads");
+
+    // 2. Totals against a straightforward serial pass
+    std::string text;
+    double max_ulp = 0.0, sum = 0.0;
+    uint32_t max_input = 0;
+    uint64_t finite = 0;
+    for (uint32_t i = 0; i < outputs.size(); ++i) {
+        double ulp = calculate_ulp_error(ref(bf16_to_double(static_cast<uint16_t>(i))), fp_to_double(outputs[i], FPType::BF16), FPType::BF16);
+        text += iostream_line(i, outputs[i], ulp);
+        if (std::isfinite(ulp)) {
+            if (ulp > max_ulp) {
+                max_ulp = ulp;
+                max_input = i;
+            }
+            sum += ulp;
+            finite++;
+        }
+    }
+    all_passed &= check(r1.text == text, "text report matches the iostream formatting");
+    all_passed &= check(r1.total.count == outputs.size() && r1.total.finite == finite, "sample counts");
+    all_passed &= check(r1.total.max_ulp == max_ulp && r1.max_ulp_input == max_input, "max ULP and first input reaching it");
+    all_passed &= check(std::fabs(r1.total.sum_ulp - sum) <= 1e-9 * sum, "ULP sum");
+
+    // 3. Histograms partition the samples
+    uint64_t binade_total = 0, class_total = 0, bin_total = 0;
+    for (const UlpHistogram& h : r1.by_binade) binade_total += h.count;
+    for (const UlpHistogram& h : r1.by_class) class_total += h.count;
+    for (uint64_t b : r1.total.bins) bin_total += b;
+    all_passed &= check(binade_total == outputs.size() && class_total == outputs.size() && bin_total == outputs.size(),
+                        "binade, class and bucket counts add up");
+    all_passed &= check(r1.by_binade[0x7F].count == 128 && r1.by_binade[0x100 + 0x7F].count == 128, "binade indexing");
+
+    // 4. Worst list: sorted, K long, headed by the global maximum
+    bool sorted = r1.worst.size() == single.top_k;
+    for (size_t k = 1; sorted && k < r1.worst.size(); ++k) sorted = !ulp_analysis_detail::worse(r1.worst[k], r1.worst[k - 1]);
+    all_passed &= check(sorted, "worst list sorted and K long");
+    all_passed &= check(!r1.worst.empty() && (std::isinf(r1.worst[0].ulp) || r1.worst[0].ulp == max_ulp), "worst list head");
+
+    // 5. Formatting corner cases (ties at the 4th decimal, large values)
+    const double samples[] = {0.0, 0.00005, 0.00015, 0.49995, 0.5, 1.0 / 3.0, 123456.78905, 1e30, 7.25e-7};
+    bool formatted = true;
+    for (double v : samples) {
+        std::string line;
+        ulp_analysis_detail::append_line(line, 0xABCD, 0x0012, v);
+        formatted &= (line == iostream_line(0xABCD, 0x0012, v));
+    }
+    all_passed &= check(formatted, "append_line == iostream for corner values");
+
+    // 6. Output classes
+    all_passed &= check(ulp_output_class(0x7F80, FPType::BF16) == UlpOutputClass::Saturated &&
+                        ulp_output_class(0xFF7F, FPType::BF16) == UlpOutputClass::Saturated &&
+                        ulp_output_class(0x0001, FPType::BF16) == UlpOutputClass::Subnormal &&
+                        ulp_output_class(0x8000, FPType::BF16) == UlpOutputClass::Zero &&
+                        ulp_output_class(0x7FC0, FPType::BF16) == UlpOutputClass::NaN &&
+                        ulp_output_class(0x3F80, FPType::BF16) == UlpOutputClass::Normal, "output classes");
+
+    if (all_passed) {
+        std::cout << "\n[SUCCESS] ULP analysis engine is deterministic and consistent.\n";
+    } else {
+        std::cout << "\n[FAIL] ULP analysis engine mismatch.\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -4,120 +4,195 @@
 #include <string>
 #include <cstdint>
 #include <cmath>
-#include <sstream>
+#include <vector>
+#include <chrono>
 #include "fp_utils.hpp"
+#include "golden_io.hpp"
+#include "ulp_analysis.hpp"
+
+/**
+ * @brief ULP error analysis of approximation outputs against the correctly rounded
+ * reference tables (bf16_<function>_ref.bin, from gen_bf16_reference), or against
+ * std::exp2 / std::exp in double when no table is available.
+ * * Writes, next to each other, the text report (HEX_IN HEX_OUT ULP_ERROR), its binary
+ * golden (.bin) and a JSON summary (.json) with per-binade and per-output-class
+ * histograms and the worst inputs.
+ *
+ * Usage: ulp_error_analysis [--function exp2|expe] [--input approx_out] [--output ulp.txt]
+ *                           [--reference ref.bin|none] [--threads N] [--top K]
+ * Without --function both exp2 and expe are analyzed with the default golden paths.
+ */
+
+struct AnalysisJob {
+    std::string function;   // "exp2" or "expe"
+    std::string input;
+    std::string output;
+    std::string reference;  // Reference table, empty = recompute in double
+};
+
+/**
+ * @brief Returns the binary sibling (.bin) of a text golden path if it exists, else the path itself.
+ */
+std::string prefer_binary(const std::string& txt_path) {
+    std::string bin_path = txt_path.substr(0, txt_path.rfind('.')) + ".bin";
+    return golden_is_binary(bin_path) ? bin_path : txt_path;
+}
 
-void analyze_file(const std::string& input_filename, const std::string& output_filename, bool is_base2) {
-    std::ifstream infile(input_filename);
-    if (!infile.is_open()) {
-        std::cerr << "Error: Could not open input file " << input_filename << "\n";
-        return;
-    }
-
-    std::ofstream outfile(output_filename);
-    if (!outfile.is_open()) {
-        std::cerr << "Error: Could not open output file " << output_filename << "\n";
-        return;
-    }
-
-    std::cout << "Analyzing ULP error for " << (is_base2 ? "exp2" : "expe") << " function...\n";
-    std::cout << "Input: " << input_filename << "\n";
-
-    std::string line;
-    int line_count = 0;
-    int error_count = 0;
-    double max_ulp_error = 0.0;
-    uint32_t max_ulp_input = 0;
-    double total_ulp_error = 0.0;
-    int valid_count = 0;
-
-    while (std::getline(infile, line)) {
-        // Skip empty lines or comments
-        if (line.empty() || line[0] == '/' || line[0] == '#') {
-            continue;
-        }
-
-        std::istringstream iss(line);
-        std::string hex_input, hex_output;
-        
-        if (!(iss >> hex_input >> hex_output)) {
-            std::cerr << "Warning: Could not parse line " << line_count << ": " << line << "\n";
-            error_count++;
-            continue;
-        }
-
-        // Parse hex strings to integers
-        uint32_t input_raw = std::stoul(hex_input, nullptr, 16);
-        uint32_t output_raw = std::stoul(hex_output, nullptr, 16);
+std::string replace_extension(const std::string& path, const std::string& ext) {
+    return path.substr(0, path.rfind('.')) + ext;
+}
 
-        // Convert BF16 input to double (this is the 'x' value)
-        double x_value = fp_to_double(input_raw, FPType::BF16);
+AnalysisJob default_job(const std::string& function) {
+    std::string reference = "modeling/golden_ref/bf16_" + function + "_ref.bin";
+    return {function, prefer_binary("modeling/golden_ref/bf16_" + function + "_approx_out.txt"),
+            "modeling/golden_ref/bf16_" + function + "_ulp.txt", golden_is_binary(reference) ? reference : ""};
+}
 
-        // Convert BF16 output to double (this is the approximation result)
-        double approx_result = fp_to_double(output_raw, FPType::BF16);
+bool analyze_file(const AnalysisJob& job, const UlpAnalysisOptions& opts) {
+    const bool is_base2 = (job.function == "exp2");
 
-        // Calculate the ideal reference value using double precision
-        double reference;
-        if (is_base2) {
-            reference = std::exp2(x_value);
-        } else {
-            reference = std::exp(x_value);
-        }
+    GoldenFile approx;
+    std::string error;
+    if (!approx.open(job.input, &error)) {
+        std::cerr << "Error: " << error << "\n";
+        return false;
+    }
 
-        // Calculate ULP error
-        double ulp_error = calculate_ulp_error(reference, approx_result, FPType::BF16);
-
-        // Write to output file: HEX_IN HEX_OUT ULP_ERROR
-        outfile << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << input_raw 
-                << " " << std::setw(4) << std::setfill('0') << output_raw
-                << " " << std::dec << std::fixed << std::setprecision(4);
-        
-        if (std::isnan(ulp_error)) {
-            outfile << "NaN";
-        } else if (std::isinf(ulp_error)) {
-            outfile << "Inf";
-        } else {
-            outfile << ulp_error;
-            
-            // Track statistics (only for finite errors)
-            if (ulp_error > max_ulp_error) {
-                max_ulp_error = ulp_error;
-                max_ulp_input = input_raw;
-            }
-            total_ulp_error += ulp_error;
-            valid_count++;
-        }
-        outfile << "\n";
+    std::cout << "Analyzing ULP error for " << job.function << " function...\n";
+    std::cout << "Input: " << job.input << (approx.is_mapped() ? " (mmap)" : " (text)") << "\n";
 
-        line_count++;
+    GoldenFile reference;
+    if (!job.reference.empty() && !reference.open(job.reference, &error)) {
+        std::cerr << "Error: " << error << "\n";
+        return false;
     }
+    std::cout << "Reference: " << (job.reference.empty() ? std::string("double-precision recompute") : job.reference) << "\n";
+
+    auto start = std::chrono::steady_clock::now();
+    UlpReport report;
+    const uint16_t* outputs = approx.results();
+    const uint32_t first_input = static_cast<uint32_t>(approx.first_input());
+    if (job.reference.empty()) {
+        report = ulp_analyze(outputs, approx.count(), first_input,
+                             [is_base2](double x) { return is_base2 ? std::exp2(x) : std::exp(x); }, FPType::BF16, opts);
+    } else if (!ulp_analyze_reference(outputs, approx.count(), first_input, reference, report, FPType::BF16, opts, &error)) {
+        std::cerr << "Error: " << job.reference << ": " << error << "\n";
+        return false;
+    }
+    double analysis_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
 
-    infile.close();
+    // Text report
+    std::ofstream outfile(job.output, std::ios::binary);
+    if (!outfile.is_open()) {
+        std::cerr << "Error: Could not open output file " << job.output << "\n";
+        return false;
+    }
+    outfile.write(report.text.data(), static_cast<std::streamsize>(report.text.size()));
     outfile.close();
 
+    // Binary ULP report and JSON summary next to the text one
+    int error_count = 0;     // Failed .bin / .json writes
+    std::string bin_output_filename = replace_extension(job.output, ".bin");
+    std::string json_output_filename = replace_extension(job.output, ".json");
+    GoldenInfo info = approx.info();
+    info.format = GoldenFormat::UlpReport;
+    if (!golden_write_binary(bin_output_filename, info, approx.results(), report.ulp.data(), approx.count(), &error)) {
+        std::cerr << "Error: " << error << "\n";
+        error_count++;
+    }
+    if (!ulp_write_json(json_output_filename, report, job.function)) {
+        std::cerr << "Error: Could not write " << json_output_filename << "\n";
+        error_count++;
+    }
+
     // Print summary
-    std::cout << "=== ULP Error Analysis Summary (" << (is_base2 ? "exp2" : "expe") << ") ===\n";
-    std::cout << "Total lines processed: " << line_count << "\n";
-    std::cout << "Valid measurements: " << valid_count << "\n";
-    std::cout << "Parse errors: " << error_count << "\n";
-    
-    if (valid_count > 0) {
+    const UlpHistogram& total = report.total;
+    std::cout << "=== ULP Error Analysis Summary (" << job.function << ") ===\n";
+    std::cout << "Total lines processed: " << total.count << "\n";
+    std::cout << "Valid measurements: " << total.finite << "\n";
+    std::cout << "Write errors: " << error_count << "\n";
+
+    if (total.finite > 0) {
         std::cout << std::fixed << std::setprecision(4);
-        std::cout << "Max ULP error: " << max_ulp_error 
-                  << " (at input 0x" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << max_ulp_input << ")\n";
-        std::cout << std::dec << "Average ULP error: " << (total_ulp_error / valid_count) << "\n";
+        std::cout << "Max ULP error: " << total.max_ulp
+                  << " (at input 0x" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << report.max_ulp_input << ")\n";
+        std::cout << std::dec << "Average ULP error: " << total.mean_ulp() << "\n";
     }
 
-    std::cout << "Results written to: " << output_filename << "\n";
+    std::cout << "By output class:";
+    for (int c = 0; c < static_cast<int>(UlpOutputClass::Count); ++c) {
+        if (report.by_class[c].count) {
+            std::cout << " " << ulp_output_class_name(static_cast<UlpOutputClass>(c)) << "=" << report.by_class[c].count;
+        }
+    }
+    std::cout << "\n";
+    if (!report.worst.empty()) {
+        std::cout << "Worst input: 0x" << std::hex << std::uppercase << std::setw(4) << std::setfill('0')
+                  << report.worst[0].input << std::dec << " (" << report.worst[0].ulp << " ULP)\n";
+    }
+    std::cout << "Analysis time: " << std::setprecision(1) << analysis_ms << " ms\n";
+
+    std::cout << "Results written to: " << job.output << ", " << bin_output_filename << " and " << json_output_filename << "\n";
     std::cout << "----------------------------------------\n\n";
+    return error_count == 0;
 }
 
-int main() {
-    // Analyze exp2 (Base 2)
-    analyze_file("modeling/golden_ref/bf16_exp2_approx_out.txt", "modeling/golden_ref/bf16_exp2_ulp.txt", true);
+int main(int argc, char** argv) {
+    std::string function;
+    std::string input;
+    std::string output;
+    std::string reference;
+    UlpAnalysisOptions opts;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--function" && i + 1 < argc) {
+            function = argv[++i];
+        } else if (arg == "--input" && i + 1 < argc) {
+            input = argv[++i];
+        } else if (arg == "--output" && i + 1 < argc) {
+            output = argv[++i];
+        } else if (arg == "--reference" && i + 1 < argc) {
+            reference = argv[++i];
+        } else if (arg == "--threads" && i + 1 < argc) {
+            opts.num_threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--top" && i + 1 < argc) {
+            opts.top_k = std::stoul(argv[++i]);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--function exp2|expe] [--input approx_out] [--output ulp.txt]"
+                      << " [--reference ref.bin|none] [--threads N] [--top K]\n";
+            return 1;
+        }
+    }
 
-    // Analyze expe (Base e)
-    analyze_file("modeling/golden_ref/bf16_expe_approx_out.txt", "modeling/golden_ref/bf16_expe_ulp.txt", false);
+    if (!function.empty() && function != "exp2" && function != "expe") {
+        std::cerr << "Error: Unknown function " << function << " (expected exp2 or expe)\n";
+        return 1;
+    }
+    if (function.empty() && (!input.empty() || !output.empty())) {
+        std::cerr << "Error: --input/--output need --function\n";
+        return 1;
+    }
 
-    return 0;
-}
\ No newline at end of file
+    std::vector<AnalysisJob> jobs;
+    if (function.empty()) {
+        jobs.push_back(default_job("exp2"));   // Base 2
+        jobs.push_back(default_job("expe"));   // Base e
+    } else {
+        AnalysisJob job = default_job(function);
+        if (!input.empty()) job.input = input;
+        if (!output.empty()) job.output = output;
+        jobs.push_back(job);
+    }
+    if (!reference.empty()) {
+        if (reference != "none" && jobs.size() > 1) {
+            std::cerr << "Error: --reference with a table needs --function\n";
+            return 1;
+        }
+        for (AnalysisJob& job : jobs) job.reference = (reference == "none") ? "" : reference;
+    }
+
+    bool ok = true;
+    for (const AnalysisJob& job : jobs) ok &= analyze_file(job, opts);
+    return ok ? 0 : 1;
+}